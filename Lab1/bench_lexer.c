@@ -0,0 +1,70 @@
+// bench_lexer.c — время разбора файла, в котором почти всё — токены
+// (комментарии, строки): дерево у таких входов крошечное, так что замер
+// показывает в основном скорость лексера.
+//
+// usage: bench_lexer <input> [repeats]
+// Печатает лучшее время из repeats разборов и скорость в МБ/с.
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <tree_sitter/api.h>
+
+const TSLanguage *tree_sitter_v2lang_test(void);
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <input> [repeats]\n", argv[0]);
+        return 1;
+    }
+    int repeats = (argc > 2) ? atoi(argv[2]) : 5;
+    if (repeats < 1) repeats = 1;
+
+    // вход читается заранее, чтобы в замер не попадал ввод-вывод
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) { perror(argv[1]); return 2; }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *text = malloc(size > 0 ? (size_t)size : 1);
+    if (!text || fread(text, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "Cannot read %s\n", argv[1]);
+        fclose(f);
+        free(text);
+        return 2;
+    }
+    fclose(f);
+
+    TSParser *parser = ts_parser_new();
+    if (!ts_parser_set_language(parser, tree_sitter_v2lang_test())) {
+        fprintf(stderr, "Failed to set language.\n");
+        free(text);
+        ts_parser_delete(parser);
+        return 3;
+    }
+
+    double best = -1;
+    int errors = 0;
+    for (int i = 0; i < repeats; ++i) {
+        double t0 = now_sec();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, text, (uint32_t)size);
+        double t = now_sec() - t0;
+        if (!tree) { fprintf(stderr, "Parse failed (null tree).\n"); break; }
+        errors = ts_node_has_error(ts_tree_root_node(tree));
+        ts_tree_delete(tree);
+        if (best < 0 || t < best) best = t;
+    }
+    if (best >= 0) {
+        printf("%-32s %10ld bytes %9.3f ms %8.1f MB/s%s\n", argv[1], size, best * 1e3,
+               (double)size / best / 1e6, errors ? "  (syntax errors)" : "");
+    }
+
+    ts_parser_delete(parser);
+    free(text);
+    return best >= 0 ? 0 : 4;
+}
@@ -0,0 +1,71 @@
+#!/usr/bin/env zsh
+# Lexer benchmark on a comment-heavy and a string-heavy input of about N
+# lines, in MB/s:
+#   - Lab1/bench_scanner.c runs src/scanner.c alone over the input, with a
+#     byte-wise TSLexer and no parser, so it times only the external scanner;
+#   - Lab1/bench_lexer.c times whole ts_parser_parse_string calls. Both inputs
+#     have a tiny tree, so most of that is lexing (the external scanner for
+#     comments and strings, keyword extraction for the rest), but parse
+#     actions are included.
+#
+# With a second argument, the same inputs are also parsed with the parser in
+# that directory (a src/ with parser.c and, if present, scanner.c), e.g. one
+# generated from an older grammar.js, for a before/after comparison.
+set -euo pipefail
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+N=${1:-200000}
+OTHER_SRC=${2:-}
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+build_bench() {
+  local src=$1 out=$2
+  local -a sources
+  sources=("$src/parser.c")
+  [ -f "$src/scanner.c" ] && sources+=("$src/scanner.c")
+  clang -O2 "$ROOT/Lab1/bench_lexer.c" $sources "$ROOT/vendor/tree-sitter/lib/src/lib.c" \
+    -I "$src" -I "$ROOT/vendor/tree-sitter/lib/include" -I "$ROOT/vendor/tree-sitter/lib/src" -o "$out"
+}
+
+# one method whose body is mostly comments: a `//` line comment per line and
+# a multi-line `{ ... }` comment every 8 lines
+awk -v n="$N" 'BEGIN {
+  print "method comments()"
+  print "begin"
+  for (i = 0; i < n; i++) {
+    if (i % 8 == 0) { print "  { block comment " i; print "    method begin end while repeat \"not a string\" }" }
+    else print "  // line comment " i " with keywords method begin end and a \"quote\""
+    if (i % 64 == 0) print "  x := " i ";"
+  }
+  print "end;"
+}' > "$WORK/comments.txt"
+
+# one method assigning long string literals with escapes
+awk -v n="$N" 'BEGIN {
+  print "method strings()"
+  print "begin"
+  for (i = 0; i < n; i++)
+    printf "  s := \"line %d: some text with \\\"escaped quotes\\\" and a \\\\ backslash, // not a comment { nor this }\";\n", i
+  print "end;"
+}' > "$WORK/strings.txt"
+
+build_scanner_bench() {
+  local src=$1 out=$2
+  clang -O2 "$ROOT/Lab1/bench_scanner.c" "$src/scanner.c" -I "$src" -o "$out"
+}
+
+build_scanner_bench "$ROOT/Lab1/src" "$WORK/scanner_now"
+echo "external scanner alone:"
+for f in comments strings; do "$WORK/scanner_now" "$WORK/$f.txt" 5; done
+
+build_bench "$ROOT/Lab1/src" "$WORK/bench_now"
+echo "current parser (whole parse):"
+for f in comments strings; do "$WORK/bench_now" "$WORK/$f.txt" 5; done
+
+if [ -n "$OTHER_SRC" ]; then
+  build_bench "$OTHER_SRC" "$WORK/bench_other"
+  echo "parser in $OTHER_SRC (whole parse):"
+  for f in comments strings; do "$WORK/bench_other" "$WORK/$f.txt" 5; done
+fi
@@ -0,0 +1,95 @@
+// bench_scanner.c — время одного внешнего сканера (src/scanner.c), без
+// парсера и без сгенерированного лексера: вход прогоняется через
+// tree_sitter_v2lang_test_external_scanner_scan с минимальным TSLexer,
+// который идёт по байтам. Так видно, сколько стоят сами комментарии и строки,
+// отдельно от разбора, который меряет bench_lexer.
+//
+// usage: bench_scanner <input> [repeats]
+// Печатает лучшее время из repeats проходов, скорость в МБ/с, число токенов
+// и долю входа, которую заняли токены сканера.
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "tree_sitter/parser.h"
+
+bool tree_sitter_v2lang_test_external_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols);
+
+// TSLexer поверх буфера; поля base должны идти первыми
+typedef struct ByteLexer {
+    TSLexer base;
+    const char *p;
+    const char *end;
+} ByteLexer;
+
+static void byte_advance(TSLexer *l, bool skip) {
+    (void)skip;
+    ByteLexer *b = (ByteLexer *)l;
+    if (b->p < b->end) b->p++;
+    l->lookahead = (b->p < b->end) ? (unsigned char)*b->p : 0;
+}
+
+static void byte_mark_end(TSLexer *l) { (void)l; }
+static uint32_t byte_get_column(TSLexer *l) { (void)l; return 0; }
+static bool byte_at_range_start(const TSLexer *l) { (void)l; return false; }
+static bool byte_eof(const TSLexer *l) { const ByteLexer *b = (const ByteLexer *)l; return b->p >= b->end; }
+static void byte_log(const TSLexer *l, const char *fmt, ...) { (void)l; (void)fmt; }
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <input> [repeats]\n", argv[0]);
+        return 1;
+    }
+    int repeats = (argc > 2) ? atoi(argv[2]) : 5;
+    if (repeats < 1) repeats = 1;
+
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) { perror(argv[1]); return 2; }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *text = malloc(size > 0 ? (size_t)size : 1);
+    if (!text || fread(text, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "Cannot read %s\n", argv[1]);
+        fclose(f);
+        free(text);
+        return 2;
+    }
+    fclose(f);
+
+    static const bool valid[2] = { true, true };
+    ByteLexer lx = { { 0, 0, byte_advance, byte_mark_end, byte_get_column, byte_at_range_start, byte_eof, byte_log }, NULL, NULL };
+    lx.end = text + size;
+    double best = -1;
+    long tokens = 0, token_bytes = 0;
+    for (int i = 0; i < repeats; ++i) {
+        tokens = 0;
+        token_bytes = 0;
+        double t0 = now_sec();
+        const char *pos = text;
+        while (pos < lx.end) {
+            lx.p = pos;
+            lx.base.lookahead = (unsigned char)*pos;
+            const char *start = pos;
+            if (tree_sitter_v2lang_test_external_scanner_scan(NULL, &lx.base, valid)) {
+                ++tokens;
+                token_bytes += lx.p - start;
+                pos = lx.p;
+            } else {
+                // остальное читает сгенерированный лексер; здесь просто шаг вперёд
+                pos = (lx.p > start) ? lx.p : start + 1;
+            }
+        }
+        double t = now_sec() - t0;
+        if (best < 0 || t < best) best = t;
+    }
+    printf("%-32s %10ld bytes %9.3f ms %8.1f MB/s %8ld tokens (%.0f%% of input)\n", argv[1], size, best * 1e3,
+           (double)size / best / 1e6, tokens, size > 0 ? 100.0 * (double)token_bytes / (double)size : 0.0);
+    free(text);
+    return 0;
+}
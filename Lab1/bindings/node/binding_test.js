@@ -7,3 +7,16 @@ test("can load grammar", () => {
   const parser = new Parser();
   assert.doesNotThrow(() => parser.setLanguage(require(".")));
 });
+
+test("binary expressions nest without per-level wrappers", () => {
+  const parser = new Parser();
+  parser.setLanguage(require("."));
+  const tree = parser.parse("method f()\nbegin\n  x := -a + b * c;\nend;\n");
+  const assignment = tree.rootNode.descendantsOfType("assignment")[0];
+  assert.strictEqual(
+    assignment.toString(),
+    "(assignment target: (identifier) value: (expr (binary_expression left: (unary_expression operand: (identifier)) " +
+      "right: (binary_expression left: (identifier) right: (identifier)))))",
+  );
+  assert.strictEqual(assignment.descendantsOfType("binary_expression")[0].childForFieldName("operator").type, "+");
+});
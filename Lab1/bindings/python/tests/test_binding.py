@@ -10,3 +10,14 @@ class TestLanguage(TestCase):
             Parser(Language(tree_sitter_lab1.language()))
         except Exception:
             self.fail("Error loading Lab1 grammar")
+
+    def test_binary_expressions_nest_without_wrappers(self):
+        parser = Parser(Language(tree_sitter_lab1.language()))
+        tree = parser.parse(b"method f()\nbegin\n  y = y + 1;\nend;\n")
+        stmt = tree.root_node.named_children[0]
+        while stmt.type != "expr_stmt":
+            stmt = stmt.named_children[-1]
+        expr = stmt.named_children[0].named_children[0]
+        self.assertEqual(expr.type, "binary_expression")
+        self.assertEqual(expr.child_by_field_name("operator").type, "=")
+        self.assertEqual(expr.child_by_field_name("right").type, "binary_expression")
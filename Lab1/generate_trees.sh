@@ -10,8 +10,8 @@ AST_DUMP="$ROOT/ast_dump"
 
 build_ast_dump() {
   echo "Building ast_dump..."
-  clang "$ROOT/ast_dump.c" "$ROOT/Lab1/src/parser.c" \
-    "$ROOT/vendor/tree-sitter/lib/src/lib.c" \
+  clang "$ROOT/ast_dump.c" "$ROOT/Lab2/source_map.c" "$ROOT/Lab2/flat_ast.c" "$ROOT/Lab2/hash.c" "$ROOT/Lab2/arena.c" "$ROOT/Lab1/src/parser.c" "$ROOT/Lab1/src/scanner.c" \
+    "$ROOT/vendor/tree-sitter/lib/src/lib.c" -I "$ROOT/Lab2" \
     -I "$ROOT/vendor/tree-sitter/lib/include" -I "$ROOT/vendor/tree-sitter/lib/src" -o "$AST_DUMP"
 }
 
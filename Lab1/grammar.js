@@ -1,20 +1,38 @@
 // grammar.js — комбинированная версия (структура + лексика)
+
+// приоритеты бинарных и унарных операций, от слабых к сильным
+const PREC = {
+  logical_or: 1,
+  logical_and: 2,
+  bitwise_or: 3,
+  bitwise_xor: 4,
+  bitwise_and: 5,
+  equality: 6,
+  relational: 7,
+  shift: 8,
+  add: 9,
+  mul: 10,
+  unary: 11,
+  postfix: 12,
+};
+
 module.exports = grammar({
   name: 'v2lang_test',
 
   // Игнорируем пробелы и комментарии
   extras: $ => [/\s+/, $.comment],
 
+  // комментарии и строки читает src/scanner.c
+  externals: $ => [$.comment, $.str],
+
+  // ключевые слова лексер сначала читает как identifier, а потом сверяет
+  // с отдельной маленькой таблицей ключевых слов
+  word: $ => $.identifier,
+
   rules: {
     // ---- Входной файл ----
     source_file: $ => repeat($.sourceItem),
 
-    // ---- Комментарии ----
-    comment: _ => token(choice(
-      seq('//', /[^\n]*/),
-      seq('{', /[^}]*/, '}')
-    )),
-
     // ---- Элементы программы ----
     sourceItem: $ => choice($.funcDef),
 
@@ -30,24 +48,24 @@ module.exports = grammar({
 
     // funcSignature: identifier '(' list<argDef> ')' (':' typeRef)?
     funcSignature: $ => seq(
-      $.identifier,
-      '(', optional(seq(optional($.argList))), ')',
-      optional(seq(':', $.typeRef))
+      field('name', $.identifier),
+      '(', optional(seq(optional(field('args', $.argList)))), ')',
+      optional(seq(':', field('returns', $.typeRef)))
     ),
 
     argList: $ => seq($.argDef, repeat(seq(',', $.argDef))),
 
-    argDef: $ => seq($.identifier, optional(seq(':', $.typeRef))),
+    argDef: $ => seq(field('name', $.identifier), optional(seq(':', field('type', $.typeRef)))),
 
     // method foo(...) body|;
-    funcDef: $ => seq('method', $.funcSignature, choice($.body, ';')),
+    funcDef: $ => seq('method', field('signature', $.funcSignature), choice(field('body', $.body), ';')),
 
     body: $ => seq(
       repeat(seq('var', repeat($.varDecl))),
-      $.block
+      field('block', $.block)
     ),
 
-    varDecl: $ => seq($.idList, optional(seq(':', $.typeRef)), ';'),
+    varDecl: $ => seq(field('names', $.idList), optional(seq(':', field('type', $.typeRef))), ';'),
 
     idList: $ => prec.left(3, seq($.identifier, repeat(seq(',', $.identifier)))),
 
@@ -62,60 +80,82 @@ module.exports = grammar({
       $.expr_stmt
     ),
 
-    if_statement: $ => prec.right(seq('if', $.expr, 'then', $.statement, optional(seq('else', $.statement)))),
+    if_statement: $ => prec.right(seq(
+      'if', field('condition', $.expr),
+      'then', field('consequence', $.statement),
+      optional(seq('else', field('alternative', $.statement)))
+    )),
 
     block: $ => seq('begin', repeat($.statement), 'end', ';'),
 
-    while_statement: $ => seq('while', $.expr, 'do', $.statement),
+    while_statement: $ => seq('while', field('condition', $.expr), 'do', field('body', $.statement)),
 
-    do_statement: $ => seq('repeat', $.statement, choice('while', 'until'), $.expr, ';'),
+    // kind: `while` repeats while the condition holds, `until` until it does
+    do_statement: $ => seq(
+      'repeat', field('body', $.statement),
+      field('kind', choice('while', 'until')), field('condition', $.expr), ';'
+    ),
 
     break_statement: $ => seq('break', ';'),
 
     expr_stmt: $ => seq($.expr, ';'),
 
     // ---- Expressions with precedence ----
-    expr: $ => $._expr,
-
-    _expr: $ => choice(
-      $.logical_or
+    // One binary_expression with a prec.left level per operator group instead
+    // of a rule per level, so an operand is not wrapped in a node per level.
+    expr: $ => $._expression,
+
+    _expression: $ => choice(
+      $.binary_expression,
+      $.unary_expression,
+      $._operand
     ),
 
-    logical_or: $ => prec.left(seq($.logical_and, repeat(seq(choice('||', 'or'), $.logical_and)))),
-    logical_and: $ => prec.left(seq($.bitwise_or, repeat(seq(choice('&&', 'and'), $.bitwise_or)))),
-
-    bitwise_or: $ => prec.left(seq($.bitwise_xor, repeat(seq('|', $.bitwise_xor)))),
-    bitwise_xor: $ => prec.left(seq($.bitwise_and, repeat(seq('^', $.bitwise_and)))),
-    bitwise_and: $ => prec.left(seq($.equality, repeat(seq('&', $.equality)))),
-
-    equality: $ => prec.left(seq($.relational, repeat(seq(choice('=', '!='), $.relational)))),
-    relational: $ => prec.left(seq($.shift, repeat(seq(choice('<', '>', '<=', '>='), $.shift)))),
-
-    shift: $ => prec.left(seq($.add, repeat(seq(choice('<<', '>>'), $.add)))),
-
-    add: $ => prec.left(seq($.mul, repeat(seq(choice('+', '-'), $.mul)))),
-    mul: $ => prec.left(seq($.unary, repeat(seq(choice('*', '/', '%'), $.unary)))),
+    binary_expression: $ => choice(...[
+      [PREC.logical_or, choice('||', 'or')],
+      [PREC.logical_and, choice('&&', 'and')],
+      [PREC.bitwise_or, '|'],
+      [PREC.bitwise_xor, '^'],
+      [PREC.bitwise_and, '&'],
+      [PREC.equality, choice('=', '!=')],
+      [PREC.relational, choice('<', '>', '<=', '>=')],
+      [PREC.shift, choice('<<', '>>')],
+      [PREC.add, choice('+', '-')],
+      [PREC.mul, choice('*', '/', '%')],
+    ].map(([p, op]) => prec.left(p, seq(
+      field('left', $._expression),
+      field('operator', op),
+      field('right', $._expression)
+    )))),
+
+    unary_expression: $ => prec(PREC.unary, seq(
+      field('operator', choice('-', '!', 'not', '~')),
+      field('operand', $._expression)
+    )),
 
-    unary: $ => choice(seq(choice('-', '!', 'not', '~'), $.unary), $.postfix),
+    // assignment is a statement (not an expression): operand ':=' expr ';'
+    assignment: $ => prec.right(seq(field('target', $._operand), ':=', field('value', $.expr), ';')),
 
-    // assignment is a statement (not an expression): postfix ':=' expr ';'
-    assignment: $ => prec.right(seq($.postfix, ':=', $.expr, ';')),
+    // literals, identifiers, parenthesis and calls/indexers on them
+    _operand: $ => choice($.postfix, $.parenthesized_expression, $.literal, $.identifier),
 
-    // primary expressions: literals, identifiers, parenthesis
-    primary: $ => choice($.literal, $.identifier, seq('(', $.expr, ')')),
+    parenthesized_expression: $ => seq('(', $.expr, ')'),
 
-    // postfix: primary with any number of calls/indexers
-    postfix: $ => choice(
-      $.primary,
-      seq($.postfix, '(', optional($.exprList), ')'),
-      seq($.postfix, '[', optional($.exprList), ']')
-    ),
+    // postfix: a call or indexer; chains nest f(a)[i] as postfix(postfix(f ...))
+    // open: `(` for a call, `[` for an indexer
+    postfix: $ => prec(PREC.postfix, seq(
+      field('operand', $._operand),
+      choice(
+        seq(field('open', '('), optional(field('args', $.exprList)), ')'),
+        seq(field('open', '['), optional(field('args', $.exprList)), ']')
+      )
+    )),
 
     exprList: $ => seq($.expr, repeat(seq(',', $.expr))),
 
     // ---- Лексемы ----
+    // str и comment — внешние токены (externals), см. src/scanner.c
     identifier: _ => /[a-zA-Z_][a-zA-Z_0-9]*/,             // идентификатор
-    str:        _ => /"[^"\\]*(?:\\.[^"\\]*)*"/,            // строка в кавычках
     char:       _ => /'[^'\\]'/,                              // одиночный символ
     hex:        _ => /0[xX][0-9A-Fa-f]+/,                   // 0x...
     bits:       _ => /0[bB][01]+/,                          // 0b...
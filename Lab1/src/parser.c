@@ -7,81 +7,81 @@
 #endif
 
 #define LANGUAGE_VERSION 15
-#define STATE_COUNT 217
+#define STATE_COUNT 187
 #define LARGE_STATE_COUNT 2
-#define SYMBOL_COUNT 117
+#define SYMBOL_COUNT 99
 #define ALIAS_COUNT 0
 #define TOKEN_COUNT 63
-#define EXTERNAL_TOKEN_COUNT 0
-#define FIELD_COUNT 0
+#define EXTERNAL_TOKEN_COUNT 2
+#define FIELD_COUNT 19
 #define MAX_ALIAS_SEQUENCE_LENGTH 6
 #define MAX_RESERVED_WORD_SET_SIZE 0
-#define PRODUCTION_ID_COUNT 1
+#define PRODUCTION_ID_COUNT 21
 #define SUPERTYPE_COUNT 0
 
 enum ts_symbol_identifiers {
-  sym_comment = 1,
-  anon_sym_bool = 2,
-  anon_sym_byte = 3,
-  anon_sym_int = 4,
-  anon_sym_uint = 5,
-  anon_sym_long = 6,
-  anon_sym_ulong = 7,
-  anon_sym_char = 8,
-  anon_sym_string = 9,
-  anon_sym_array = 10,
-  anon_sym_LBRACK = 11,
-  anon_sym_COMMA = 12,
-  anon_sym_RBRACK = 13,
-  anon_sym_of = 14,
-  anon_sym_LPAREN = 15,
-  anon_sym_RPAREN = 16,
-  anon_sym_COLON = 17,
-  anon_sym_method = 18,
-  anon_sym_SEMI = 19,
-  anon_sym_var = 20,
-  anon_sym_if = 21,
-  anon_sym_then = 22,
-  anon_sym_else = 23,
-  anon_sym_begin = 24,
-  anon_sym_end = 25,
-  anon_sym_while = 26,
-  anon_sym_do = 27,
-  anon_sym_repeat = 28,
-  anon_sym_until = 29,
-  anon_sym_break = 30,
-  anon_sym_PIPE_PIPE = 31,
-  anon_sym_or = 32,
-  anon_sym_AMP_AMP = 33,
-  anon_sym_and = 34,
-  anon_sym_PIPE = 35,
-  anon_sym_CARET = 36,
-  anon_sym_AMP = 37,
-  anon_sym_EQ = 38,
-  anon_sym_BANG_EQ = 39,
-  anon_sym_LT = 40,
-  anon_sym_GT = 41,
-  anon_sym_LT_EQ = 42,
-  anon_sym_GT_EQ = 43,
-  anon_sym_LT_LT = 44,
-  anon_sym_GT_GT = 45,
-  anon_sym_PLUS = 46,
-  anon_sym_DASH = 47,
-  anon_sym_STAR = 48,
-  anon_sym_SLASH = 49,
-  anon_sym_PERCENT = 50,
-  anon_sym_BANG = 51,
-  anon_sym_not = 52,
-  anon_sym_TILDE = 53,
-  anon_sym_COLON_EQ = 54,
-  sym_identifier = 55,
-  sym_str = 56,
-  sym_char = 57,
-  sym_hex = 58,
-  sym_bits = 59,
-  sym_dec = 60,
-  anon_sym_true = 61,
-  anon_sym_false = 62,
+  anon_sym_bool = 1,
+  anon_sym_byte = 2,
+  anon_sym_int = 3,
+  anon_sym_uint = 4,
+  anon_sym_long = 5,
+  anon_sym_ulong = 6,
+  anon_sym_char = 7,
+  anon_sym_string = 8,
+  anon_sym_array = 9,
+  anon_sym_LBRACK = 10,
+  anon_sym_COMMA = 11,
+  anon_sym_RBRACK = 12,
+  anon_sym_of = 13,
+  anon_sym_LPAREN = 14,
+  anon_sym_RPAREN = 15,
+  anon_sym_COLON = 16,
+  anon_sym_method = 17,
+  anon_sym_SEMI = 18,
+  anon_sym_var = 19,
+  anon_sym_if = 20,
+  anon_sym_then = 21,
+  anon_sym_else = 22,
+  anon_sym_begin = 23,
+  anon_sym_end = 24,
+  anon_sym_while = 25,
+  anon_sym_do = 26,
+  anon_sym_repeat = 27,
+  anon_sym_until = 28,
+  anon_sym_break = 29,
+  anon_sym_PIPE_PIPE = 30,
+  anon_sym_or = 31,
+  anon_sym_AMP_AMP = 32,
+  anon_sym_and = 33,
+  anon_sym_PIPE = 34,
+  anon_sym_CARET = 35,
+  anon_sym_AMP = 36,
+  anon_sym_EQ = 37,
+  anon_sym_BANG_EQ = 38,
+  anon_sym_LT = 39,
+  anon_sym_GT = 40,
+  anon_sym_LT_EQ = 41,
+  anon_sym_GT_EQ = 42,
+  anon_sym_LT_LT = 43,
+  anon_sym_GT_GT = 44,
+  anon_sym_PLUS = 45,
+  anon_sym_DASH = 46,
+  anon_sym_STAR = 47,
+  anon_sym_SLASH = 48,
+  anon_sym_PERCENT = 49,
+  anon_sym_BANG = 50,
+  anon_sym_not = 51,
+  anon_sym_TILDE = 52,
+  anon_sym_COLON_EQ = 53,
+  sym_identifier = 54,
+  sym_char = 55,
+  sym_hex = 56,
+  sym_bits = 57,
+  sym_dec = 58,
+  anon_sym_true = 59,
+  anon_sym_false = 60,
+  sym_comment = 61,
+  sym_str = 62,
   sym_source_file = 63,
   sym_sourceItem = 64,
   sym_typeRef = 65,
@@ -100,47 +100,28 @@ enum ts_symbol_identifiers {
   sym_break_statement = 78,
   sym_expr_stmt = 79,
   sym_expr = 80,
-  sym__expr = 81,
-  sym_logical_or = 82,
-  sym_logical_and = 83,
-  sym_bitwise_or = 84,
-  sym_bitwise_xor = 85,
-  sym_bitwise_and = 86,
-  sym_equality = 87,
-  sym_relational = 88,
-  sym_shift = 89,
-  sym_add = 90,
-  sym_mul = 91,
-  sym_unary = 92,
-  sym_assignment = 93,
-  sym_primary = 94,
-  sym_postfix = 95,
-  sym_exprList = 96,
-  sym_bool = 97,
-  sym_literal = 98,
-  aux_sym_source_file_repeat1 = 99,
-  aux_sym_typeRef_repeat1 = 100,
-  aux_sym_argList_repeat1 = 101,
-  aux_sym_body_repeat1 = 102,
-  aux_sym_body_repeat2 = 103,
-  aux_sym_idList_repeat1 = 104,
-  aux_sym_block_repeat1 = 105,
-  aux_sym_logical_or_repeat1 = 106,
-  aux_sym_logical_and_repeat1 = 107,
-  aux_sym_bitwise_or_repeat1 = 108,
-  aux_sym_bitwise_xor_repeat1 = 109,
-  aux_sym_bitwise_and_repeat1 = 110,
-  aux_sym_equality_repeat1 = 111,
-  aux_sym_relational_repeat1 = 112,
-  aux_sym_shift_repeat1 = 113,
-  aux_sym_add_repeat1 = 114,
-  aux_sym_mul_repeat1 = 115,
-  aux_sym_exprList_repeat1 = 116,
+  sym__expression = 81,
+  sym_binary_expression = 82,
+  sym_unary_expression = 83,
+  sym_assignment = 84,
+  sym__operand = 85,
+  sym_parenthesized_expression = 86,
+  sym_postfix = 87,
+  sym_exprList = 88,
+  sym_bool = 89,
+  sym_literal = 90,
+  aux_sym_source_file_repeat1 = 91,
+  aux_sym_typeRef_repeat1 = 92,
+  aux_sym_argList_repeat1 = 93,
+  aux_sym_body_repeat1 = 94,
+  aux_sym_body_repeat2 = 95,
+  aux_sym_idList_repeat1 = 96,
+  aux_sym_block_repeat1 = 97,
+  aux_sym_exprList_repeat1 = 98,
 };
 
 static const char * const ts_symbol_names[] = {
   [ts_builtin_sym_end] = "end",
-  [sym_comment] = "comment",
   [anon_sym_bool] = "bool",
   [anon_sym_byte] = "byte",
   [anon_sym_int] = "int",
@@ -195,13 +176,14 @@ static const char * const ts_symbol_names[] = {
   [anon_sym_TILDE] = "~",
   [anon_sym_COLON_EQ] = ":=",
   [sym_identifier] = "identifier",
-  [sym_str] = "str",
   [sym_char] = "char",
   [sym_hex] = "hex",
   [sym_bits] = "bits",
   [sym_dec] = "dec",
   [anon_sym_true] = "true",
   [anon_sym_false] = "false",
+  [sym_comment] = "comment",
+  [sym_str] = "str",
   [sym_source_file] = "source_file",
   [sym_sourceItem] = "sourceItem",
   [sym_typeRef] = "typeRef",
@@ -220,20 +202,12 @@ static const char * const ts_symbol_names[] = {
   [sym_break_statement] = "break_statement",
   [sym_expr_stmt] = "expr_stmt",
   [sym_expr] = "expr",
-  [sym__expr] = "_expr",
-  [sym_logical_or] = "logical_or",
-  [sym_logical_and] = "logical_and",
-  [sym_bitwise_or] = "bitwise_or",
-  [sym_bitwise_xor] = "bitwise_xor",
-  [sym_bitwise_and] = "bitwise_and",
-  [sym_equality] = "equality",
-  [sym_relational] = "relational",
-  [sym_shift] = "shift",
-  [sym_add] = "add",
-  [sym_mul] = "mul",
-  [sym_unary] = "unary",
+  [sym__expression] = "_expression",
+  [sym_binary_expression] = "binary_expression",
+  [sym_unary_expression] = "unary_expression",
   [sym_assignment] = "assignment",
-  [sym_primary] = "primary",
+  [sym__operand] = "_operand",
+  [sym_parenthesized_expression] = "parenthesized_expression",
   [sym_postfix] = "postfix",
   [sym_exprList] = "exprList",
   [sym_bool] = "bool",
@@ -245,22 +219,11 @@ static const char * const ts_symbol_names[] = {
   [aux_sym_body_repeat2] = "body_repeat2",
   [aux_sym_idList_repeat1] = "idList_repeat1",
   [aux_sym_block_repeat1] = "block_repeat1",
-  [aux_sym_logical_or_repeat1] = "logical_or_repeat1",
-  [aux_sym_logical_and_repeat1] = "logical_and_repeat1",
-  [aux_sym_bitwise_or_repeat1] = "bitwise_or_repeat1",
-  [aux_sym_bitwise_xor_repeat1] = "bitwise_xor_repeat1",
-  [aux_sym_bitwise_and_repeat1] = "bitwise_and_repeat1",
-  [aux_sym_equality_repeat1] = "equality_repeat1",
-  [aux_sym_relational_repeat1] = "relational_repeat1",
-  [aux_sym_shift_repeat1] = "shift_repeat1",
-  [aux_sym_add_repeat1] = "add_repeat1",
-  [aux_sym_mul_repeat1] = "mul_repeat1",
   [aux_sym_exprList_repeat1] = "exprList_repeat1",
 };
 
 static const TSSymbol ts_symbol_map[] = {
   [ts_builtin_sym_end] = ts_builtin_sym_end,
-  [sym_comment] = sym_comment,
   [anon_sym_bool] = anon_sym_bool,
   [anon_sym_byte] = anon_sym_byte,
   [anon_sym_int] = anon_sym_int,
@@ -315,13 +278,14 @@ static const TSSymbol ts_symbol_map[] = {
   [anon_sym_TILDE] = anon_sym_TILDE,
   [anon_sym_COLON_EQ] = anon_sym_COLON_EQ,
   [sym_identifier] = sym_identifier,
-  [sym_str] = sym_str,
   [sym_char] = sym_char,
   [sym_hex] = sym_hex,
   [sym_bits] = sym_bits,
   [sym_dec] = sym_dec,
   [anon_sym_true] = anon_sym_true,
   [anon_sym_false] = anon_sym_false,
+  [sym_comment] = sym_comment,
+  [sym_str] = sym_str,
   [sym_source_file] = sym_source_file,
   [sym_sourceItem] = sym_sourceItem,
   [sym_typeRef] = sym_typeRef,
@@ -340,20 +304,12 @@ static const TSSymbol ts_symbol_map[] = {
   [sym_break_statement] = sym_break_statement,
   [sym_expr_stmt] = sym_expr_stmt,
   [sym_expr] = sym_expr,
-  [sym__expr] = sym__expr,
-  [sym_logical_or] = sym_logical_or,
-  [sym_logical_and] = sym_logical_and,
-  [sym_bitwise_or] = sym_bitwise_or,
-  [sym_bitwise_xor] = sym_bitwise_xor,
-  [sym_bitwise_and] = sym_bitwise_and,
-  [sym_equality] = sym_equality,
-  [sym_relational] = sym_relational,
-  [sym_shift] = sym_shift,
-  [sym_add] = sym_add,
-  [sym_mul] = sym_mul,
-  [sym_unary] = sym_unary,
+  [sym__expression] = sym__expression,
+  [sym_binary_expression] = sym_binary_expression,
+  [sym_unary_expression] = sym_unary_expression,
   [sym_assignment] = sym_assignment,
-  [sym_primary] = sym_primary,
+  [sym__operand] = sym__operand,
+  [sym_parenthesized_expression] = sym_parenthesized_expression,
   [sym_postfix] = sym_postfix,
   [sym_exprList] = sym_exprList,
   [sym_bool] = sym_bool,
@@ -365,16 +321,6 @@ static const TSSymbol ts_symbol_map[] = {
   [aux_sym_body_repeat2] = aux_sym_body_repeat2,
   [aux_sym_idList_repeat1] = aux_sym_idList_repeat1,
   [aux_sym_block_repeat1] = aux_sym_block_repeat1,
-  [aux_sym_logical_or_repeat1] = aux_sym_logical_or_repeat1,
-  [aux_sym_logical_and_repeat1] = aux_sym_logical_and_repeat1,
-  [aux_sym_bitwise_or_repeat1] = aux_sym_bitwise_or_repeat1,
-  [aux_sym_bitwise_xor_repeat1] = aux_sym_bitwise_xor_repeat1,
-  [aux_sym_bitwise_and_repeat1] = aux_sym_bitwise_and_repeat1,
-  [aux_sym_equality_repeat1] = aux_sym_equality_repeat1,
-  [aux_sym_relational_repeat1] = aux_sym_relational_repeat1,
-  [aux_sym_shift_repeat1] = aux_sym_shift_repeat1,
-  [aux_sym_add_repeat1] = aux_sym_add_repeat1,
-  [aux_sym_mul_repeat1] = aux_sym_mul_repeat1,
   [aux_sym_exprList_repeat1] = aux_sym_exprList_repeat1,
 };
 
@@ -383,10 +329,6 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = false,
     .named = true,
   },
-  [sym_comment] = {
-    .visible = true,
-    .named = true,
-  },
   [anon_sym_bool] = {
     .visible = true,
     .named = false,
@@ -603,10 +545,6 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [sym_str] = {
-    .visible = true,
-    .named = true,
-  },
   [sym_char] = {
     .visible = true,
     .named = true,
@@ -631,6 +569,14 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = false,
   },
+  [sym_comment] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_str] = {
+    .visible = true,
+    .named = true,
+  },
   [sym_source_file] = {
     .visible = true,
     .named = true,
@@ -703,59 +649,27 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [sym__expr] = {
+  [sym__expression] = {
     .visible = false,
     .named = true,
   },
-  [sym_logical_or] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_logical_and] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_bitwise_or] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_bitwise_xor] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_bitwise_and] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_equality] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_relational] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_shift] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_add] = {
+  [sym_binary_expression] = {
     .visible = true,
     .named = true,
   },
-  [sym_mul] = {
+  [sym_unary_expression] = {
     .visible = true,
     .named = true,
   },
-  [sym_unary] = {
+  [sym_assignment] = {
     .visible = true,
     .named = true,
   },
-  [sym_assignment] = {
-    .visible = true,
+  [sym__operand] = {
+    .visible = false,
     .named = true,
   },
-  [sym_primary] = {
+  [sym_parenthesized_expression] = {
     .visible = true,
     .named = true,
   },
@@ -803,52 +717,143 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = false,
     .named = false,
   },
-  [aux_sym_logical_or_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_logical_and_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_bitwise_or_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_bitwise_xor_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_bitwise_and_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_equality_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_relational_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_shift_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_add_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_mul_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
   [aux_sym_exprList_repeat1] = {
     .visible = false,
     .named = false,
   },
 };
 
+enum ts_field_identifiers {
+  field_alternative = 1,
+  field_args = 2,
+  field_block = 3,
+  field_body = 4,
+  field_condition = 5,
+  field_consequence = 6,
+  field_kind = 7,
+  field_left = 8,
+  field_name = 9,
+  field_names = 10,
+  field_open = 11,
+  field_operand = 12,
+  field_operator = 13,
+  field_returns = 14,
+  field_right = 15,
+  field_signature = 16,
+  field_target = 17,
+  field_type = 18,
+  field_value = 19,
+};
+
+static const char * const ts_field_names[] = {
+  [0] = NULL,
+  [field_alternative] = "alternative",
+  [field_args] = "args",
+  [field_block] = "block",
+  [field_body] = "body",
+  [field_condition] = "condition",
+  [field_consequence] = "consequence",
+  [field_kind] = "kind",
+  [field_left] = "left",
+  [field_name] = "name",
+  [field_names] = "names",
+  [field_open] = "open",
+  [field_operand] = "operand",
+  [field_operator] = "operator",
+  [field_returns] = "returns",
+  [field_right] = "right",
+  [field_signature] = "signature",
+  [field_target] = "target",
+  [field_type] = "type",
+  [field_value] = "value",
+};
+
+static const TSMapSlice ts_field_map_slices[PRODUCTION_ID_COUNT] = {
+  [1] = {.index = 0, .length = 1},
+  [2] = {.index = 1, .length = 2},
+  [3] = {.index = 3, .length = 1},
+  [4] = {.index = 4, .length = 1},
+  [5] = {.index = 5, .length = 1},
+  [6] = {.index = 6, .length = 2},
+  [7] = {.index = 8, .length = 1},
+  [8] = {.index = 9, .length = 2},
+  [9] = {.index = 11, .length = 2},
+  [10] = {.index = 13, .length = 2},
+  [11] = {.index = 15, .length = 3},
+  [12] = {.index = 18, .length = 2},
+  [13] = {.index = 20, .length = 3},
+  [14] = {.index = 23, .length = 2},
+  [15] = {.index = 25, .length = 2},
+  [16] = {.index = 27, .length = 2},
+  [17] = {.index = 29, .length = 3},
+  [18] = {.index = 32, .length = 2},
+  [19] = {.index = 34, .length = 3},
+  [20] = {.index = 37, .length = 3},
+};
+
+static const TSFieldMapEntry ts_field_map_entries[] = {
+  [0] =
+    {field_signature, 1},
+  [1] =
+    {field_body, 2},
+    {field_signature, 1},
+  [3] =
+    {field_block, 0},
+  [4] =
+    {field_name, 0},
+  [5] =
+    {field_block, 1},
+  [6] =
+    {field_args, 2},
+    {field_name, 0},
+  [8] =
+    {field_names, 0},
+  [9] =
+    {field_operand, 1},
+    {field_operator, 0},
+  [11] =
+    {field_name, 0},
+    {field_returns, 4},
+  [13] =
+    {field_name, 0},
+    {field_type, 2},
+  [15] =
+    {field_left, 0},
+    {field_operator, 1},
+    {field_right, 2},
+  [18] =
+    {field_open, 1},
+    {field_operand, 0},
+  [20] =
+    {field_args, 2},
+    {field_name, 0},
+    {field_returns, 5},
+  [23] =
+    {field_names, 0},
+    {field_type, 2},
+  [25] =
+    {field_condition, 1},
+    {field_consequence, 3},
+  [27] =
+    {field_body, 3},
+    {field_condition, 1},
+  [29] =
+    {field_args, 2},
+    {field_open, 1},
+    {field_operand, 0},
+  [32] =
+    {field_target, 0},
+    {field_value, 2},
+  [34] =
+    {field_body, 1},
+    {field_condition, 3},
+    {field_kind, 2},
+  [37] =
+    {field_alternative, 5},
+    {field_condition, 1},
+    {field_consequence, 3},
+};
+
 static const TSSymbol ts_alias_sequences[PRODUCTION_ID_COUNT][MAX_ALIAS_SEQUENCE_LENGTH] = {
   [0] = {0},
 };
@@ -863,22 +868,22 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [2] = 2,
   [3] = 3,
   [4] = 4,
-  [5] = 2,
-  [6] = 4,
-  [7] = 2,
-  [8] = 4,
+  [5] = 5,
+  [6] = 6,
+  [7] = 7,
+  [8] = 8,
   [9] = 9,
   [10] = 10,
   [11] = 11,
-  [12] = 9,
+  [12] = 12,
   [13] = 13,
-  [14] = 11,
-  [15] = 9,
-  [16] = 10,
-  [17] = 10,
-  [18] = 11,
-  [19] = 13,
-  [20] = 13,
+  [14] = 14,
+  [15] = 15,
+  [16] = 16,
+  [17] = 17,
+  [18] = 18,
+  [19] = 19,
+  [20] = 20,
   [21] = 21,
   [22] = 22,
   [23] = 23,
@@ -887,14 +892,14 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [26] = 26,
   [27] = 27,
   [28] = 28,
-  [29] = 26,
-  [30] = 25,
-  [31] = 27,
-  [32] = 25,
-  [33] = 23,
-  [34] = 26,
-  [35] = 27,
-  [36] = 23,
+  [29] = 29,
+  [30] = 30,
+  [31] = 31,
+  [32] = 32,
+  [33] = 33,
+  [34] = 34,
+  [35] = 35,
+  [36] = 36,
   [37] = 37,
   [38] = 38,
   [39] = 39,
@@ -912,12 +917,12 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [51] = 51,
   [52] = 52,
   [53] = 53,
-  [54] = 53,
+  [54] = 54,
   [55] = 55,
   [56] = 56,
   [57] = 57,
   [58] = 58,
-  [59] = 53,
+  [59] = 59,
   [60] = 60,
   [61] = 61,
   [62] = 62,
@@ -939,19 +944,19 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [78] = 78,
   [79] = 79,
   [80] = 80,
-  [81] = 72,
+  [81] = 81,
   [82] = 82,
   [83] = 83,
-  [84] = 75,
-  [85] = 78,
+  [84] = 84,
+  [85] = 85,
   [86] = 86,
-  [87] = 79,
-  [88] = 80,
-  [89] = 68,
-  [90] = 74,
-  [91] = 77,
-  [92] = 76,
-  [93] = 73,
+  [87] = 87,
+  [88] = 88,
+  [89] = 89,
+  [90] = 90,
+  [91] = 91,
+  [92] = 92,
+  [93] = 93,
   [94] = 94,
   [95] = 95,
   [96] = 96,
@@ -989,12 +994,12 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [128] = 128,
   [129] = 129,
   [130] = 130,
-  [131] = 77,
+  [131] = 131,
   [132] = 132,
   [133] = 133,
   [134] = 134,
   [135] = 135,
-  [136] = 74,
+  [136] = 136,
   [137] = 137,
   [138] = 138,
   [139] = 139,
@@ -1008,15 +1013,15 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [147] = 147,
   [148] = 148,
   [149] = 149,
-  [150] = 73,
+  [150] = 150,
   [151] = 151,
-  [152] = 75,
-  [153] = 76,
-  [154] = 72,
-  [155] = 78,
-  [156] = 79,
-  [157] = 80,
-  [158] = 68,
+  [152] = 152,
+  [153] = 153,
+  [154] = 154,
+  [155] = 155,
+  [156] = 156,
+  [157] = 157,
+  [158] = 158,
   [159] = 159,
   [160] = 160,
   [161] = 161,
@@ -1034,9 +1039,9 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [173] = 173,
   [174] = 174,
   [175] = 175,
-  [176] = 175,
+  [176] = 176,
   [177] = 177,
-  [178] = 175,
+  [178] = 178,
   [179] = 179,
   [180] = 180,
   [181] = 181,
@@ -1045,36 +1050,6 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [184] = 184,
   [185] = 185,
   [186] = 186,
-  [187] = 187,
-  [188] = 187,
-  [189] = 183,
-  [190] = 190,
-  [191] = 185,
-  [192] = 192,
-  [193] = 193,
-  [194] = 194,
-  [195] = 195,
-  [196] = 196,
-  [197] = 197,
-  [198] = 190,
-  [199] = 199,
-  [200] = 190,
-  [201] = 195,
-  [202] = 202,
-  [203] = 203,
-  [204] = 195,
-  [205] = 186,
-  [206] = 182,
-  [207] = 185,
-  [208] = 208,
-  [209] = 209,
-  [210] = 186,
-  [211] = 187,
-  [212] = 182,
-  [213] = 194,
-  [214] = 214,
-  [215] = 183,
-  [216] = 194,
 };
 
 static bool ts_lex(TSLexer *lexer, TSStateId state) {
@@ -1082,1381 +1057,813 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
   eof = lexer->eof(lexer);
   switch (state) {
     case 0:
-      if (eof) ADVANCE(95);
+      if (eof) ADVANCE(27);
       ADVANCE_MAP(
-        '!', 166,
-        '"', 6,
-        '%', 164,
-        '&', 151,
-        '\'', 93,
-        '(', 120,
-        ')', 121,
-        '*', 162,
-        '+', 160,
-        ',', 117,
-        '-', 161,
-        '/', 163,
-        '0', 238,
-        ':', 123,
-        ';', 125,
-        '<', 154,
-        '=', 152,
-        '>', 155,
-        '[', 116,
-        ']', 118,
-        '^', 150,
-        'a', 59,
-        'b', 25,
-        'c', 46,
-        'd', 66,
-        'e', 53,
-        'f', 15,
-        'i', 36,
-        'l', 67,
-        'm', 34,
-        'n', 70,
-        'o', 37,
-        'r', 26,
-        's', 84,
-        't', 44,
-        'u', 47,
-        'v', 18,
-        'w', 42,
-        '{', 90,
-        '|', 149,
-        '~', 169,
+        '!', 28,
+        '%', 29,
+        '&', 30,
+        '\'', 31,
+        '(', 32,
+        ')', 33,
+        '*', 34,
+        '+', 35,
+        ',', 36,
+        '-', 37,
+        '/', 38,
+        '0', 39,
+        ':', 41,
+        ';', 42,
+        '<', 43,
+        '=', 44,
+        '>', 45,
+        '[', 47,
+        ']', 48,
+        '^', 49,
+        '|', 50,
+        '~', 51,
       );
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(0);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(239);
+      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(40);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 1:
-      ADVANCE_MAP(
-        '!', 165,
-        '"', 6,
-        '\'', 93,
-        '(', 120,
-        ')', 121,
-        ',', 117,
-        '-', 161,
-        '/', 9,
-        '0', 238,
-        ':', 122,
-        ';', 125,
-        'b', 178,
-        'e', 204,
-        'f', 171,
-        'i', 188,
-        'n', 211,
-        'r', 180,
-        't', 217,
-        'w', 193,
-        '{', 90,
-        '~', 169,
-      );
+      if (eof) ADVANCE(27);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(1);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(239);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 2:
-      ADVANCE_MAP(
-        '!', 165,
-        '"', 6,
-        '\'', 93,
-        '(', 120,
-        ')', 121,
-        '-', 161,
-        '/', 9,
-        '0', 238,
-        ']', 118,
-        'f', 171,
-        'n', 211,
-        't', 217,
-        '{', 90,
-        '~', 169,
-      );
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(2);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(239);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 3:
-      ADVANCE_MAP(
-        '!', 165,
-        '"', 6,
-        '\'', 93,
-        '(', 120,
-        '-', 161,
-        '/', 9,
-        '0', 238,
-        'b', 178,
-        'e', 203,
-        'f', 171,
-        'i', 188,
-        'n', 211,
-        'r', 180,
-        't', 217,
-        'w', 193,
-        '{', 90,
-        '~', 169,
-      );
+      if (eof) ADVANCE(27);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(3);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(239);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
       END_STATE();
     case 4:
-      ADVANCE_MAP(
-        '!', 165,
-        '"', 6,
-        '\'', 93,
-        '(', 120,
-        '-', 161,
-        '/', 9,
-        '0', 238,
-        'b', 178,
-        'f', 171,
-        'i', 188,
-        'n', 211,
-        'r', 180,
-        't', 217,
-        'w', 193,
-        '{', 90,
-        '~', 169,
-      );
+      if (lookahead == '(') ADVANCE(32);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(4);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(239);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
       END_STATE();
     case 5:
-      ADVANCE_MAP(
-        '!', 13,
-        '%', 164,
-        '&', 151,
-        '(', 120,
-        ')', 121,
-        '*', 162,
-        '+', 160,
-        ',', 117,
-        '-', 161,
-        '/', 163,
-        ':', 14,
-        ';', 125,
-        '<', 154,
-        '=', 152,
-        '>', 155,
-        '[', 116,
-        ']', 118,
-        '^', 150,
-        'a', 58,
-        'd', 66,
-        'o', 73,
-        't', 43,
-        '{', 90,
-        '|', 149,
-      );
+      if (lookahead == ';') ADVANCE(42);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(5);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 6:
-      if (lookahead == '"') ADVANCE(234);
-      if (lookahead == '\\') ADVANCE(94);
-      if (lookahead != 0) ADVANCE(6);
+      if (lookahead == ')') ADVANCE(33);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(6);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 7:
-      if (lookahead == '\'') ADVANCE(235);
+      if (lookahead == '!') ADVANCE(52);
+      if (lookahead == '\'') ADVANCE(31);
+      if (lookahead == '(') ADVANCE(32);
+      if (lookahead == '-') ADVANCE(37);
+      if (lookahead == '0') ADVANCE(39);
+      if (lookahead == '~') ADVANCE(51);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(7);
+      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(40);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 8:
-      if (lookahead == ')') ADVANCE(121);
-      if (lookahead == '/') ADVANCE(9);
-      if (lookahead == '{') ADVANCE(90);
+      if (lookahead == ':') ADVANCE(53);
+      if (lookahead == ';') ADVANCE(42);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(8);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 9:
-      if (lookahead == '/') ADVANCE(97);
+      if (lookahead == ')') ADVANCE(33);
+      if (lookahead == ',') ADVANCE(36);
+      if (lookahead == ':') ADVANCE(53);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(9);
       END_STATE();
     case 10:
-      if (lookahead == '/') ADVANCE(9);
-      if (lookahead == ':') ADVANCE(122);
-      if (lookahead == ';') ADVANCE(125);
-      if (lookahead == 'b') ADVANCE(24);
-      if (lookahead == 'v') ADVANCE(18);
-      if (lookahead == '{') ADVANCE(90);
+      if (lookahead == ')') ADVANCE(33);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(10);
       END_STATE();
     case 11:
-      ADVANCE_MAP(
-        '/', 9,
-        'a', 220,
-        'b', 212,
-        'c', 194,
-        'i', 209,
-        'l', 214,
-        's', 229,
-        'u', 198,
-        '{', 90,
-      );
+      if (lookahead == ')') ADVANCE(33);
+      if (lookahead == ',') ADVANCE(36);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(11);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('d' <= lookahead && lookahead <= 'z')) ADVANCE(233);
       END_STATE();
     case 12:
-      if (lookahead == '/') ADVANCE(9);
-      if (lookahead == 'b') ADVANCE(179);
-      if (lookahead == 'v') ADVANCE(176);
-      if (lookahead == '{') ADVANCE(90);
+      if (lookahead == ',') ADVANCE(36);
+      if (lookahead == ':') ADVANCE(53);
+      if (lookahead == ';') ADVANCE(42);
       if (('\t' <= lookahead && lookahead <= '\r') ||
           lookahead == ' ') SKIP(12);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
       END_STATE();
     case 13:
-      if (lookahead == '=') ADVANCE(153);
+      if (lookahead == ':') ADVANCE(53);
+      if (lookahead == ';') ADVANCE(42);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(13);
       END_STATE();
     case 14:
-      if (lookahead == '=') ADVANCE(170);
+      if (lookahead == ';') ADVANCE(42);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(14);
       END_STATE();
     case 15:
-      if (lookahead == 'a') ADVANCE(57);
+      ADVANCE_MAP(
+        '!', 54,
+        '%', 29,
+        '&', 30,
+        '(', 32,
+        ')', 33,
+        '*', 34,
+        '+', 35,
+        ',', 36,
+        '-', 37,
+        '/', 38,
+        ':', 55,
+        ';', 42,
+        '<', 43,
+        '=', 44,
+        '>', 45,
+        '[', 47,
+        ']', 48,
+        '^', 49,
+        '|', 50,
+      );
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(15);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 16:
-      if (lookahead == 'a') ADVANCE(89);
+      ADVANCE_MAP(
+        '!', 54,
+        '%', 29,
+        '&', 30,
+        ')', 33,
+        '*', 34,
+        '+', 35,
+        ',', 36,
+        '-', 37,
+        '/', 38,
+        ';', 42,
+        '<', 43,
+        '=', 44,
+        '>', 45,
+        ']', 48,
+        '^', 49,
+        '|', 50,
+      );
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(16);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 17:
-      if (lookahead == 'a') ADVANCE(52);
+      ADVANCE_MAP(
+        '!', 54,
+        '%', 29,
+        '&', 30,
+        '(', 32,
+        '*', 34,
+        '+', 35,
+        '-', 37,
+        '/', 38,
+        ':', 55,
+        ';', 42,
+        '<', 43,
+        '=', 44,
+        '>', 45,
+        '[', 47,
+        '^', 49,
+        '|', 50,
+      );
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(17);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 18:
-      if (lookahead == 'a') ADVANCE(74);
+      ADVANCE_MAP(
+        '!', 54,
+        '%', 29,
+        '&', 30,
+        '(', 32,
+        ')', 33,
+        '*', 34,
+        '+', 35,
+        ',', 36,
+        '-', 37,
+        '/', 38,
+        ';', 42,
+        '<', 43,
+        '=', 44,
+        '>', 45,
+        '[', 47,
+        ']', 48,
+        '^', 49,
+        '|', 50,
+      );
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(18);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 19:
-      if (lookahead == 'a') ADVANCE(75);
+      if (eof) ADVANCE(27);
+      if (lookahead == '!') ADVANCE(52);
+      if (lookahead == '\'') ADVANCE(31);
+      if (lookahead == '(') ADVANCE(32);
+      if (lookahead == '-') ADVANCE(37);
+      if (lookahead == '0') ADVANCE(39);
+      if (lookahead == '~') ADVANCE(51);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(19);
+      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(40);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 20:
-      if (lookahead == 'a') ADVANCE(83);
+      if (lookahead == '!') ADVANCE(52);
+      if (lookahead == '\'') ADVANCE(31);
+      if (lookahead == '(') ADVANCE(32);
+      if (lookahead == '-') ADVANCE(37);
+      if (lookahead == '0') ADVANCE(39);
+      if (lookahead == ']') ADVANCE(48);
+      if (lookahead == '~') ADVANCE(51);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(20);
+      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(40);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 21:
-      if (lookahead == 'd') ADVANCE(148);
+      if (lookahead == '!') ADVANCE(52);
+      if (lookahead == '\'') ADVANCE(31);
+      if (lookahead == '(') ADVANCE(32);
+      if (lookahead == ')') ADVANCE(33);
+      if (lookahead == '-') ADVANCE(37);
+      if (lookahead == '0') ADVANCE(39);
+      if (lookahead == '~') ADVANCE(51);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(21);
+      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(40);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 22:
-      if (lookahead == 'd') ADVANCE(135);
+      if (lookahead == ')') ADVANCE(33);
+      if (lookahead == ',') ADVANCE(36);
+      if (lookahead == ';') ADVANCE(42);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(22);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 23:
-      if (lookahead == 'd') ADVANCE(124);
+      if (lookahead == '[') ADVANCE(47);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(23);
       END_STATE();
     case 24:
-      if (lookahead == 'e') ADVANCE(41);
+      if (lookahead == ')') ADVANCE(33);
+      if (lookahead == ',') ADVANCE(36);
+      if (lookahead == ']') ADVANCE(48);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(24);
       END_STATE();
     case 25:
-      if (lookahead == 'e') ADVANCE(41);
-      if (lookahead == 'o') ADVANCE(68);
-      if (lookahead == 'r') ADVANCE(33);
-      if (lookahead == 'y') ADVANCE(86);
+      if (lookahead == ']') ADVANCE(48);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(25);
       END_STATE();
     case 26:
-      if (lookahead == 'e') ADVANCE(72);
+      if (lookahead == ',') ADVANCE(36);
+      if (lookahead == ']') ADVANCE(48);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(26);
       END_STATE();
     case 27:
-      if (lookahead == 'e') ADVANCE(100);
+      ACCEPT_TOKEN(ts_builtin_sym_end);
       END_STATE();
     case 28:
-      if (lookahead == 'e') ADVANCE(131);
+      ACCEPT_TOKEN(anon_sym_BANG);
+      if (lookahead == '=') ADVANCE(56);
       END_STATE();
     case 29:
-      if (lookahead == 'e') ADVANCE(240);
+      ACCEPT_TOKEN(anon_sym_PERCENT);
       END_STATE();
     case 30:
-      if (lookahead == 'e') ADVANCE(242);
+      ACCEPT_TOKEN(anon_sym_AMP);
+      if (lookahead == '&') ADVANCE(57);
       END_STATE();
     case 31:
-      if (lookahead == 'e') ADVANCE(137);
+      if (lookahead != 0 &&
+          lookahead != '\'' &&
+          lookahead != '\\') ADVANCE(58);
       END_STATE();
     case 32:
-      if (lookahead == 'e') ADVANCE(60);
+      ACCEPT_TOKEN(anon_sym_LPAREN);
       END_STATE();
     case 33:
-      if (lookahead == 'e') ADVANCE(17);
+      ACCEPT_TOKEN(anon_sym_RPAREN);
       END_STATE();
     case 34:
-      if (lookahead == 'e') ADVANCE(85);
+      ACCEPT_TOKEN(anon_sym_STAR);
       END_STATE();
     case 35:
-      if (lookahead == 'e') ADVANCE(20);
+      ACCEPT_TOKEN(anon_sym_PLUS);
       END_STATE();
     case 36:
-      if (lookahead == 'f') ADVANCE(128);
-      if (lookahead == 'n') ADVANCE(80);
+      ACCEPT_TOKEN(anon_sym_COMMA);
       END_STATE();
     case 37:
-      if (lookahead == 'f') ADVANCE(119);
-      if (lookahead == 'r') ADVANCE(146);
+      ACCEPT_TOKEN(anon_sym_DASH);
       END_STATE();
     case 38:
-      if (lookahead == 'g') ADVANCE(106);
+      ACCEPT_TOKEN(anon_sym_SLASH);
       END_STATE();
     case 39:
-      if (lookahead == 'g') ADVANCE(108);
+      ACCEPT_TOKEN(sym_dec);
+      if (lookahead == 'B') ADVANCE(59);
+      if (lookahead == 'X') ADVANCE(60);
+      if (lookahead == 'b') ADVANCE(59);
+      if (lookahead == 'x') ADVANCE(60);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(40);
       END_STATE();
     case 40:
-      if (lookahead == 'g') ADVANCE(112);
+      ACCEPT_TOKEN(sym_dec);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(40);
       END_STATE();
     case 41:
-      if (lookahead == 'g') ADVANCE(50);
+      ACCEPT_TOKEN(anon_sym_COLON);
+      if (lookahead == '=') ADVANCE(61);
       END_STATE();
     case 42:
-      if (lookahead == 'h') ADVANCE(48);
+      ACCEPT_TOKEN(anon_sym_SEMI);
       END_STATE();
     case 43:
-      if (lookahead == 'h') ADVANCE(32);
+      ACCEPT_TOKEN(anon_sym_LT);
+      if (lookahead == '<') ADVANCE(62);
+      if (lookahead == '=') ADVANCE(63);
       END_STATE();
     case 44:
-      if (lookahead == 'h') ADVANCE(32);
-      if (lookahead == 'r') ADVANCE(88);
+      ACCEPT_TOKEN(anon_sym_EQ);
       END_STATE();
     case 45:
-      if (lookahead == 'h') ADVANCE(69);
+      ACCEPT_TOKEN(anon_sym_GT);
+      if (lookahead == '=') ADVANCE(64);
+      if (lookahead == '>') ADVANCE(65);
       END_STATE();
     case 46:
-      if (lookahead == 'h') ADVANCE(19);
+      ACCEPT_TOKEN(sym_identifier);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(46);
       END_STATE();
     case 47:
-      if (lookahead == 'i') ADVANCE(65);
-      if (lookahead == 'l') ADVANCE(71);
-      if (lookahead == 'n') ADVANCE(87);
+      ACCEPT_TOKEN(anon_sym_LBRACK);
       END_STATE();
     case 48:
-      if (lookahead == 'i') ADVANCE(56);
+      ACCEPT_TOKEN(anon_sym_RBRACK);
       END_STATE();
     case 49:
-      if (lookahead == 'i') ADVANCE(55);
+      ACCEPT_TOKEN(anon_sym_CARET);
       END_STATE();
     case 50:
-      if (lookahead == 'i') ADVANCE(61);
+      ACCEPT_TOKEN(anon_sym_PIPE);
+      if (lookahead == '|') ADVANCE(66);
       END_STATE();
     case 51:
-      if (lookahead == 'i') ADVANCE(64);
+      ACCEPT_TOKEN(anon_sym_TILDE);
       END_STATE();
     case 52:
-      if (lookahead == 'k') ADVANCE(143);
+      ACCEPT_TOKEN(anon_sym_BANG);
       END_STATE();
     case 53:
-      if (lookahead == 'l') ADVANCE(78);
-      if (lookahead == 'n') ADVANCE(22);
+      ACCEPT_TOKEN(anon_sym_COLON);
       END_STATE();
     case 54:
-      if (lookahead == 'l') ADVANCE(98);
+      if (lookahead == '=') ADVANCE(56);
       END_STATE();
     case 55:
-      if (lookahead == 'l') ADVANCE(142);
+      if (lookahead == '=') ADVANCE(61);
       END_STATE();
     case 56:
-      if (lookahead == 'l') ADVANCE(31);
+      ACCEPT_TOKEN(anon_sym_BANG_EQ);
       END_STATE();
     case 57:
-      if (lookahead == 'l') ADVANCE(79);
+      ACCEPT_TOKEN(anon_sym_AMP_AMP);
       END_STATE();
     case 58:
-      if (lookahead == 'n') ADVANCE(21);
+      if (lookahead == '\'') ADVANCE(67);
       END_STATE();
     case 59:
-      if (lookahead == 'n') ADVANCE(21);
-      if (lookahead == 'r') ADVANCE(76);
+      if (lookahead == '0' ||
+          lookahead == '1') ADVANCE(68);
       END_STATE();
     case 60:
-      if (lookahead == 'n') ADVANCE(130);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(69);
       END_STATE();
     case 61:
-      if (lookahead == 'n') ADVANCE(133);
+      ACCEPT_TOKEN(anon_sym_COLON_EQ);
       END_STATE();
     case 62:
-      if (lookahead == 'n') ADVANCE(38);
+      ACCEPT_TOKEN(anon_sym_LT_LT);
       END_STATE();
     case 63:
-      if (lookahead == 'n') ADVANCE(39);
+      ACCEPT_TOKEN(anon_sym_LT_EQ);
       END_STATE();
     case 64:
-      if (lookahead == 'n') ADVANCE(40);
+      ACCEPT_TOKEN(anon_sym_GT_EQ);
       END_STATE();
     case 65:
-      if (lookahead == 'n') ADVANCE(82);
+      ACCEPT_TOKEN(anon_sym_GT_GT);
       END_STATE();
     case 66:
-      if (lookahead == 'o') ADVANCE(139);
+      ACCEPT_TOKEN(anon_sym_PIPE_PIPE);
       END_STATE();
     case 67:
-      if (lookahead == 'o') ADVANCE(62);
+      ACCEPT_TOKEN(sym_char);
       END_STATE();
     case 68:
-      if (lookahead == 'o') ADVANCE(54);
+      ACCEPT_TOKEN(sym_bits);
+      if (lookahead == '0' ||
+          lookahead == '1') ADVANCE(68);
       END_STATE();
     case 69:
-      if (lookahead == 'o') ADVANCE(23);
+      ACCEPT_TOKEN(sym_hex);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(69);
       END_STATE();
-    case 70:
-      if (lookahead == 'o') ADVANCE(81);
+    default:
+      return false;
+  }
+}
+
+static bool ts_lex_keywords(TSLexer *lexer, TSStateId state) {
+  START_LEXER();
+  eof = lexer->eof(lexer);
+  switch (state) {
+    case 0:
+      ADVANCE_MAP(
+        'a', 1,
+        'b', 2,
+        'c', 3,
+        'd', 4,
+        'e', 5,
+        'f', 6,
+        'i', 7,
+        'l', 8,
+        'm', 9,
+        'n', 10,
+        'o', 11,
+        'r', 12,
+        's', 13,
+        't', 14,
+        'u', 15,
+        'v', 16,
+        'w', 17,
+      );
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(0);
       END_STATE();
-    case 71:
-      if (lookahead == 'o') ADVANCE(63);
+    case 1:
+      if (lookahead == 'n') ADVANCE(18);
+      if (lookahead == 'r') ADVANCE(19);
       END_STATE();
-    case 72:
-      if (lookahead == 'p') ADVANCE(35);
+    case 2:
+      if (lookahead == 'e') ADVANCE(20);
+      if (lookahead == 'o') ADVANCE(21);
+      if (lookahead == 'r') ADVANCE(22);
+      if (lookahead == 'y') ADVANCE(23);
       END_STATE();
-    case 73:
-      if (lookahead == 'r') ADVANCE(146);
+    case 3:
+      if (lookahead == 'h') ADVANCE(24);
       END_STATE();
-    case 74:
-      if (lookahead == 'r') ADVANCE(126);
+    case 4:
+      if (lookahead == 'o') ADVANCE(25);
       END_STATE();
-    case 75:
-      if (lookahead == 'r') ADVANCE(110);
+    case 5:
+      if (lookahead == 'l') ADVANCE(26);
+      if (lookahead == 'n') ADVANCE(27);
       END_STATE();
-    case 76:
-      if (lookahead == 'r') ADVANCE(16);
+    case 6:
+      if (lookahead == 'a') ADVANCE(28);
       END_STATE();
-    case 77:
-      if (lookahead == 'r') ADVANCE(51);
+    case 7:
+      if (lookahead == 'f') ADVANCE(29);
+      if (lookahead == 'n') ADVANCE(30);
       END_STATE();
-    case 78:
-      if (lookahead == 's') ADVANCE(28);
+    case 8:
+      if (lookahead == 'o') ADVANCE(31);
       END_STATE();
-    case 79:
-      if (lookahead == 's') ADVANCE(30);
+    case 9:
+      if (lookahead == 'e') ADVANCE(32);
       END_STATE();
-    case 80:
-      if (lookahead == 't') ADVANCE(102);
+    case 10:
+      if (lookahead == 'o') ADVANCE(33);
       END_STATE();
-    case 81:
-      if (lookahead == 't') ADVANCE(167);
+    case 11:
+      if (lookahead == 'f') ADVANCE(34);
+      if (lookahead == 'r') ADVANCE(35);
       END_STATE();
-    case 82:
-      if (lookahead == 't') ADVANCE(104);
+    case 12:
+      if (lookahead == 'e') ADVANCE(36);
       END_STATE();
-    case 83:
-      if (lookahead == 't') ADVANCE(140);
+    case 13:
+      if (lookahead == 't') ADVANCE(37);
       END_STATE();
-    case 84:
-      if (lookahead == 't') ADVANCE(77);
+    case 14:
+      if (lookahead == 'h') ADVANCE(38);
+      if (lookahead == 'r') ADVANCE(39);
       END_STATE();
-    case 85:
-      if (lookahead == 't') ADVANCE(45);
+    case 15:
+      if (lookahead == 'i') ADVANCE(40);
+      if (lookahead == 'l') ADVANCE(41);
+      if (lookahead == 'n') ADVANCE(42);
       END_STATE();
-    case 86:
-      if (lookahead == 't') ADVANCE(27);
+    case 16:
+      if (lookahead == 'a') ADVANCE(43);
       END_STATE();
-    case 87:
-      if (lookahead == 't') ADVANCE(49);
+    case 17:
+      if (lookahead == 'h') ADVANCE(44);
       END_STATE();
-    case 88:
-      if (lookahead == 'u') ADVANCE(29);
+    case 18:
+      if (lookahead == 'd') ADVANCE(45);
       END_STATE();
-    case 89:
-      if (lookahead == 'y') ADVANCE(114);
+    case 19:
+      if (lookahead == 'r') ADVANCE(46);
       END_STATE();
-    case 90:
-      if (lookahead == '}') ADVANCE(96);
-      if (lookahead != 0) ADVANCE(90);
+    case 20:
+      if (lookahead == 'g') ADVANCE(47);
       END_STATE();
-    case 91:
-      if (lookahead == '0' ||
-          lookahead == '1') ADVANCE(237);
+    case 21:
+      if (lookahead == 'o') ADVANCE(48);
       END_STATE();
-    case 92:
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(236);
+    case 22:
+      if (lookahead == 'e') ADVANCE(49);
       END_STATE();
-    case 93:
-      if (lookahead != 0 &&
-          lookahead != '\'' &&
-          lookahead != '\\') ADVANCE(7);
+    case 23:
+      if (lookahead == 't') ADVANCE(50);
       END_STATE();
-    case 94:
-      if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(6);
+    case 24:
+      if (lookahead == 'a') ADVANCE(51);
       END_STATE();
-    case 95:
-      ACCEPT_TOKEN(ts_builtin_sym_end);
+    case 25:
+      ACCEPT_TOKEN(anon_sym_do);
       END_STATE();
-    case 96:
-      ACCEPT_TOKEN(sym_comment);
+    case 26:
+      if (lookahead == 's') ADVANCE(52);
       END_STATE();
-    case 97:
-      ACCEPT_TOKEN(sym_comment);
-      if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(97);
+    case 27:
+      if (lookahead == 'd') ADVANCE(53);
       END_STATE();
-    case 98:
-      ACCEPT_TOKEN(anon_sym_bool);
+    case 28:
+      if (lookahead == 'l') ADVANCE(54);
       END_STATE();
-    case 99:
-      ACCEPT_TOKEN(anon_sym_bool);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 29:
+      ACCEPT_TOKEN(anon_sym_if);
       END_STATE();
-    case 100:
-      ACCEPT_TOKEN(anon_sym_byte);
+    case 30:
+      if (lookahead == 't') ADVANCE(55);
       END_STATE();
-    case 101:
-      ACCEPT_TOKEN(anon_sym_byte);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 31:
+      if (lookahead == 'n') ADVANCE(56);
       END_STATE();
-    case 102:
-      ACCEPT_TOKEN(anon_sym_int);
+    case 32:
+      if (lookahead == 't') ADVANCE(57);
       END_STATE();
-    case 103:
-      ACCEPT_TOKEN(anon_sym_int);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 33:
+      if (lookahead == 't') ADVANCE(58);
       END_STATE();
-    case 104:
-      ACCEPT_TOKEN(anon_sym_uint);
+    case 34:
+      ACCEPT_TOKEN(anon_sym_of);
       END_STATE();
-    case 105:
-      ACCEPT_TOKEN(anon_sym_uint);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 35:
+      ACCEPT_TOKEN(anon_sym_or);
       END_STATE();
-    case 106:
-      ACCEPT_TOKEN(anon_sym_long);
+    case 36:
+      if (lookahead == 'p') ADVANCE(59);
       END_STATE();
-    case 107:
-      ACCEPT_TOKEN(anon_sym_long);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 37:
+      if (lookahead == 'r') ADVANCE(60);
       END_STATE();
-    case 108:
-      ACCEPT_TOKEN(anon_sym_ulong);
+    case 38:
+      if (lookahead == 'e') ADVANCE(61);
       END_STATE();
-    case 109:
-      ACCEPT_TOKEN(anon_sym_ulong);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 39:
+      if (lookahead == 'u') ADVANCE(62);
       END_STATE();
-    case 110:
-      ACCEPT_TOKEN(anon_sym_char);
+    case 40:
+      if (lookahead == 'n') ADVANCE(63);
       END_STATE();
-    case 111:
-      ACCEPT_TOKEN(anon_sym_char);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 41:
+      if (lookahead == 'o') ADVANCE(64);
       END_STATE();
-    case 112:
-      ACCEPT_TOKEN(anon_sym_string);
+    case 42:
+      if (lookahead == 't') ADVANCE(65);
       END_STATE();
-    case 113:
-      ACCEPT_TOKEN(anon_sym_string);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 43:
+      if (lookahead == 'r') ADVANCE(66);
       END_STATE();
-    case 114:
-      ACCEPT_TOKEN(anon_sym_array);
+    case 44:
+      if (lookahead == 'i') ADVANCE(67);
       END_STATE();
-    case 115:
-      ACCEPT_TOKEN(anon_sym_array);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 45:
+      ACCEPT_TOKEN(anon_sym_and);
       END_STATE();
-    case 116:
-      ACCEPT_TOKEN(anon_sym_LBRACK);
+    case 46:
+      if (lookahead == 'a') ADVANCE(68);
       END_STATE();
-    case 117:
-      ACCEPT_TOKEN(anon_sym_COMMA);
+    case 47:
+      if (lookahead == 'i') ADVANCE(69);
       END_STATE();
-    case 118:
-      ACCEPT_TOKEN(anon_sym_RBRACK);
+    case 48:
+      if (lookahead == 'l') ADVANCE(70);
       END_STATE();
-    case 119:
-      ACCEPT_TOKEN(anon_sym_of);
+    case 49:
+      if (lookahead == 'a') ADVANCE(71);
       END_STATE();
-    case 120:
-      ACCEPT_TOKEN(anon_sym_LPAREN);
+    case 50:
+      if (lookahead == 'e') ADVANCE(72);
       END_STATE();
-    case 121:
-      ACCEPT_TOKEN(anon_sym_RPAREN);
+    case 51:
+      if (lookahead == 'r') ADVANCE(73);
       END_STATE();
-    case 122:
-      ACCEPT_TOKEN(anon_sym_COLON);
+    case 52:
+      if (lookahead == 'e') ADVANCE(74);
       END_STATE();
-    case 123:
-      ACCEPT_TOKEN(anon_sym_COLON);
-      if (lookahead == '=') ADVANCE(170);
+    case 53:
+      ACCEPT_TOKEN(anon_sym_end);
       END_STATE();
-    case 124:
-      ACCEPT_TOKEN(anon_sym_method);
+    case 54:
+      if (lookahead == 's') ADVANCE(75);
       END_STATE();
-    case 125:
-      ACCEPT_TOKEN(anon_sym_SEMI);
+    case 55:
+      ACCEPT_TOKEN(anon_sym_int);
       END_STATE();
-    case 126:
-      ACCEPT_TOKEN(anon_sym_var);
+    case 56:
+      if (lookahead == 'g') ADVANCE(76);
       END_STATE();
-    case 127:
-      ACCEPT_TOKEN(anon_sym_var);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 57:
+      if (lookahead == 'h') ADVANCE(77);
       END_STATE();
-    case 128:
-      ACCEPT_TOKEN(anon_sym_if);
+    case 58:
+      ACCEPT_TOKEN(anon_sym_not);
       END_STATE();
-    case 129:
-      ACCEPT_TOKEN(anon_sym_if);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 59:
+      if (lookahead == 'e') ADVANCE(78);
       END_STATE();
-    case 130:
-      ACCEPT_TOKEN(anon_sym_then);
+    case 60:
+      if (lookahead == 'i') ADVANCE(79);
       END_STATE();
-    case 131:
-      ACCEPT_TOKEN(anon_sym_else);
+    case 61:
+      if (lookahead == 'n') ADVANCE(80);
       END_STATE();
-    case 132:
-      ACCEPT_TOKEN(anon_sym_else);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 62:
+      if (lookahead == 'e') ADVANCE(81);
       END_STATE();
-    case 133:
-      ACCEPT_TOKEN(anon_sym_begin);
+    case 63:
+      if (lookahead == 't') ADVANCE(82);
       END_STATE();
-    case 134:
-      ACCEPT_TOKEN(anon_sym_begin);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 64:
+      if (lookahead == 'n') ADVANCE(83);
       END_STATE();
-    case 135:
-      ACCEPT_TOKEN(anon_sym_end);
+    case 65:
+      if (lookahead == 'i') ADVANCE(84);
       END_STATE();
-    case 136:
-      ACCEPT_TOKEN(anon_sym_end);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 66:
+      ACCEPT_TOKEN(anon_sym_var);
       END_STATE();
-    case 137:
-      ACCEPT_TOKEN(anon_sym_while);
+    case 67:
+      if (lookahead == 'l') ADVANCE(85);
       END_STATE();
-    case 138:
-      ACCEPT_TOKEN(anon_sym_while);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 68:
+      if (lookahead == 'y') ADVANCE(86);
       END_STATE();
-    case 139:
-      ACCEPT_TOKEN(anon_sym_do);
+    case 69:
+      if (lookahead == 'n') ADVANCE(87);
       END_STATE();
-    case 140:
-      ACCEPT_TOKEN(anon_sym_repeat);
+    case 70:
+      ACCEPT_TOKEN(anon_sym_bool);
       END_STATE();
-    case 141:
-      ACCEPT_TOKEN(anon_sym_repeat);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 71:
+      if (lookahead == 'k') ADVANCE(88);
       END_STATE();
-    case 142:
-      ACCEPT_TOKEN(anon_sym_until);
+    case 72:
+      ACCEPT_TOKEN(anon_sym_byte);
       END_STATE();
-    case 143:
-      ACCEPT_TOKEN(anon_sym_break);
+    case 73:
+      ACCEPT_TOKEN(anon_sym_char);
       END_STATE();
-    case 144:
-      ACCEPT_TOKEN(anon_sym_break);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 74:
+      ACCEPT_TOKEN(anon_sym_else);
       END_STATE();
-    case 145:
-      ACCEPT_TOKEN(anon_sym_PIPE_PIPE);
+    case 75:
+      if (lookahead == 'e') ADVANCE(89);
       END_STATE();
-    case 146:
-      ACCEPT_TOKEN(anon_sym_or);
+    case 76:
+      ACCEPT_TOKEN(anon_sym_long);
       END_STATE();
-    case 147:
-      ACCEPT_TOKEN(anon_sym_AMP_AMP);
+    case 77:
+      if (lookahead == 'o') ADVANCE(90);
       END_STATE();
-    case 148:
-      ACCEPT_TOKEN(anon_sym_and);
+    case 78:
+      if (lookahead == 'a') ADVANCE(91);
       END_STATE();
-    case 149:
-      ACCEPT_TOKEN(anon_sym_PIPE);
-      if (lookahead == '|') ADVANCE(145);
+    case 79:
+      if (lookahead == 'n') ADVANCE(92);
       END_STATE();
-    case 150:
-      ACCEPT_TOKEN(anon_sym_CARET);
+    case 80:
+      ACCEPT_TOKEN(anon_sym_then);
       END_STATE();
-    case 151:
-      ACCEPT_TOKEN(anon_sym_AMP);
-      if (lookahead == '&') ADVANCE(147);
+    case 81:
+      ACCEPT_TOKEN(anon_sym_true);
       END_STATE();
-    case 152:
-      ACCEPT_TOKEN(anon_sym_EQ);
+    case 82:
+      ACCEPT_TOKEN(anon_sym_uint);
       END_STATE();
-    case 153:
-      ACCEPT_TOKEN(anon_sym_BANG_EQ);
+    case 83:
+      if (lookahead == 'g') ADVANCE(93);
       END_STATE();
-    case 154:
-      ACCEPT_TOKEN(anon_sym_LT);
-      if (lookahead == '<') ADVANCE(158);
-      if (lookahead == '=') ADVANCE(156);
+    case 84:
+      if (lookahead == 'l') ADVANCE(94);
       END_STATE();
-    case 155:
-      ACCEPT_TOKEN(anon_sym_GT);
-      if (lookahead == '=') ADVANCE(157);
-      if (lookahead == '>') ADVANCE(159);
+    case 85:
+      if (lookahead == 'e') ADVANCE(95);
       END_STATE();
-    case 156:
-      ACCEPT_TOKEN(anon_sym_LT_EQ);
+    case 86:
+      ACCEPT_TOKEN(anon_sym_array);
       END_STATE();
-    case 157:
-      ACCEPT_TOKEN(anon_sym_GT_EQ);
+    case 87:
+      ACCEPT_TOKEN(anon_sym_begin);
       END_STATE();
-    case 158:
-      ACCEPT_TOKEN(anon_sym_LT_LT);
+    case 88:
+      ACCEPT_TOKEN(anon_sym_break);
       END_STATE();
-    case 159:
-      ACCEPT_TOKEN(anon_sym_GT_GT);
+    case 89:
+      ACCEPT_TOKEN(anon_sym_false);
       END_STATE();
-    case 160:
-      ACCEPT_TOKEN(anon_sym_PLUS);
+    case 90:
+      if (lookahead == 'd') ADVANCE(96);
       END_STATE();
-    case 161:
-      ACCEPT_TOKEN(anon_sym_DASH);
+    case 91:
+      if (lookahead == 't') ADVANCE(97);
       END_STATE();
-    case 162:
-      ACCEPT_TOKEN(anon_sym_STAR);
+    case 92:
+      if (lookahead == 'g') ADVANCE(98);
       END_STATE();
-    case 163:
-      ACCEPT_TOKEN(anon_sym_SLASH);
-      if (lookahead == '/') ADVANCE(97);
+    case 93:
+      ACCEPT_TOKEN(anon_sym_ulong);
       END_STATE();
-    case 164:
-      ACCEPT_TOKEN(anon_sym_PERCENT);
+    case 94:
+      ACCEPT_TOKEN(anon_sym_until);
       END_STATE();
-    case 165:
-      ACCEPT_TOKEN(anon_sym_BANG);
+    case 95:
+      ACCEPT_TOKEN(anon_sym_while);
       END_STATE();
-    case 166:
-      ACCEPT_TOKEN(anon_sym_BANG);
-      if (lookahead == '=') ADVANCE(153);
+    case 96:
+      ACCEPT_TOKEN(anon_sym_method);
       END_STATE();
-    case 167:
-      ACCEPT_TOKEN(anon_sym_not);
+    case 97:
+      ACCEPT_TOKEN(anon_sym_repeat);
       END_STATE();
-    case 168:
-      ACCEPT_TOKEN(anon_sym_not);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 169:
-      ACCEPT_TOKEN(anon_sym_TILDE);
-      END_STATE();
-    case 170:
-      ACCEPT_TOKEN(anon_sym_COLON_EQ);
-      END_STATE();
-    case 171:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(200);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 172:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(199);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 173:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(232);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 174:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(226);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 175:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(218);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 176:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(219);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 177:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'd') ADVANCE(136);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 178:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(192);
-      if (lookahead == 'r') ADVANCE(186);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 179:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(192);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 180:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(216);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 181:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(241);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 182:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(243);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 183:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(138);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 184:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(132);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 185:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(101);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 186:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(172);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 187:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(174);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 188:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'f') ADVANCE(129);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 189:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'g') ADVANCE(107);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 190:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'g') ADVANCE(109);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 191:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'g') ADVANCE(113);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 192:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'g') ADVANCE(195);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 193:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'h') ADVANCE(196);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 194:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'h') ADVANCE(175);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 195:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(205);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 196:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(202);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 197:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(208);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 198:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(210);
-      if (lookahead == 'l') ADVANCE(215);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 199:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'k') ADVANCE(144);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 200:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(223);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 201:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(99);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 202:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(183);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 203:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(224);
-      if (lookahead == 'n') ADVANCE(177);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 204:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(177);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 205:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(134);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 206:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(189);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 207:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(190);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 208:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(191);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 209:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(227);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 210:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(228);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 211:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(225);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 212:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(213);
-      if (lookahead == 'y') ADVANCE(230);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 213:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(201);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 214:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(206);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 215:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(207);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 216:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'p') ADVANCE(187);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 217:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(231);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 218:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(111);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 219:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(127);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 220:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(222);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 221:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(197);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 222:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(173);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 223:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(182);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 224:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(184);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 225:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(168);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 226:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(141);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 227:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(103);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 228:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(105);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 229:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(221);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 230:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(185);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 231:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'u') ADVANCE(181);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 232:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'y') ADVANCE(115);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 233:
-      ACCEPT_TOKEN(sym_identifier);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 234:
-      ACCEPT_TOKEN(sym_str);
-      END_STATE();
-    case 235:
-      ACCEPT_TOKEN(sym_char);
-      END_STATE();
-    case 236:
-      ACCEPT_TOKEN(sym_hex);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(236);
-      END_STATE();
-    case 237:
-      ACCEPT_TOKEN(sym_bits);
-      if (lookahead == '0' ||
-          lookahead == '1') ADVANCE(237);
-      END_STATE();
-    case 238:
-      ACCEPT_TOKEN(sym_dec);
-      if (lookahead == 'B' ||
-          lookahead == 'b') ADVANCE(91);
-      if (lookahead == 'X' ||
-          lookahead == 'x') ADVANCE(92);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(239);
-      END_STATE();
-    case 239:
-      ACCEPT_TOKEN(sym_dec);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(239);
-      END_STATE();
-    case 240:
-      ACCEPT_TOKEN(anon_sym_true);
-      END_STATE();
-    case 241:
-      ACCEPT_TOKEN(anon_sym_true);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
-      END_STATE();
-    case 242:
-      ACCEPT_TOKEN(anon_sym_false);
-      END_STATE();
-    case 243:
-      ACCEPT_TOKEN(anon_sym_false);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(233);
+    case 98:
+      ACCEPT_TOKEN(anon_sym_string);
       END_STATE();
     default:
       return false;
@@ -2464,229 +1871,198 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
 }
 
 static const TSLexerMode ts_lex_modes[STATE_COUNT] = {
-  [0] = {.lex_state = 0},
-  [1] = {.lex_state = 0},
-  [2] = {.lex_state = 1},
-  [3] = {.lex_state = 1},
-  [4] = {.lex_state = 1},
-  [5] = {.lex_state = 1},
-  [6] = {.lex_state = 1},
-  [7] = {.lex_state = 1},
-  [8] = {.lex_state = 1},
-  [9] = {.lex_state = 4},
-  [10] = {.lex_state = 4},
-  [11] = {.lex_state = 4},
-  [12] = {.lex_state = 4},
-  [13] = {.lex_state = 4},
-  [14] = {.lex_state = 4},
-  [15] = {.lex_state = 4},
-  [16] = {.lex_state = 4},
-  [17] = {.lex_state = 4},
-  [18] = {.lex_state = 4},
-  [19] = {.lex_state = 4},
-  [20] = {.lex_state = 4},
-  [21] = {.lex_state = 2},
-  [22] = {.lex_state = 2},
-  [23] = {.lex_state = 2},
-  [24] = {.lex_state = 2},
-  [25] = {.lex_state = 2},
-  [26] = {.lex_state = 2},
-  [27] = {.lex_state = 2},
-  [28] = {.lex_state = 2},
-  [29] = {.lex_state = 2},
-  [30] = {.lex_state = 2},
-  [31] = {.lex_state = 2},
-  [32] = {.lex_state = 2},
-  [33] = {.lex_state = 2},
-  [34] = {.lex_state = 2},
-  [35] = {.lex_state = 2},
-  [36] = {.lex_state = 2},
-  [37] = {.lex_state = 5},
-  [38] = {.lex_state = 5},
-  [39] = {.lex_state = 5},
-  [40] = {.lex_state = 5},
-  [41] = {.lex_state = 5},
-  [42] = {.lex_state = 5},
-  [43] = {.lex_state = 5},
-  [44] = {.lex_state = 5},
-  [45] = {.lex_state = 5},
-  [46] = {.lex_state = 2},
-  [47] = {.lex_state = 5},
-  [48] = {.lex_state = 5},
-  [49] = {.lex_state = 2},
-  [50] = {.lex_state = 5},
-  [51] = {.lex_state = 5},
-  [52] = {.lex_state = 2},
-  [53] = {.lex_state = 5},
-  [54] = {.lex_state = 5},
-  [55] = {.lex_state = 5},
-  [56] = {.lex_state = 2},
-  [57] = {.lex_state = 5},
-  [58] = {.lex_state = 5},
-  [59] = {.lex_state = 5},
-  [60] = {.lex_state = 2},
-  [61] = {.lex_state = 5},
-  [62] = {.lex_state = 5},
-  [63] = {.lex_state = 2},
-  [64] = {.lex_state = 5},
-  [65] = {.lex_state = 5},
-  [66] = {.lex_state = 2},
-  [67] = {.lex_state = 5},
-  [68] = {.lex_state = 3},
-  [69] = {.lex_state = 5},
-  [70] = {.lex_state = 2},
-  [71] = {.lex_state = 5},
-  [72] = {.lex_state = 3},
-  [73] = {.lex_state = 3},
-  [74] = {.lex_state = 3},
-  [75] = {.lex_state = 3},
-  [76] = {.lex_state = 3},
-  [77] = {.lex_state = 3},
-  [78] = {.lex_state = 3},
-  [79] = {.lex_state = 3},
-  [80] = {.lex_state = 3},
-  [81] = {.lex_state = 3},
-  [82] = {.lex_state = 5},
-  [83] = {.lex_state = 2},
-  [84] = {.lex_state = 1},
-  [85] = {.lex_state = 1},
-  [86] = {.lex_state = 5},
-  [87] = {.lex_state = 1},
-  [88] = {.lex_state = 1},
-  [89] = {.lex_state = 1},
-  [90] = {.lex_state = 1},
-  [91] = {.lex_state = 1},
-  [92] = {.lex_state = 1},
-  [93] = {.lex_state = 1},
-  [94] = {.lex_state = 2},
-  [95] = {.lex_state = 2},
-  [96] = {.lex_state = 5},
-  [97] = {.lex_state = 5},
-  [98] = {.lex_state = 5},
-  [99] = {.lex_state = 5},
-  [100] = {.lex_state = 0},
-  [101] = {.lex_state = 0},
-  [102] = {.lex_state = 0},
-  [103] = {.lex_state = 0},
-  [104] = {.lex_state = 0},
-  [105] = {.lex_state = 0},
-  [106] = {.lex_state = 0},
-  [107] = {.lex_state = 0},
-  [108] = {.lex_state = 0},
-  [109] = {.lex_state = 0},
-  [110] = {.lex_state = 0},
-  [111] = {.lex_state = 0},
-  [112] = {.lex_state = 0},
-  [113] = {.lex_state = 11},
-  [114] = {.lex_state = 11},
-  [115] = {.lex_state = 11},
-  [116] = {.lex_state = 11},
-  [117] = {.lex_state = 11},
-  [118] = {.lex_state = 11},
-  [119] = {.lex_state = 0},
-  [120] = {.lex_state = 0},
-  [121] = {.lex_state = 0},
-  [122] = {.lex_state = 0},
-  [123] = {.lex_state = 0},
-  [124] = {.lex_state = 0},
-  [125] = {.lex_state = 0},
-  [126] = {.lex_state = 0},
-  [127] = {.lex_state = 12},
-  [128] = {.lex_state = 12},
-  [129] = {.lex_state = 12},
-  [130] = {.lex_state = 0},
-  [131] = {.lex_state = 0},
-  [132] = {.lex_state = 0},
-  [133] = {.lex_state = 0},
-  [134] = {.lex_state = 0},
-  [135] = {.lex_state = 0},
-  [136] = {.lex_state = 0},
-  [137] = {.lex_state = 0},
-  [138] = {.lex_state = 1},
-  [139] = {.lex_state = 1},
-  [140] = {.lex_state = 10},
-  [141] = {.lex_state = 0},
-  [142] = {.lex_state = 0},
-  [143] = {.lex_state = 10},
-  [144] = {.lex_state = 8},
-  [145] = {.lex_state = 0},
-  [146] = {.lex_state = 0},
-  [147] = {.lex_state = 1},
-  [148] = {.lex_state = 0},
-  [149] = {.lex_state = 0},
-  [150] = {.lex_state = 0},
-  [151] = {.lex_state = 0},
-  [152] = {.lex_state = 0},
-  [153] = {.lex_state = 0},
-  [154] = {.lex_state = 0},
-  [155] = {.lex_state = 0},
-  [156] = {.lex_state = 0},
-  [157] = {.lex_state = 0},
-  [158] = {.lex_state = 0},
-  [159] = {.lex_state = 0},
-  [160] = {.lex_state = 0},
-  [161] = {.lex_state = 12},
-  [162] = {.lex_state = 0},
-  [163] = {.lex_state = 0},
-  [164] = {.lex_state = 12},
-  [165] = {.lex_state = 0},
-  [166] = {.lex_state = 0},
-  [167] = {.lex_state = 1},
-  [168] = {.lex_state = 0},
-  [169] = {.lex_state = 1},
-  [170] = {.lex_state = 0},
-  [171] = {.lex_state = 0},
-  [172] = {.lex_state = 0},
-  [173] = {.lex_state = 8},
-  [174] = {.lex_state = 0},
-  [175] = {.lex_state = 0},
-  [176] = {.lex_state = 0},
-  [177] = {.lex_state = 0},
-  [178] = {.lex_state = 0},
-  [179] = {.lex_state = 0},
-  [180] = {.lex_state = 1},
-  [181] = {.lex_state = 8},
-  [182] = {.lex_state = 0},
-  [183] = {.lex_state = 0},
-  [184] = {.lex_state = 0},
-  [185] = {.lex_state = 0},
-  [186] = {.lex_state = 0},
-  [187] = {.lex_state = 0},
-  [188] = {.lex_state = 0},
-  [189] = {.lex_state = 0},
-  [190] = {.lex_state = 0},
-  [191] = {.lex_state = 0},
-  [192] = {.lex_state = 0},
-  [193] = {.lex_state = 0},
-  [194] = {.lex_state = 0},
-  [195] = {.lex_state = 0},
-  [196] = {.lex_state = 0},
-  [197] = {.lex_state = 0},
-  [198] = {.lex_state = 0},
-  [199] = {.lex_state = 0},
-  [200] = {.lex_state = 0},
-  [201] = {.lex_state = 0},
-  [202] = {.lex_state = 0},
-  [203] = {.lex_state = 0},
-  [204] = {.lex_state = 0},
-  [205] = {.lex_state = 0},
-  [206] = {.lex_state = 0},
-  [207] = {.lex_state = 0},
-  [208] = {.lex_state = 8},
-  [209] = {.lex_state = 0},
-  [210] = {.lex_state = 0},
-  [211] = {.lex_state = 0},
-  [212] = {.lex_state = 0},
-  [213] = {.lex_state = 0},
-  [214] = {.lex_state = 0},
-  [215] = {.lex_state = 0},
-  [216] = {.lex_state = 0},
+  [0] = {.lex_state = 0, .external_lex_state = 1},
+  [1] = {.lex_state = 1, .external_lex_state = 2},
+  [2] = {.lex_state = 7, .external_lex_state = 1},
+  [3] = {.lex_state = 7, .external_lex_state = 1},
+  [4] = {.lex_state = 7, .external_lex_state = 1},
+  [5] = {.lex_state = 7, .external_lex_state = 1},
+  [6] = {.lex_state = 7, .external_lex_state = 1},
+  [7] = {.lex_state = 7, .external_lex_state = 1},
+  [8] = {.lex_state = 7, .external_lex_state = 1},
+  [9] = {.lex_state = 15, .external_lex_state = 2},
+  [10] = {.lex_state = 15, .external_lex_state = 2},
+  [11] = {.lex_state = 15, .external_lex_state = 2},
+  [12] = {.lex_state = 15, .external_lex_state = 2},
+  [13] = {.lex_state = 15, .external_lex_state = 2},
+  [14] = {.lex_state = 15, .external_lex_state = 2},
+  [15] = {.lex_state = 15, .external_lex_state = 2},
+  [16] = {.lex_state = 15, .external_lex_state = 2},
+  [17] = {.lex_state = 15, .external_lex_state = 2},
+  [18] = {.lex_state = 15, .external_lex_state = 2},
+  [19] = {.lex_state = 15, .external_lex_state = 2},
+  [20] = {.lex_state = 15, .external_lex_state = 2},
+  [21] = {.lex_state = 15, .external_lex_state = 2},
+  [22] = {.lex_state = 15, .external_lex_state = 2},
+  [23] = {.lex_state = 15, .external_lex_state = 2},
+  [24] = {.lex_state = 15, .external_lex_state = 2},
+  [25] = {.lex_state = 15, .external_lex_state = 2},
+  [26] = {.lex_state = 18, .external_lex_state = 2},
+  [27] = {.lex_state = 16, .external_lex_state = 2},
+  [28] = {.lex_state = 16, .external_lex_state = 2},
+  [29] = {.lex_state = 16, .external_lex_state = 2},
+  [30] = {.lex_state = 16, .external_lex_state = 2},
+  [31] = {.lex_state = 16, .external_lex_state = 2},
+  [32] = {.lex_state = 16, .external_lex_state = 2},
+  [33] = {.lex_state = 16, .external_lex_state = 2},
+  [34] = {.lex_state = 16, .external_lex_state = 2},
+  [35] = {.lex_state = 16, .external_lex_state = 2},
+  [36] = {.lex_state = 16, .external_lex_state = 2},
+  [37] = {.lex_state = 16, .external_lex_state = 2},
+  [38] = {.lex_state = 16, .external_lex_state = 2},
+  [39] = {.lex_state = 16, .external_lex_state = 2},
+  [40] = {.lex_state = 16, .external_lex_state = 2},
+  [41] = {.lex_state = 16, .external_lex_state = 2},
+  [42] = {.lex_state = 16, .external_lex_state = 2},
+  [43] = {.lex_state = 16, .external_lex_state = 2},
+  [44] = {.lex_state = 16, .external_lex_state = 2},
+  [45] = {.lex_state = 16, .external_lex_state = 2},
+  [46] = {.lex_state = 16, .external_lex_state = 2},
+  [47] = {.lex_state = 16, .external_lex_state = 2},
+  [48] = {.lex_state = 16, .external_lex_state = 2},
+  [49] = {.lex_state = 16, .external_lex_state = 2},
+  [50] = {.lex_state = 16, .external_lex_state = 2},
+  [51] = {.lex_state = 16, .external_lex_state = 2},
+  [52] = {.lex_state = 16, .external_lex_state = 2},
+  [53] = {.lex_state = 16, .external_lex_state = 2},
+  [54] = {.lex_state = 17, .external_lex_state = 2},
+  [55] = {.lex_state = 20, .external_lex_state = 1},
+  [56] = {.lex_state = 21, .external_lex_state = 1},
+  [57] = {.lex_state = 19, .external_lex_state = 1},
+  [58] = {.lex_state = 19, .external_lex_state = 1},
+  [59] = {.lex_state = 7, .external_lex_state = 1},
+  [60] = {.lex_state = 7, .external_lex_state = 1},
+  [61] = {.lex_state = 7, .external_lex_state = 1},
+  [62] = {.lex_state = 7, .external_lex_state = 1},
+  [63] = {.lex_state = 7, .external_lex_state = 1},
+  [64] = {.lex_state = 7, .external_lex_state = 1},
+  [65] = {.lex_state = 7, .external_lex_state = 1},
+  [66] = {.lex_state = 7, .external_lex_state = 1},
+  [67] = {.lex_state = 7, .external_lex_state = 1},
+  [68] = {.lex_state = 7, .external_lex_state = 1},
+  [69] = {.lex_state = 7, .external_lex_state = 1},
+  [70] = {.lex_state = 7, .external_lex_state = 1},
+  [71] = {.lex_state = 7, .external_lex_state = 1},
+  [72] = {.lex_state = 7, .external_lex_state = 1},
+  [73] = {.lex_state = 7, .external_lex_state = 1},
+  [74] = {.lex_state = 7, .external_lex_state = 1},
+  [75] = {.lex_state = 7, .external_lex_state = 1},
+  [76] = {.lex_state = 7, .external_lex_state = 1},
+  [77] = {.lex_state = 7, .external_lex_state = 1},
+  [78] = {.lex_state = 7, .external_lex_state = 1},
+  [79] = {.lex_state = 7, .external_lex_state = 1},
+  [80] = {.lex_state = 7, .external_lex_state = 1},
+  [81] = {.lex_state = 7, .external_lex_state = 1},
+  [82] = {.lex_state = 7, .external_lex_state = 1},
+  [83] = {.lex_state = 7, .external_lex_state = 1},
+  [84] = {.lex_state = 7, .external_lex_state = 1},
+  [85] = {.lex_state = 7, .external_lex_state = 1},
+  [86] = {.lex_state = 7, .external_lex_state = 1},
+  [87] = {.lex_state = 7, .external_lex_state = 1},
+  [88] = {.lex_state = 7, .external_lex_state = 1},
+  [89] = {.lex_state = 7, .external_lex_state = 1},
+  [90] = {.lex_state = 7, .external_lex_state = 1},
+  [91] = {.lex_state = 7, .external_lex_state = 1},
+  [92] = {.lex_state = 7, .external_lex_state = 1},
+  [93] = {.lex_state = 7, .external_lex_state = 1},
+  [94] = {.lex_state = 7, .external_lex_state = 1},
+  [95] = {.lex_state = 7, .external_lex_state = 1},
+  [96] = {.lex_state = 7, .external_lex_state = 1},
+  [97] = {.lex_state = 7, .external_lex_state = 1},
+  [98] = {.lex_state = 7, .external_lex_state = 1},
+  [99] = {.lex_state = 7, .external_lex_state = 1},
+  [100] = {.lex_state = 7, .external_lex_state = 1},
+  [101] = {.lex_state = 7, .external_lex_state = 1},
+  [102] = {.lex_state = 7, .external_lex_state = 1},
+  [103] = {.lex_state = 7, .external_lex_state = 1},
+  [104] = {.lex_state = 7, .external_lex_state = 1},
+  [105] = {.lex_state = 7, .external_lex_state = 1},
+  [106] = {.lex_state = 2, .external_lex_state = 2},
+  [107] = {.lex_state = 2, .external_lex_state = 2},
+  [108] = {.lex_state = 2, .external_lex_state = 2},
+  [109] = {.lex_state = 2, .external_lex_state = 2},
+  [110] = {.lex_state = 2, .external_lex_state = 2},
+  [111] = {.lex_state = 2, .external_lex_state = 2},
+  [112] = {.lex_state = 5, .external_lex_state = 2},
+  [113] = {.lex_state = 2, .external_lex_state = 2},
+  [114] = {.lex_state = 2, .external_lex_state = 2},
+  [115] = {.lex_state = 2, .external_lex_state = 2},
+  [116] = {.lex_state = 1, .external_lex_state = 2},
+  [117] = {.lex_state = 1, .external_lex_state = 2},
+  [118] = {.lex_state = 22, .external_lex_state = 2},
+  [119] = {.lex_state = 22, .external_lex_state = 2},
+  [120] = {.lex_state = 22, .external_lex_state = 2},
+  [121] = {.lex_state = 22, .external_lex_state = 2},
+  [122] = {.lex_state = 22, .external_lex_state = 2},
+  [123] = {.lex_state = 22, .external_lex_state = 2},
+  [124] = {.lex_state = 22, .external_lex_state = 2},
+  [125] = {.lex_state = 22, .external_lex_state = 2},
+  [126] = {.lex_state = 22, .external_lex_state = 2},
+  [127] = {.lex_state = 22, .external_lex_state = 2},
+  [128] = {.lex_state = 22, .external_lex_state = 2},
+  [129] = {.lex_state = 6, .external_lex_state = 2},
+  [130] = {.lex_state = 2, .external_lex_state = 2},
+  [131] = {.lex_state = 8, .external_lex_state = 2},
+  [132] = {.lex_state = 12, .external_lex_state = 2},
+  [133] = {.lex_state = 8, .external_lex_state = 2},
+  [134] = {.lex_state = 12, .external_lex_state = 2},
+  [135] = {.lex_state = 12, .external_lex_state = 2},
+  [136] = {.lex_state = 24, .external_lex_state = 2},
+  [137] = {.lex_state = 24, .external_lex_state = 2},
+  [138] = {.lex_state = 24, .external_lex_state = 2},
+  [139] = {.lex_state = 9, .external_lex_state = 2},
+  [140] = {.lex_state = 11, .external_lex_state = 2},
+  [141] = {.lex_state = 2, .external_lex_state = 2},
+  [142] = {.lex_state = 2, .external_lex_state = 2},
+  [143] = {.lex_state = 11, .external_lex_state = 2},
+  [144] = {.lex_state = 2, .external_lex_state = 2},
+  [145] = {.lex_state = 5, .external_lex_state = 2},
+  [146] = {.lex_state = 11, .external_lex_state = 2},
+  [147] = {.lex_state = 12, .external_lex_state = 2},
+  [148] = {.lex_state = 26, .external_lex_state = 2},
+  [149] = {.lex_state = 5, .external_lex_state = 2},
+  [150] = {.lex_state = 2, .external_lex_state = 2},
+  [151] = {.lex_state = 26, .external_lex_state = 2},
+  [152] = {.lex_state = 24, .external_lex_state = 2},
+  [153] = {.lex_state = 26, .external_lex_state = 2},
+  [154] = {.lex_state = 2, .external_lex_state = 2},
+  [155] = {.lex_state = 1, .external_lex_state = 2},
+  [156] = {.lex_state = 1, .external_lex_state = 2},
+  [157] = {.lex_state = 1, .external_lex_state = 2},
+  [158] = {.lex_state = 1, .external_lex_state = 2},
+  [159] = {.lex_state = 1, .external_lex_state = 2},
+  [160] = {.lex_state = 13, .external_lex_state = 2},
+  [161] = {.lex_state = 1, .external_lex_state = 2},
+  [162] = {.lex_state = 2, .external_lex_state = 2},
+  [163] = {.lex_state = 2, .external_lex_state = 2},
+  [164] = {.lex_state = 11, .external_lex_state = 2},
+  [165] = {.lex_state = 11, .external_lex_state = 2},
+  [166] = {.lex_state = 26, .external_lex_state = 2},
+  [167] = {.lex_state = 3, .external_lex_state = 2},
+  [168] = {.lex_state = 4, .external_lex_state = 2},
+  [169] = {.lex_state = 10, .external_lex_state = 2},
+  [170] = {.lex_state = 14, .external_lex_state = 2},
+  [171] = {.lex_state = 14, .external_lex_state = 2},
+  [172] = {.lex_state = 14, .external_lex_state = 2},
+  [173] = {.lex_state = 2, .external_lex_state = 2},
+  [174] = {.lex_state = 10, .external_lex_state = 2},
+  [175] = {.lex_state = 2, .external_lex_state = 2},
+  [176] = {.lex_state = 2, .external_lex_state = 2},
+  [177] = {.lex_state = 14, .external_lex_state = 2},
+  [178] = {.lex_state = 23, .external_lex_state = 2},
+  [179] = {.lex_state = 14, .external_lex_state = 2},
+  [180] = {.lex_state = 25, .external_lex_state = 2},
+  [181] = {.lex_state = 10, .external_lex_state = 2},
+  [182] = {.lex_state = 14, .external_lex_state = 2},
+  [183] = {.lex_state = 14, .external_lex_state = 2},
+  [184] = {.lex_state = 14, .external_lex_state = 2},
+  [185] = {.lex_state = 2, .external_lex_state = 2},
+  [186] = {.lex_state = 2, .external_lex_state = 2},
 };
 
 static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
   [STATE(0)] = {
     [ts_builtin_sym_end] = ACTIONS(1),
-    [sym_comment] = ACTIONS(3),
     [anon_sym_bool] = ACTIONS(1),
     [anon_sym_byte] = ACTIONS(1),
     [anon_sym_int] = ACTIONS(1),
@@ -2740,501 +2116,29 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
     [anon_sym_not] = ACTIONS(1),
     [anon_sym_TILDE] = ACTIONS(1),
     [anon_sym_COLON_EQ] = ACTIONS(1),
-    [sym_str] = ACTIONS(1),
+    [sym_identifier] = ACTIONS(1),
     [sym_char] = ACTIONS(1),
     [sym_hex] = ACTIONS(1),
     [sym_bits] = ACTIONS(1),
     [sym_dec] = ACTIONS(1),
     [anon_sym_true] = ACTIONS(1),
     [anon_sym_false] = ACTIONS(1),
+    [sym_comment] = ACTIONS(3),
+    [sym_str] = ACTIONS(1),
   },
   [STATE(1)] = {
-    [sym_source_file] = STATE(196),
-    [sym_sourceItem] = STATE(132),
-    [sym_funcDef] = STATE(171),
-    [aux_sym_source_file_repeat1] = STATE(132),
+    [sym_source_file] = STATE(167),
+    [sym_sourceItem] = STATE(155),
+    [sym_funcDef] = STATE(156),
+    [aux_sym_source_file_repeat1] = STATE(116),
     [ts_builtin_sym_end] = ACTIONS(5),
-    [sym_comment] = ACTIONS(3),
     [anon_sym_method] = ACTIONS(7),
+    [sym_comment] = ACTIONS(3),
   },
-};
-
-static const uint16_t ts_small_parse_table[] = {
-  [0] = 32,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(11), 1,
-      anon_sym_if,
-    ACTIONS(13), 1,
-      anon_sym_begin,
-    ACTIONS(15), 1,
-      anon_sym_end,
-    ACTIONS(17), 1,
-      anon_sym_while,
-    ACTIONS(19), 1,
-      anon_sym_repeat,
-    ACTIONS(21), 1,
-      anon_sym_break,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(4), 2,
-      sym_statement,
-      aux_sym_block_repeat1,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [111] = 32,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(35), 1,
-      anon_sym_LPAREN,
-    ACTIONS(38), 1,
-      anon_sym_if,
-    ACTIONS(41), 1,
-      anon_sym_begin,
-    ACTIONS(44), 1,
-      anon_sym_end,
-    ACTIONS(46), 1,
-      anon_sym_while,
-    ACTIONS(49), 1,
-      anon_sym_repeat,
-    ACTIONS(52), 1,
-      anon_sym_break,
-    ACTIONS(58), 1,
-      anon_sym_not,
-    ACTIONS(61), 1,
-      sym_identifier,
-    ACTIONS(67), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(70), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(3), 2,
-      sym_statement,
-      aux_sym_block_repeat1,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(55), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(64), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [222] = 32,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(11), 1,
-      anon_sym_if,
-    ACTIONS(13), 1,
-      anon_sym_begin,
-    ACTIONS(17), 1,
-      anon_sym_while,
-    ACTIONS(19), 1,
-      anon_sym_repeat,
-    ACTIONS(21), 1,
-      anon_sym_break,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(73), 1,
-      anon_sym_end,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(3), 2,
-      sym_statement,
-      aux_sym_block_repeat1,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [333] = 32,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(11), 1,
-      anon_sym_if,
-    ACTIONS(13), 1,
-      anon_sym_begin,
-    ACTIONS(17), 1,
-      anon_sym_while,
-    ACTIONS(19), 1,
-      anon_sym_repeat,
-    ACTIONS(21), 1,
-      anon_sym_break,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(75), 1,
-      anon_sym_end,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(6), 2,
-      sym_statement,
-      aux_sym_block_repeat1,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [444] = 32,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(11), 1,
-      anon_sym_if,
-    ACTIONS(13), 1,
-      anon_sym_begin,
-    ACTIONS(17), 1,
-      anon_sym_while,
-    ACTIONS(19), 1,
-      anon_sym_repeat,
-    ACTIONS(21), 1,
-      anon_sym_break,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(77), 1,
-      anon_sym_end,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(3), 2,
-      sym_statement,
-      aux_sym_block_repeat1,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [555] = 32,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(11), 1,
-      anon_sym_if,
-    ACTIONS(13), 1,
-      anon_sym_begin,
-    ACTIONS(17), 1,
-      anon_sym_while,
-    ACTIONS(19), 1,
-      anon_sym_repeat,
-    ACTIONS(21), 1,
-      anon_sym_break,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(79), 1,
-      anon_sym_end,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(8), 2,
-      sym_statement,
-      aux_sym_block_repeat1,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [666] = 32,
+};
+
+static const uint16_t ts_small_parse_table[] = {
+  [0] = 38,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
@@ -3243,305 +2147,302 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_if,
     ACTIONS(13), 1,
       anon_sym_begin,
+    ACTIONS(15), 1,
+      anon_sym_end,
     ACTIONS(17), 1,
       anon_sym_while,
     ACTIONS(19), 1,
       anon_sym_repeat,
     ACTIONS(21), 1,
       anon_sym_break,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    ACTIONS(81), 1,
-      anon_sym_end,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    STATE(3), 2,
-      sym_statement,
-      aux_sym_block_repeat1,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
+    ACTIONS(45), 1,
       sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
+    STATE(3), 1,
+      aux_sym_block_repeat1,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(54), 1,
+      sym__operand,
+    STATE(70), 1,
       sym_if_statement,
+    STATE(71), 1,
       sym_block,
+    STATE(72), 1,
       sym_while_statement,
+    STATE(73), 1,
       sym_do_statement,
+    STATE(74), 1,
       sym_break_statement,
+    STATE(75), 1,
       sym_expr_stmt,
+    STATE(76), 1,
       sym_assignment,
-  [777] = 31,
+    STATE(105), 1,
+      sym_statement,
+    STATE(172), 1,
+      sym_expr,
+  [115] = 38,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(83), 1,
+    ACTIONS(11), 1,
       anon_sym_if,
-    ACTIONS(85), 1,
+    ACTIONS(13), 1,
       anon_sym_begin,
-    ACTIONS(87), 1,
+    ACTIONS(17), 1,
       anon_sym_while,
-    ACTIONS(89), 1,
+    ACTIONS(19), 1,
       anon_sym_repeat,
-    ACTIONS(91), 1,
+    ACTIONS(21), 1,
       anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(54), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(78), 1,
-      sym_statement,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(186), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    STATE(73), 7,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    ACTIONS(47), 1,
+      anon_sym_end,
+    STATE(4), 1,
+      aux_sym_block_repeat1,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(54), 1,
+      sym__operand,
+    STATE(70), 1,
       sym_if_statement,
+    STATE(71), 1,
       sym_block,
+    STATE(72), 1,
       sym_while_statement,
+    STATE(73), 1,
       sym_do_statement,
+    STATE(74), 1,
       sym_break_statement,
+    STATE(75), 1,
       sym_expr_stmt,
+    STATE(76), 1,
       sym_assignment,
-  [884] = 31,
+    STATE(105), 1,
+      sym_statement,
+    STATE(172), 1,
+      sym_expr,
+  [230] = 38,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(49), 1,
       anon_sym_LPAREN,
-    ACTIONS(11), 1,
+    ACTIONS(52), 1,
       anon_sym_if,
-    ACTIONS(13), 1,
+    ACTIONS(55), 1,
       anon_sym_begin,
-    ACTIONS(17), 1,
+    ACTIONS(58), 1,
+      anon_sym_end,
+    ACTIONS(60), 1,
       anon_sym_while,
-    ACTIONS(19), 1,
+    ACTIONS(63), 1,
       anon_sym_repeat,
-    ACTIONS(21), 1,
+    ACTIONS(66), 1,
       anon_sym_break,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(89), 1,
-      sym_statement,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(69), 1,
       anon_sym_DASH,
+    ACTIONS(72), 1,
       anon_sym_BANG,
+    ACTIONS(75), 1,
+      anon_sym_not,
+    ACTIONS(78), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(81), 1,
+      sym_identifier,
+    ACTIONS(84), 1,
       sym_char,
+    ACTIONS(87), 1,
       sym_hex,
+    ACTIONS(90), 1,
       sym_bits,
-    STATE(93), 7,
+    ACTIONS(93), 1,
+      sym_dec,
+    ACTIONS(96), 1,
+      anon_sym_true,
+    ACTIONS(99), 1,
+      anon_sym_false,
+    ACTIONS(102), 1,
+      sym_str,
+    STATE(4), 1,
+      aux_sym_block_repeat1,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(54), 1,
+      sym__operand,
+    STATE(70), 1,
       sym_if_statement,
+    STATE(71), 1,
       sym_block,
+    STATE(72), 1,
       sym_while_statement,
+    STATE(73), 1,
       sym_do_statement,
+    STATE(74), 1,
       sym_break_statement,
+    STATE(75), 1,
       sym_expr_stmt,
+    STATE(76), 1,
       sym_assignment,
-  [991] = 31,
+    STATE(105), 1,
+      sym_statement,
+    STATE(172), 1,
+      sym_expr,
+  [345] = 36,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(83), 1,
+    ACTIONS(11), 1,
       anon_sym_if,
-    ACTIONS(85), 1,
+    ACTIONS(13), 1,
       anon_sym_begin,
-    ACTIONS(87), 1,
+    ACTIONS(17), 1,
       anon_sym_while,
-    ACTIONS(89), 1,
+    ACTIONS(19), 1,
       anon_sym_repeat,
-    ACTIONS(91), 1,
+    ACTIONS(21), 1,
       anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(54), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(72), 1,
-      sym_statement,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(186), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    STATE(73), 7,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(54), 1,
+      sym__operand,
+    STATE(70), 1,
       sym_if_statement,
+    STATE(71), 1,
       sym_block,
+    STATE(72), 1,
       sym_while_statement,
+    STATE(73), 1,
       sym_do_statement,
+    STATE(74), 1,
       sym_break_statement,
+    STATE(75), 1,
       sym_expr_stmt,
+    STATE(76), 1,
       sym_assignment,
-  [1098] = 31,
+    STATE(163), 1,
+      sym_statement,
+    STATE(172), 1,
+      sym_expr,
+  [454] = 36,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
@@ -3556,4815 +2457,4807 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_repeat,
     ACTIONS(21), 1,
       anon_sym_break,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(53), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(85), 1,
-      sym_statement,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(205), 1,
-      sym_expr,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
+    ACTIONS(45), 1,
       sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(93), 7,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(54), 1,
+      sym__operand,
+    STATE(70), 1,
       sym_if_statement,
+    STATE(71), 1,
       sym_block,
+    STATE(72), 1,
       sym_while_statement,
+    STATE(73), 1,
       sym_do_statement,
+    STATE(74), 1,
       sym_break_statement,
+    STATE(75), 1,
       sym_expr_stmt,
+    STATE(76), 1,
       sym_assignment,
-  [1205] = 31,
+    STATE(99), 1,
+      sym_statement,
+    STATE(172), 1,
+      sym_expr,
+  [563] = 36,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(93), 1,
+    ACTIONS(11), 1,
       anon_sym_if,
-    ACTIONS(95), 1,
+    ACTIONS(13), 1,
       anon_sym_begin,
-    ACTIONS(97), 1,
+    ACTIONS(17), 1,
       anon_sym_while,
-    ACTIONS(99), 1,
+    ACTIONS(19), 1,
       anon_sym_repeat,
-    ACTIONS(101), 1,
+    ACTIONS(21), 1,
       anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(59), 1,
-      sym_postfix,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(175), 1,
-      sym_statement,
-    STATE(210), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    STATE(150), 7,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(54), 1,
+      sym__operand,
+    STATE(70), 1,
       sym_if_statement,
+    STATE(71), 1,
       sym_block,
+    STATE(72), 1,
       sym_while_statement,
+    STATE(73), 1,
       sym_do_statement,
+    STATE(74), 1,
       sym_break_statement,
+    STATE(75), 1,
       sym_expr_stmt,
+    STATE(76), 1,
       sym_assignment,
-  [1312] = 31,
+    STATE(100), 1,
+      sym_statement,
+    STATE(172), 1,
+      sym_expr,
+  [672] = 36,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(93), 1,
+    ACTIONS(11), 1,
       anon_sym_if,
-    ACTIONS(95), 1,
+    ACTIONS(13), 1,
       anon_sym_begin,
-    ACTIONS(97), 1,
+    ACTIONS(17), 1,
       anon_sym_while,
-    ACTIONS(99), 1,
+    ACTIONS(19), 1,
       anon_sym_repeat,
-    ACTIONS(101), 1,
+    ACTIONS(21), 1,
       anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(59), 1,
-      sym_postfix,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(154), 1,
-      sym_statement,
-    STATE(210), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    STATE(150), 7,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(54), 1,
+      sym__operand,
+    STATE(70), 1,
       sym_if_statement,
+    STATE(71), 1,
       sym_block,
+    STATE(72), 1,
       sym_while_statement,
+    STATE(73), 1,
       sym_do_statement,
+    STATE(74), 1,
       sym_break_statement,
+    STATE(75), 1,
       sym_expr_stmt,
+    STATE(76), 1,
       sym_assignment,
-  [1419] = 31,
+    STATE(104), 1,
+      sym_statement,
+    STATE(172), 1,
+      sym_expr,
+  [781] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(107), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(105), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [818] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(111), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(109), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [855] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(111), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(109), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [892] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(111), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(109), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [929] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(111), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(109), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [966] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(115), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(113), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1003] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(115), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(113), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(93), 1,
-      anon_sym_if,
-    ACTIONS(95), 1,
-      anon_sym_begin,
-    ACTIONS(97), 1,
-      anon_sym_while,
-    ACTIONS(99), 1,
-      anon_sym_repeat,
-    ACTIONS(101), 1,
-      anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(59), 1,
-      sym_postfix,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(155), 1,
-      sym_statement,
-    STATE(210), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(150), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [1526] = 31,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1040] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(111), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(109), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(93), 1,
-      anon_sym_if,
-    ACTIONS(95), 1,
-      anon_sym_begin,
-    ACTIONS(97), 1,
-      anon_sym_while,
-    ACTIONS(99), 1,
-      anon_sym_repeat,
-    ACTIONS(101), 1,
-      anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(59), 1,
-      sym_postfix,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(158), 1,
-      sym_statement,
-    STATE(210), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(150), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [1633] = 31,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1077] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(107), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(105), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(83), 1,
-      anon_sym_if,
-    ACTIONS(85), 1,
-      anon_sym_begin,
-    ACTIONS(87), 1,
-      anon_sym_while,
-    ACTIONS(89), 1,
-      anon_sym_repeat,
-    ACTIONS(91), 1,
-      anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(54), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(68), 1,
-      sym_statement,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(186), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(73), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [1740] = 31,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1114] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(107), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(105), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(83), 1,
-      anon_sym_if,
-    ACTIONS(85), 1,
-      anon_sym_begin,
-    ACTIONS(87), 1,
-      anon_sym_while,
-    ACTIONS(89), 1,
-      anon_sym_repeat,
-    ACTIONS(91), 1,
-      anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(54), 1,
-      sym_postfix,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(81), 1,
-      sym_statement,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(186), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(73), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [1847] = 31,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1151] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(111), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(109), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(93), 1,
-      anon_sym_if,
-    ACTIONS(95), 1,
-      anon_sym_begin,
-    ACTIONS(97), 1,
-      anon_sym_while,
-    ACTIONS(99), 1,
-      anon_sym_repeat,
-    ACTIONS(101), 1,
-      anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(59), 1,
-      sym_postfix,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(176), 1,
-      sym_statement,
-    STATE(210), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(150), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [1954] = 31,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1188] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(107), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(105), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(93), 1,
-      anon_sym_if,
-    ACTIONS(95), 1,
-      anon_sym_begin,
-    ACTIONS(97), 1,
-      anon_sym_while,
-    ACTIONS(99), 1,
-      anon_sym_repeat,
-    ACTIONS(101), 1,
-      anon_sym_break,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(59), 1,
-      sym_postfix,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(178), 1,
-      sym_statement,
-    STATE(210), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-    STATE(150), 7,
-      sym_if_statement,
-      sym_block,
-      sym_while_statement,
-      sym_do_statement,
-      sym_break_statement,
-      sym_expr_stmt,
-      sym_assignment,
-  [2061] = 26,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1225] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(103), 1,
+    ACTIONS(119), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(117), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
       anon_sym_RBRACK,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(145), 1,
-      sym_expr,
-    STATE(203), 1,
-      sym_exprList,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2147] = 26,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1262] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(123), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(121), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    ACTIONS(103), 1,
       anon_sym_RPAREN,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(145), 1,
-      sym_expr,
-    STATE(214), 1,
-      sym_exprList,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1299] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(123), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(121), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_LPAREN,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2233] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1336] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(127), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(125), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(204), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2313] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1373] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(127), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+    ACTIONS(125), 15,
+      anon_sym_LBRACK,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(202), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2393] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+      anon_sym_COLON_EQ,
+  [1410] = 5,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(129), 1,
+      anon_sym_LBRACK,
+    ACTIONS(133), 1,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(183), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(131), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2473] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(135), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [1450] = 23,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(216), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(141), 1,
+      anon_sym_PIPE_PIPE,
+    ACTIONS(143), 1,
+      anon_sym_or,
+    ACTIONS(145), 1,
+      anon_sym_AMP_AMP,
+    ACTIONS(147), 1,
+      anon_sym_and,
+    ACTIONS(149), 1,
+      anon_sym_PIPE,
+    ACTIONS(151), 1,
+      anon_sym_CARET,
+    ACTIONS(153), 1,
+      anon_sym_AMP,
+    ACTIONS(155), 1,
+      anon_sym_EQ,
+    ACTIONS(157), 1,
+      anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
+      anon_sym_LT_EQ,
+    ACTIONS(165), 1,
+      anon_sym_GT_EQ,
+    ACTIONS(167), 1,
+      anon_sym_LT_LT,
+    ACTIONS(169), 1,
+      anon_sym_GT_GT,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2553] = 24,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(139), 2,
+      anon_sym_then,
+      anon_sym_do,
+    ACTIONS(137), 4,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+  [1524] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(200), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2633] = 24,
+    ACTIONS(131), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(135), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [1558] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(168), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(131), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2713] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(135), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [1592] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(213), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(181), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2793] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(183), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [1626] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(189), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(181), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2873] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(183), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [1660] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(198), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(181), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [2953] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(183), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [1694] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(215), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(181), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [3033] = 24,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(183), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [1728] = 21,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(195), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(145), 1,
+      anon_sym_AMP_AMP,
+    ACTIONS(147), 1,
+      anon_sym_and,
+    ACTIONS(149), 1,
+      anon_sym_PIPE,
+    ACTIONS(151), 1,
+      anon_sym_CARET,
+    ACTIONS(153), 1,
+      anon_sym_AMP,
+    ACTIONS(155), 1,
+      anon_sym_EQ,
+    ACTIONS(157), 1,
+      anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
+      anon_sym_LT_EQ,
+    ACTIONS(165), 1,
+      anon_sym_GT_EQ,
+    ACTIONS(167), 1,
+      anon_sym_LT_LT,
+    ACTIONS(169), 1,
+      anon_sym_GT_GT,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [3113] = 24,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 4,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+    ACTIONS(187), 4,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+  [1798] = 21,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(194), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(145), 1,
+      anon_sym_AMP_AMP,
+    ACTIONS(147), 1,
+      anon_sym_and,
+    ACTIONS(149), 1,
+      anon_sym_PIPE,
+    ACTIONS(151), 1,
+      anon_sym_CARET,
+    ACTIONS(153), 1,
+      anon_sym_AMP,
+    ACTIONS(155), 1,
+      anon_sym_EQ,
+    ACTIONS(157), 1,
+      anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
+      anon_sym_LT_EQ,
+    ACTIONS(165), 1,
+      anon_sym_GT_EQ,
+    ACTIONS(167), 1,
+      anon_sym_LT_LT,
+    ACTIONS(169), 1,
+      anon_sym_GT_GT,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [3193] = 24,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 4,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+    ACTIONS(187), 4,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+  [1868] = 19,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(190), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(149), 1,
+      anon_sym_PIPE,
+    ACTIONS(151), 1,
+      anon_sym_CARET,
+    ACTIONS(153), 1,
+      anon_sym_AMP,
+    ACTIONS(155), 1,
+      anon_sym_EQ,
+    ACTIONS(157), 1,
+      anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
+      anon_sym_LT_EQ,
+    ACTIONS(165), 1,
+      anon_sym_GT_EQ,
+    ACTIONS(167), 1,
+      anon_sym_LT_LT,
+    ACTIONS(169), 1,
+      anon_sym_GT_GT,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [3273] = 24,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 4,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+    ACTIONS(187), 6,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+  [1934] = 19,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(124), 1,
-      sym_logical_and,
-    STATE(201), 1,
-      sym_expr,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    STATE(130), 2,
-      sym__expr,
-      sym_logical_or,
-    ACTIONS(23), 3,
+    ACTIONS(149), 1,
+      anon_sym_PIPE,
+    ACTIONS(151), 1,
+      anon_sym_CARET,
+    ACTIONS(153), 1,
+      anon_sym_AMP,
+    ACTIONS(155), 1,
+      anon_sym_EQ,
+    ACTIONS(157), 1,
+      anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
+      anon_sym_LT_EQ,
+    ACTIONS(165), 1,
+      anon_sym_GT_EQ,
+    ACTIONS(167), 1,
+      anon_sym_LT_LT,
+    ACTIONS(169), 1,
+      anon_sym_GT_GT,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [3353] = 3,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 4,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+    ACTIONS(187), 6,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+  [2000] = 18,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(107), 5,
+    ACTIONS(151), 1,
+      anon_sym_CARET,
+    ACTIONS(153), 1,
+      anon_sym_AMP,
+    ACTIONS(155), 1,
+      anon_sym_EQ,
+    ACTIONS(157), 1,
+      anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
+      anon_sym_LT_EQ,
+    ACTIONS(165), 1,
+      anon_sym_GT_EQ,
+    ACTIONS(167), 1,
+      anon_sym_LT_LT,
+    ACTIONS(169), 1,
+      anon_sym_GT_GT,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
+      anon_sym_DASH,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 4,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+    ACTIONS(187), 7,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
       anon_sym_PIPE,
+  [2064] = 17,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(153), 1,
       anon_sym_AMP,
+    ACTIONS(155), 1,
+      anon_sym_EQ,
+    ACTIONS(157), 1,
+      anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
       anon_sym_LT,
+    ACTIONS(161), 1,
       anon_sym_GT,
+    ACTIONS(163), 1,
+      anon_sym_LT_EQ,
+    ACTIONS(165), 1,
+      anon_sym_GT_EQ,
+    ACTIONS(167), 1,
+      anon_sym_LT_LT,
+    ACTIONS(169), 1,
+      anon_sym_GT_GT,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
+      anon_sym_DASH,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(105), 24,
-      anon_sym_LBRACK,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 5,
       anon_sym_COMMA,
       anon_sym_RBRACK,
-      anon_sym_LPAREN,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+    ACTIONS(187), 7,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
+      anon_sym_PIPE,
+  [2126] = 16,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(155), 1,
       anon_sym_EQ,
+    ACTIONS(157), 1,
       anon_sym_BANG_EQ,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
       anon_sym_LT_EQ,
+    ACTIONS(165), 1,
       anon_sym_GT_EQ,
+    ACTIONS(167), 1,
       anon_sym_LT_LT,
+    ACTIONS(169), 1,
       anon_sym_GT_GT,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-      anon_sym_COLON_EQ,
-  [3390] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(111), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(109), 24,
-      anon_sym_LBRACK,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 5,
       anon_sym_COMMA,
       anon_sym_RBRACK,
-      anon_sym_LPAREN,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+    ACTIONS(187), 8,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+  [2186] = 14,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
       anon_sym_LT_EQ,
+    ACTIONS(165), 1,
       anon_sym_GT_EQ,
+    ACTIONS(167), 1,
       anon_sym_LT_LT,
+    ACTIONS(169), 1,
       anon_sym_GT_GT,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-      anon_sym_COLON_EQ,
-  [3427] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(115), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(113), 24,
-      anon_sym_LBRACK,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 7,
       anon_sym_COMMA,
       anon_sym_RBRACK,
-      anon_sym_LPAREN,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 8,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+  [2242] = 14,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(159), 1,
+      anon_sym_LT,
+    ACTIONS(161), 1,
+      anon_sym_GT,
+    ACTIONS(163), 1,
       anon_sym_LT_EQ,
+    ACTIONS(165), 1,
       anon_sym_GT_EQ,
+    ACTIONS(167), 1,
       anon_sym_LT_LT,
+    ACTIONS(169), 1,
       anon_sym_GT_GT,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-      anon_sym_COLON_EQ,
-  [3464] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(119), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(117), 24,
-      anon_sym_LBRACK,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 7,
       anon_sym_COMMA,
       anon_sym_RBRACK,
-      anon_sym_LPAREN,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 8,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+  [2298] = 10,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(167), 1,
       anon_sym_LT_LT,
+    ACTIONS(169), 1,
       anon_sym_GT_GT,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-      anon_sym_COLON_EQ,
-  [3501] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(123), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(121), 24,
-      anon_sym_LBRACK,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 7,
       anon_sym_COMMA,
       anon_sym_RBRACK,
-      anon_sym_LPAREN,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 12,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
+  [2346] = 10,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(167), 1,
       anon_sym_LT_LT,
+    ACTIONS(169), 1,
       anon_sym_GT_GT,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-      anon_sym_COLON_EQ,
-  [3538] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(127), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(125), 24,
-      anon_sym_LBRACK,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 7,
       anon_sym_COMMA,
       anon_sym_RBRACK,
-      anon_sym_LPAREN,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 12,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
+  [2394] = 10,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(167), 1,
       anon_sym_LT_LT,
+    ACTIONS(169), 1,
       anon_sym_GT_GT,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-      anon_sym_COLON_EQ,
-  [3575] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(131), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(129), 24,
-      anon_sym_LBRACK,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 7,
       anon_sym_COMMA,
       anon_sym_RBRACK,
-      anon_sym_LPAREN,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 12,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
+  [2442] = 10,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(167), 1,
       anon_sym_LT_LT,
+    ACTIONS(169), 1,
       anon_sym_GT_GT,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-      anon_sym_COLON_EQ,
-  [3612] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(133), 1,
-      anon_sym_LBRACK,
-    ACTIONS(137), 1,
-      anon_sym_LPAREN,
-    ACTIONS(139), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    ACTIONS(135), 21,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 7,
       anon_sym_COMMA,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 12,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
+  [2490] = 8,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(171), 1,
       anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
+    ACTIONS(175), 1,
       anon_sym_STAR,
-      anon_sym_PERCENT,
-  [3652] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(147), 1,
+    ACTIONS(177), 1,
       anon_sym_SLASH,
-    STATE(47), 1,
-      aux_sym_mul_repeat1,
-    ACTIONS(145), 2,
-      anon_sym_STAR,
+    ACTIONS(179), 1,
       anon_sym_PERCENT,
-    ACTIONS(143), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(141), 19,
+    ACTIONS(185), 7,
       anon_sym_COMMA,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 14,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
       anon_sym_LT_LT,
       anon_sym_GT_GT,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-  [3693] = 22,
+  [2534] = 8,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(120), 1,
-      sym_bitwise_or,
-    STATE(125), 1,
-      sym_logical_and,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    ACTIONS(23), 3,
+    ACTIONS(171), 1,
+      anon_sym_PLUS,
+    ACTIONS(173), 1,
       anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [3766] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(147), 1,
-      anon_sym_SLASH,
-    STATE(48), 1,
-      aux_sym_mul_repeat1,
-    ACTIONS(145), 2,
+    ACTIONS(175), 1,
       anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
       anon_sym_PERCENT,
-    ACTIONS(151), 4,
+    ACTIONS(185), 7,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+    ACTIONS(187), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
       anon_sym_PIPE,
       anon_sym_AMP,
       anon_sym_LT,
       anon_sym_GT,
-    ACTIONS(149), 19,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [2578] = 6,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(175), 1,
+      anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
+      anon_sym_PERCENT,
+    ACTIONS(185), 9,
       anon_sym_COMMA,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+    ACTIONS(187), 14,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
       anon_sym_LT_LT,
       anon_sym_GT_GT,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-  [3807] = 6,
+  [2618] = 6,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(160), 1,
-      anon_sym_SLASH,
-    STATE(48), 1,
-      aux_sym_mul_repeat1,
-    ACTIONS(157), 2,
+    ACTIONS(175), 1,
       anon_sym_STAR,
+    ACTIONS(177), 1,
+      anon_sym_SLASH,
+    ACTIONS(179), 1,
       anon_sym_PERCENT,
-    ACTIONS(155), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(153), 19,
+    ACTIONS(185), 9,
       anon_sym_COMMA,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+    ACTIONS(187), 14,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
       anon_sym_LT_LT,
       anon_sym_GT_GT,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-  [3848] = 21,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(9), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(110), 1,
-      sym_bitwise_xor,
-    STATE(121), 1,
-      sym_bitwise_or,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [3918] = 3,
+  [2658] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(165), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_SLASH,
-    ACTIONS(163), 21,
+    ACTIONS(185), 12,
       anon_sym_COMMA,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(187), 14,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
       anon_sym_LT_LT,
       anon_sym_GT_GT,
+  [2692] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(185), 12,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
       anon_sym_PLUS,
       anon_sym_DASH,
       anon_sym_STAR,
+      anon_sym_SLASH,
       anon_sym_PERCENT,
-  [3952] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(155), 5,
+    ACTIONS(187), 14,
+      anon_sym_then,
+      anon_sym_do,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
       anon_sym_PIPE,
       anon_sym_AMP,
       anon_sym_LT,
       anon_sym_GT,
-      anon_sym_SLASH,
-    ACTIONS(153), 21,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [2726] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(185), 12,
       anon_sym_COMMA,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
+      anon_sym_PLUS,
+      anon_sym_DASH,
+      anon_sym_STAR,
+      anon_sym_SLASH,
+      anon_sym_PERCENT,
+    ACTIONS(187), 14,
       anon_sym_then,
       anon_sym_do,
       anon_sym_PIPE_PIPE,
       anon_sym_or,
       anon_sym_AMP_AMP,
       anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
       anon_sym_LT_EQ,
       anon_sym_GT_EQ,
       anon_sym_LT_LT,
       anon_sym_GT_GT,
+  [2760] = 6,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(129), 1,
+      anon_sym_LBRACK,
+    ACTIONS(133), 1,
+      anon_sym_LPAREN,
+    ACTIONS(189), 1,
+      anon_sym_COLON_EQ,
+    ACTIONS(131), 9,
+      anon_sym_SEMI,
+      anon_sym_CARET,
+      anon_sym_EQ,
+      anon_sym_BANG_EQ,
       anon_sym_PLUS,
       anon_sym_DASH,
       anon_sym_STAR,
+      anon_sym_SLASH,
       anon_sym_PERCENT,
-  [3986] = 20,
+    ACTIONS(135), 12,
+      anon_sym_PIPE_PIPE,
+      anon_sym_or,
+      anon_sym_AMP_AMP,
+      anon_sym_and,
+      anon_sym_PIPE,
+      anon_sym_AMP,
+      anon_sym_LT,
+      anon_sym_GT,
+      anon_sym_LT_EQ,
+      anon_sym_GT_EQ,
+      anon_sym_LT_LT,
+      anon_sym_GT_GT,
+  [2798] = 25,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    ACTIONS(191), 1,
+      anon_sym_RBRACK,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
       sym_bool,
-    STATE(44), 1,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(136), 1,
+      sym_expr,
+    STATE(180), 1,
+      sym_exprList,
+  [2874] = 25,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    ACTIONS(193), 1,
+      anon_sym_RPAREN,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
       sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(103), 1,
-      sym_bitwise_and,
-    STATE(111), 1,
-      sym_bitwise_xor,
-    ACTIONS(33), 2,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(136), 1,
+      sym_expr,
+    STATE(181), 1,
+      sym_exprList,
+  [2950] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(195), 7,
+      ts_builtin_sym_end,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(197), 16,
+      anon_sym_method,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [2981] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(199), 7,
+      ts_builtin_sym_end,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(201), 16,
+      anon_sym_method,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
       anon_sym_true,
       anon_sym_false,
-    ACTIONS(23), 3,
+  [3012] = 23,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-  [4053] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(133), 1,
-      anon_sym_LBRACK,
-    ACTIONS(137), 1,
-      anon_sym_LPAREN,
-    ACTIONS(167), 1,
-      anon_sym_COLON_EQ,
-    ACTIONS(139), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_SLASH,
-    ACTIONS(135), 16,
-      anon_sym_SEMI,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_PERCENT,
-  [4091] = 6,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(174), 1,
+      sym_expr,
+  [3082] = 23,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(133), 1,
-      anon_sym_LBRACK,
-    ACTIONS(137), 1,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
-    ACTIONS(169), 1,
-      anon_sym_COLON_EQ,
-    ACTIONS(139), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_SLASH,
-    ACTIONS(135), 16,
-      anon_sym_SEMI,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_PERCENT,
-  [4129] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(58), 1,
-      aux_sym_add_repeat1,
-    ACTIONS(175), 2,
-      anon_sym_PLUS,
+    ACTIONS(23), 1,
       anon_sym_DASH,
-    ACTIONS(173), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(171), 17,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-  [4165] = 19,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(175), 1,
+      sym_expr,
+  [3152] = 23,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(101), 1,
-      sym_equality,
-    STATE(107), 1,
-      sym_bitwise_and,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    ACTIONS(23), 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(176), 1,
+      sym_expr,
+  [3222] = 23,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-  [4229] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(57), 1,
-      aux_sym_add_repeat1,
-    ACTIONS(181), 2,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-    ACTIONS(179), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(177), 17,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-  [4265] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(57), 1,
-      aux_sym_add_repeat1,
-    ACTIONS(175), 2,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-    ACTIONS(186), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(184), 17,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-  [4301] = 6,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(182), 1,
+      sym_expr,
+  [3292] = 23,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(133), 1,
-      anon_sym_LBRACK,
-    ACTIONS(137), 1,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
-    ACTIONS(188), 1,
-      anon_sym_COLON_EQ,
-    ACTIONS(139), 5,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_SLASH,
-    ACTIONS(135), 16,
-      anon_sym_SEMI,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-      anon_sym_PLUS,
+    ACTIONS(23), 1,
       anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_PERCENT,
-  [4339] = 18,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(183), 1,
+      sym_expr,
+  [3362] = 23,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(97), 1,
-      sym_relational,
-    STATE(105), 1,
-      sym_equality,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    ACTIONS(23), 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(184), 1,
+      sym_expr,
+  [3432] = 23,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-  [4400] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(179), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(177), 19,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-      anon_sym_PLUS,
-      anon_sym_DASH,
-  [4431] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(65), 1,
-      aux_sym_shift_repeat1,
-    ACTIONS(194), 2,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-    ACTIONS(192), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(190), 15,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-  [4465] = 17,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(27), 1,
+      sym__expression,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(152), 1,
+      sym_expr,
+  [3502] = 22,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(82), 1,
-      sym_shift,
-    STATE(99), 1,
-      sym_relational,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    ACTIONS(23), 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(30), 1,
+      sym__expression,
+  [3569] = 22,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-  [4523] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(64), 1,
-      aux_sym_shift_repeat1,
-    ACTIONS(200), 2,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-    ACTIONS(198), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(196), 15,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-  [4557] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(64), 1,
-      aux_sym_shift_repeat1,
-    ACTIONS(194), 2,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-    ACTIONS(205), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(203), 15,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-  [4591] = 16,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(31), 1,
+      sym__expression,
+  [3636] = 22,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(62), 1,
-      sym_add,
-    STATE(86), 1,
-      sym_shift,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    ACTIONS(23), 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(32), 1,
+      sym__expression,
+  [3703] = 22,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-  [4646] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(198), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(196), 17,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_LT_LT,
-      anon_sym_GT_GT,
-  [4675] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(207), 8,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(33), 1,
+      sym__expression,
+  [3770] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(203), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(209), 12,
+      sym_str,
+    ACTIONS(205), 15,
       anon_sym_if,
       anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [4703] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(71), 1,
-      aux_sym_relational_repeat1,
-    ACTIONS(213), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(215), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(217), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(211), 13,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-  [4737] = 15,
+  [3799] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(9), 1,
+    ACTIONS(203), 6,
       anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      anon_sym_not,
-    ACTIONS(27), 1,
-      sym_identifier,
-    ACTIONS(31), 1,
-      sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(55), 1,
-      sym_mul,
-    STATE(67), 1,
-      sym_add,
-    ACTIONS(33), 2,
-      anon_sym_true,
-      anon_sym_false,
-    ACTIONS(23), 3,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-    ACTIONS(29), 4,
-      sym_str,
       sym_char,
+      sym_str,
+    ACTIONS(205), 15,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
       sym_hex,
       sym_bits,
-  [4789] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(71), 1,
-      aux_sym_relational_repeat1,
-    ACTIONS(221), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(223), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(226), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(219), 13,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-  [4823] = 4,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [3828] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(233), 1,
-      anon_sym_else,
-    ACTIONS(229), 8,
+    ACTIONS(203), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(231), 11,
+      sym_str,
+    ACTIONS(205), 15,
       anon_sym_if,
+      anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [4853] = 3,
+  [3857] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(235), 8,
+    ACTIONS(203), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(237), 12,
+      sym_str,
+    ACTIONS(205), 15,
       anon_sym_if,
       anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [4881] = 3,
+  [3886] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(239), 8,
+    ACTIONS(203), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(241), 12,
+      sym_str,
+    ACTIONS(205), 15,
       anon_sym_if,
       anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [4909] = 3,
+  [3915] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(243), 8,
+    ACTIONS(203), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(245), 12,
+      sym_str,
+    ACTIONS(205), 15,
       anon_sym_if,
       anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [4937] = 3,
+  [3944] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(247), 8,
+    ACTIONS(203), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(249), 12,
+      sym_str,
+    ACTIONS(205), 15,
       anon_sym_if,
       anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [4965] = 3,
+  [3973] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(251), 8,
+    ACTIONS(207), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(253), 12,
+      sym_str,
+    ACTIONS(209), 15,
       anon_sym_if,
       anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [4993] = 3,
+  [4002] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(255), 8,
+    ACTIONS(211), 6,
       anon_sym_LPAREN,
       anon_sym_DASH,
       anon_sym_BANG,
       anon_sym_TILDE,
-      sym_str,
       sym_char,
-      sym_hex,
-      sym_bits,
-    ACTIONS(257), 12,
+      sym_str,
+    ACTIONS(213), 15,
       anon_sym_if,
       anon_sym_else,
       anon_sym_begin,
       anon_sym_end,
       anon_sym_while,
       anon_sym_repeat,
+      anon_sym_until,
       anon_sym_break,
       anon_sym_not,
       sym_identifier,
+      sym_hex,
+      sym_bits,
       sym_dec,
       anon_sym_true,
       anon_sym_false,
-  [5021] = 3,
+  [4031] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(259), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
       sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(34), 1,
+      sym__expression,
+  [4098] = 22,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(261), 12,
-      anon_sym_if,
-      anon_sym_else,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(35), 1,
+      sym__expression,
+  [4165] = 22,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
       anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
       sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5049] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(36), 1,
+      sym__expression,
+  [4232] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(263), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
       sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(37), 1,
+      sym__expression,
+  [4299] = 22,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(265), 12,
-      anon_sym_if,
-      anon_sym_else,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(38), 1,
+      sym__expression,
+  [4366] = 22,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
       anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
       sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5077] = 4,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(39), 1,
+      sym__expression,
+  [4433] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(267), 1,
-      anon_sym_else,
-    ACTIONS(229), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(231), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5107] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(69), 1,
-      aux_sym_relational_repeat1,
-    ACTIONS(215), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(217), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(271), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(269), 13,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-  [5141] = 14,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(40), 1,
+      sym__expression,
+  [4500] = 22,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(45), 1,
-      sym_unary,
-    STATE(61), 1,
-      sym_mul,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
+    ACTIONS(45), 1,
       sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [5190] = 3,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(41), 1,
+      sym__expression,
+  [4567] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(243), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(245), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5217] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(42), 1,
+      sym__expression,
+  [4634] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(255), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(257), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5244] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(221), 4,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(219), 15,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-  [5271] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(43), 1,
+      sym__expression,
+  [4701] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(259), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(261), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5298] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(44), 1,
+      sym__expression,
+  [4768] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(263), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(265), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5325] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(45), 1,
+      sym__expression,
+  [4835] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(207), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(209), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5352] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(46), 1,
+      sym__expression,
+  [4902] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(239), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(241), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5379] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(47), 1,
+      sym__expression,
+  [4969] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(251), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(253), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5406] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(48), 1,
+      sym__expression,
+  [5036] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(247), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(249), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5433] = 3,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(49), 1,
+      sym__expression,
+  [5103] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(235), 8,
+    ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
       anon_sym_DASH,
+    ACTIONS(25), 1,
       anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
       anon_sym_TILDE,
-      sym_str,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
       sym_char,
+    ACTIONS(35), 1,
       sym_hex,
+    ACTIONS(37), 1,
       sym_bits,
-    ACTIONS(237), 11,
-      anon_sym_if,
-      anon_sym_begin,
-      anon_sym_end,
-      anon_sym_while,
-      anon_sym_repeat,
-      anon_sym_break,
-      anon_sym_not,
-      sym_identifier,
+    ACTIONS(39), 1,
       sym_dec,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-  [5460] = 13,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(50), 1,
+      sym__expression,
+  [5170] = 22,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(51), 1,
-      sym_unary,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
+    ACTIONS(45), 1,
       sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [5506] = 13,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(51), 1,
+      sym__expression,
+  [5237] = 22,
     ACTIONS(3), 1,
       sym_comment,
     ACTIONS(9), 1,
       anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
     ACTIONS(25), 1,
-      anon_sym_not,
+      anon_sym_BANG,
     ACTIONS(27), 1,
-      sym_identifier,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
     ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
       sym_dec,
-    STATE(38), 1,
-      sym_primary,
-    STATE(39), 1,
-      sym_literal,
-    STATE(43), 1,
-      sym_bool,
-    STATE(44), 1,
-      sym_postfix,
-    STATE(50), 1,
-      sym_unary,
-    ACTIONS(33), 2,
+    ACTIONS(41), 1,
       anon_sym_true,
+    ACTIONS(43), 1,
       anon_sym_false,
-    ACTIONS(23), 3,
-      anon_sym_DASH,
-      anon_sym_BANG,
-      anon_sym_TILDE,
-    ACTIONS(29), 4,
+    ACTIONS(45), 1,
       sym_str,
-      sym_char,
-      sym_hex,
-      sym_bits,
-  [5552] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(98), 1,
-      aux_sym_equality_repeat1,
-    ACTIONS(275), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(277), 2,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(273), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5580] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(96), 1,
-      aux_sym_equality_repeat1,
-    ACTIONS(277), 2,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(281), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(279), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5608] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    STATE(98), 1,
-      aux_sym_equality_repeat1,
-    ACTIONS(285), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(287), 2,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(283), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5636] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(285), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(283), 13,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-      anon_sym_EQ,
-      anon_sym_BANG_EQ,
-  [5659] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(292), 1,
-      anon_sym_PIPE,
-    ACTIONS(294), 1,
-      anon_sym_AMP,
-    STATE(100), 1,
-      aux_sym_bitwise_and_repeat1,
-    ACTIONS(290), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5685] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(299), 1,
-      anon_sym_PIPE,
-    ACTIONS(301), 1,
-      anon_sym_AMP,
-    STATE(102), 1,
-      aux_sym_bitwise_and_repeat1,
-    ACTIONS(297), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5711] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(301), 1,
-      anon_sym_AMP,
-    ACTIONS(305), 1,
-      anon_sym_PIPE,
-    STATE(100), 1,
-      aux_sym_bitwise_and_repeat1,
-    ACTIONS(303), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5737] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(309), 1,
-      anon_sym_PIPE,
-    ACTIONS(311), 1,
-      anon_sym_CARET,
-    STATE(106), 1,
-      aux_sym_bitwise_xor_repeat1,
-    ACTIONS(307), 10,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [5762] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(315), 1,
-      anon_sym_PIPE,
-    ACTIONS(317), 1,
-      anon_sym_CARET,
-    STATE(104), 1,
-      aux_sym_bitwise_xor_repeat1,
-    ACTIONS(313), 10,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [5787] = 3,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(52), 1,
+      sym__expression,
+  [5304] = 22,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(292), 2,
-      anon_sym_PIPE,
-      anon_sym_AMP,
-    ACTIONS(290), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5808] = 5,
+    ACTIONS(9), 1,
+      anon_sym_LPAREN,
+    ACTIONS(23), 1,
+      anon_sym_DASH,
+    ACTIONS(25), 1,
+      anon_sym_BANG,
+    ACTIONS(27), 1,
+      anon_sym_not,
+    ACTIONS(29), 1,
+      anon_sym_TILDE,
+    ACTIONS(31), 1,
+      sym_identifier,
+    ACTIONS(33), 1,
+      sym_char,
+    ACTIONS(35), 1,
+      sym_hex,
+    ACTIONS(37), 1,
+      sym_bits,
+    ACTIONS(39), 1,
+      sym_dec,
+    ACTIONS(41), 1,
+      anon_sym_true,
+    ACTIONS(43), 1,
+      anon_sym_false,
+    ACTIONS(45), 1,
+      sym_str,
+    STATE(17), 1,
+      sym_parenthesized_expression,
+    STATE(18), 1,
+      sym_postfix,
+    STATE(19), 1,
+      sym_bool,
+    STATE(20), 1,
+      sym_literal,
+    STATE(26), 1,
+      sym__operand,
+    STATE(28), 1,
+      sym_binary_expression,
+    STATE(29), 1,
+      sym_unary_expression,
+    STATE(53), 1,
+      sym__expression,
+  [5371] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(311), 1,
-      anon_sym_CARET,
-    ACTIONS(322), 1,
-      anon_sym_PIPE,
-    STATE(104), 1,
-      aux_sym_bitwise_xor_repeat1,
-    ACTIONS(320), 10,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [5833] = 3,
+    ACTIONS(219), 1,
+      anon_sym_else,
+    ACTIONS(215), 6,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(217), 14,
+      anon_sym_if,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [5402] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(315), 1,
-      anon_sym_PIPE,
-    ACTIONS(313), 11,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-      anon_sym_CARET,
-  [5853] = 4,
+    ACTIONS(221), 6,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(223), 15,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [5431] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(326), 1,
-      anon_sym_PIPE,
-    STATE(108), 1,
-      aux_sym_bitwise_or_repeat1,
-    ACTIONS(324), 10,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [5875] = 4,
+    ACTIONS(225), 6,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(227), 15,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [5460] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(331), 1,
-      anon_sym_PIPE,
-    STATE(108), 1,
-      aux_sym_bitwise_or_repeat1,
-    ACTIONS(329), 10,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [5897] = 4,
+    ACTIONS(229), 6,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(231), 15,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [5489] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(331), 1,
-      anon_sym_PIPE,
-    STATE(109), 1,
-      aux_sym_bitwise_or_repeat1,
-    ACTIONS(333), 10,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [5919] = 3,
+    ACTIONS(229), 6,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(231), 15,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [5518] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(335), 1,
-      anon_sym_PIPE,
-    ACTIONS(324), 10,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [5938] = 4,
+    ACTIONS(233), 6,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(235), 15,
+      anon_sym_if,
+      anon_sym_else,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_until,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [5547] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    STATE(112), 1,
-      aux_sym_logical_and_repeat1,
-    ACTIONS(339), 2,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-    ACTIONS(337), 8,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-  [5959] = 4,
+    ACTIONS(237), 6,
+      anon_sym_LPAREN,
+      anon_sym_DASH,
+      anon_sym_BANG,
+      anon_sym_TILDE,
+      sym_char,
+      sym_str,
+    ACTIONS(239), 13,
+      anon_sym_if,
+      anon_sym_begin,
+      anon_sym_end,
+      anon_sym_while,
+      anon_sym_repeat,
+      anon_sym_break,
+      anon_sym_not,
+      sym_identifier,
+      sym_hex,
+      sym_bits,
+      sym_dec,
+      anon_sym_true,
+      anon_sym_false,
+  [5574] = 12,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(344), 1,
-      anon_sym_array,
-    STATE(135), 1,
-      sym_typeRef,
-    ACTIONS(342), 9,
+    ACTIONS(241), 1,
       anon_sym_bool,
+    ACTIONS(243), 1,
       anon_sym_byte,
+    ACTIONS(245), 1,
       anon_sym_int,
+    ACTIONS(247), 1,
       anon_sym_uint,
+    ACTIONS(249), 1,
       anon_sym_long,
+    ACTIONS(251), 1,
       anon_sym_ulong,
+    ACTIONS(253), 1,
       anon_sym_char,
+    ACTIONS(255), 1,
       anon_sym_string,
+    ACTIONS(257), 1,
+      anon_sym_array,
+    ACTIONS(259), 1,
       sym_identifier,
-  [5980] = 4,
+    STATE(145), 1,
+      sym_typeRef,
+  [5611] = 12,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(344), 1,
-      anon_sym_array,
-    STATE(133), 1,
-      sym_typeRef,
-    ACTIONS(342), 9,
+    ACTIONS(241), 1,
       anon_sym_bool,
+    ACTIONS(243), 1,
       anon_sym_byte,
+    ACTIONS(245), 1,
       anon_sym_int,
+    ACTIONS(247), 1,
       anon_sym_uint,
+    ACTIONS(249), 1,
       anon_sym_long,
+    ACTIONS(251), 1,
       anon_sym_ulong,
+    ACTIONS(253), 1,
       anon_sym_char,
+    ACTIONS(255), 1,
       anon_sym_string,
+    ACTIONS(257), 1,
+      anon_sym_array,
+    ACTIONS(259), 1,
       sym_identifier,
-  [6001] = 4,
+    STATE(164), 1,
+      sym_typeRef,
+  [5648] = 12,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(344), 1,
-      anon_sym_array,
-    STATE(151), 1,
-      sym_typeRef,
-    ACTIONS(342), 9,
+    ACTIONS(241), 1,
       anon_sym_bool,
+    ACTIONS(243), 1,
       anon_sym_byte,
+    ACTIONS(245), 1,
       anon_sym_int,
+    ACTIONS(247), 1,
       anon_sym_uint,
+    ACTIONS(249), 1,
       anon_sym_long,
+    ACTIONS(251), 1,
       anon_sym_ulong,
+    ACTIONS(253), 1,
       anon_sym_char,
+    ACTIONS(255), 1,
       anon_sym_string,
+    ACTIONS(257), 1,
+      anon_sym_array,
+    ACTIONS(259), 1,
       sym_identifier,
-  [6022] = 4,
+    STATE(179), 1,
+      sym_typeRef,
+  [5685] = 12,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(344), 1,
-      anon_sym_array,
-    STATE(170), 1,
-      sym_typeRef,
-    ACTIONS(342), 9,
+    ACTIONS(241), 1,
       anon_sym_bool,
+    ACTIONS(243), 1,
       anon_sym_byte,
+    ACTIONS(245), 1,
       anon_sym_int,
+    ACTIONS(247), 1,
       anon_sym_uint,
+    ACTIONS(249), 1,
       anon_sym_long,
+    ACTIONS(251), 1,
       anon_sym_ulong,
+    ACTIONS(253), 1,
       anon_sym_char,
+    ACTIONS(255), 1,
       anon_sym_string,
+    ACTIONS(257), 1,
+      anon_sym_array,
+    ACTIONS(259), 1,
       sym_identifier,
-  [6043] = 4,
+    STATE(149), 1,
+      sym_typeRef,
+  [5722] = 12,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(344), 1,
-      anon_sym_array,
-    STATE(163), 1,
-      sym_typeRef,
-    ACTIONS(342), 9,
+    ACTIONS(241), 1,
       anon_sym_bool,
+    ACTIONS(243), 1,
       anon_sym_byte,
+    ACTIONS(245), 1,
       anon_sym_int,
+    ACTIONS(247), 1,
       anon_sym_uint,
+    ACTIONS(249), 1,
       anon_sym_long,
+    ACTIONS(251), 1,
       anon_sym_ulong,
+    ACTIONS(253), 1,
       anon_sym_char,
+    ACTIONS(255), 1,
       anon_sym_string,
+    ACTIONS(257), 1,
+      anon_sym_array,
+    ACTIONS(259), 1,
       sym_identifier,
-  [6064] = 4,
+    STATE(127), 1,
+      sym_typeRef,
+  [5759] = 12,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(344), 1,
-      anon_sym_array,
-    STATE(197), 1,
-      sym_typeRef,
-    ACTIONS(342), 9,
+    ACTIONS(241), 1,
       anon_sym_bool,
+    ACTIONS(243), 1,
       anon_sym_byte,
+    ACTIONS(245), 1,
       anon_sym_int,
+    ACTIONS(247), 1,
       anon_sym_uint,
+    ACTIONS(249), 1,
       anon_sym_long,
+    ACTIONS(251), 1,
       anon_sym_ulong,
+    ACTIONS(253), 1,
       anon_sym_char,
+    ACTIONS(255), 1,
       anon_sym_string,
+    ACTIONS(257), 1,
+      anon_sym_array,
+    ACTIONS(259), 1,
       sym_identifier,
-  [6085] = 4,
+    STATE(128), 1,
+      sym_typeRef,
+  [5796] = 7,
     ACTIONS(3), 1,
       sym_comment,
-    STATE(112), 1,
-      aux_sym_logical_and_repeat1,
-    ACTIONS(348), 2,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-    ACTIONS(346), 8,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
+    ACTIONS(13), 1,
+      anon_sym_begin,
+    ACTIONS(261), 1,
       anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-  [6106] = 4,
+    ACTIONS(263), 1,
+      anon_sym_var,
+    STATE(130), 1,
+      aux_sym_body_repeat2,
+    STATE(158), 1,
+      sym_body,
+    STATE(159), 1,
+      sym_block,
+  [5818] = 6,
     ACTIONS(3), 1,
       sym_comment,
-    STATE(119), 1,
-      aux_sym_logical_and_repeat1,
-    ACTIONS(348), 2,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-    ACTIONS(350), 8,
-      anon_sym_COMMA,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-  [6127] = 2,
+    ACTIONS(267), 1,
+      sym_identifier,
+    STATE(114), 1,
+      aux_sym_body_repeat1,
+    STATE(141), 1,
+      sym_varDecl,
+    STATE(160), 1,
+      sym_idList,
+    ACTIONS(265), 2,
+      anon_sym_var,
+      anon_sym_begin,
+  [5838] = 6,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(267), 1,
+      sym_identifier,
+    STATE(115), 1,
+      aux_sym_body_repeat1,
+    STATE(141), 1,
+      sym_varDecl,
+    STATE(160), 1,
+      sym_idList,
+    ACTIONS(269), 2,
+      anon_sym_var,
+      anon_sym_begin,
+  [5858] = 6,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(273), 1,
+      sym_identifier,
+    STATE(115), 1,
+      aux_sym_body_repeat1,
+    STATE(141), 1,
+      sym_varDecl,
+    STATE(160), 1,
+      sym_idList,
+    ACTIONS(271), 2,
+      anon_sym_var,
+      anon_sym_begin,
+  [5878] = 6,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(7), 1,
+      anon_sym_method,
+    ACTIONS(276), 1,
+      ts_builtin_sym_end,
+    STATE(117), 1,
+      aux_sym_source_file_repeat1,
+    STATE(155), 1,
+      sym_sourceItem,
+    STATE(156), 1,
+      sym_funcDef,
+  [5897] = 6,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(278), 1,
+      ts_builtin_sym_end,
+    ACTIONS(280), 1,
+      anon_sym_method,
+    STATE(117), 1,
+      aux_sym_source_file_repeat1,
+    STATE(155), 1,
+      sym_sourceItem,
+    STATE(156), 1,
+      sym_funcDef,
+  [5916] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(337), 10,
+    ACTIONS(285), 2,
+      anon_sym_var,
+      anon_sym_begin,
+    ACTIONS(283), 3,
       anon_sym_COMMA,
-      anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-      anon_sym_AMP_AMP,
-      anon_sym_and,
-  [6143] = 4,
+  [5929] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    STATE(122), 1,
-      aux_sym_logical_or_repeat1,
-    ACTIONS(354), 2,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-    ACTIONS(352), 6,
+    ACTIONS(285), 2,
+      anon_sym_var,
+      anon_sym_begin,
+    ACTIONS(283), 3,
       anon_sym_COMMA,
-      anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-  [6162] = 4,
+  [5942] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    STATE(122), 1,
-      aux_sym_logical_or_repeat1,
-    ACTIONS(359), 2,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-    ACTIONS(357), 6,
+    ACTIONS(285), 2,
+      anon_sym_var,
+      anon_sym_begin,
+    ACTIONS(283), 3,
       anon_sym_COMMA,
-      anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-  [6181] = 4,
+  [5955] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    STATE(123), 1,
-      aux_sym_logical_or_repeat1,
-    ACTIONS(359), 2,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-    ACTIONS(361), 6,
+    ACTIONS(285), 2,
+      anon_sym_var,
+      anon_sym_begin,
+    ACTIONS(283), 3,
       anon_sym_COMMA,
-      anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-  [6200] = 2,
+  [5968] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(352), 8,
+    ACTIONS(285), 2,
+      anon_sym_var,
+      anon_sym_begin,
+    ACTIONS(283), 3,
       anon_sym_COMMA,
-      anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-      anon_sym_PIPE_PIPE,
-      anon_sym_or,
-  [6214] = 7,
+  [5981] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(363), 1,
-      anon_sym_SEMI,
-    ACTIONS(365), 1,
+    ACTIONS(285), 2,
       anon_sym_var,
-    ACTIONS(367), 1,
       anon_sym_begin,
-    STATE(141), 1,
-      aux_sym_body_repeat2,
-    STATE(174), 1,
-      sym_body,
-    STATE(179), 1,
-      sym_block,
-  [6236] = 5,
+    ACTIONS(283), 3,
+      anon_sym_COMMA,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+  [5994] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(371), 1,
-      sym_identifier,
-    STATE(180), 1,
-      sym_idList,
-    ACTIONS(369), 2,
+    ACTIONS(285), 2,
       anon_sym_var,
       anon_sym_begin,
-    STATE(127), 2,
-      sym_varDecl,
-      aux_sym_body_repeat1,
-  [6254] = 5,
+    ACTIONS(283), 3,
+      anon_sym_COMMA,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+  [6007] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(376), 1,
-      sym_identifier,
-    STATE(180), 1,
-      sym_idList,
-    ACTIONS(374), 2,
+    ACTIONS(285), 2,
       anon_sym_var,
       anon_sym_begin,
-    STATE(127), 2,
-      sym_varDecl,
-      aux_sym_body_repeat1,
-  [6272] = 5,
+    ACTIONS(283), 3,
+      anon_sym_COMMA,
+      anon_sym_RPAREN,
+      anon_sym_SEMI,
+  [6020] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(376), 1,
-      sym_identifier,
-    STATE(180), 1,
-      sym_idList,
-    ACTIONS(378), 2,
+    ACTIONS(285), 2,
       anon_sym_var,
       anon_sym_begin,
-    STATE(128), 2,
-      sym_varDecl,
-      aux_sym_body_repeat1,
-  [6290] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(380), 6,
+    ACTIONS(283), 3,
       anon_sym_COMMA,
-      anon_sym_RBRACK,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_then,
-      anon_sym_do,
-  [6302] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(251), 5,
-      ts_builtin_sym_end,
-      anon_sym_method,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6313] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(7), 1,
-      anon_sym_method,
-    ACTIONS(382), 1,
-      ts_builtin_sym_end,
-    STATE(171), 1,
-      sym_funcDef,
-    STATE(134), 2,
-      sym_sourceItem,
-      aux_sym_source_file_repeat1,
-  [6330] = 2,
+  [6033] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(384), 5,
+    ACTIONS(289), 2,
+      anon_sym_var,
+      anon_sym_begin,
+    ACTIONS(287), 3,
       anon_sym_COMMA,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_var,
-      anon_sym_begin,
-  [6341] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(386), 1,
-      ts_builtin_sym_end,
-    ACTIONS(388), 1,
-      anon_sym_method,
-    STATE(171), 1,
-      sym_funcDef,
-    STATE(134), 2,
-      sym_sourceItem,
-      aux_sym_source_file_repeat1,
-  [6358] = 2,
+  [6046] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(391), 5,
+    ACTIONS(293), 2,
+      anon_sym_var,
+      anon_sym_begin,
+    ACTIONS(291), 3,
       anon_sym_COMMA,
       anon_sym_RPAREN,
       anon_sym_SEMI,
-      anon_sym_var,
-      anon_sym_begin,
-  [6369] = 2,
+  [6059] = 5,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(239), 5,
-      ts_builtin_sym_end,
-      anon_sym_method,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6380] = 2,
+    ACTIONS(295), 1,
+      anon_sym_RPAREN,
+    ACTIONS(297), 1,
+      sym_identifier,
+    STATE(140), 1,
+      sym_argDef,
+    STATE(169), 1,
+      sym_argList,
+  [6075] = 5,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(393), 5,
-      anon_sym_COMMA,
-      anon_sym_RPAREN,
-      anon_sym_SEMI,
-      anon_sym_var,
+    ACTIONS(13), 1,
       anon_sym_begin,
-  [6391] = 4,
+    ACTIONS(263), 1,
+      anon_sym_var,
+    STATE(142), 1,
+      aux_sym_body_repeat2,
+    STATE(161), 1,
+      sym_block,
+  [6091] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(395), 1,
-      anon_sym_COMMA,
-    STATE(139), 1,
-      aux_sym_idList_repeat1,
-    ACTIONS(397), 2,
+    ACTIONS(299), 1,
       anon_sym_COLON,
+    ACTIONS(301), 1,
       anon_sym_SEMI,
-  [6405] = 4,
+    ACTIONS(303), 2,
+      anon_sym_var,
+      anon_sym_begin,
+  [6105] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(395), 1,
+    ACTIONS(305), 1,
       anon_sym_COMMA,
-    STATE(147), 1,
+    STATE(134), 1,
       aux_sym_idList_repeat1,
-    ACTIONS(399), 2,
+    ACTIONS(307), 2,
       anon_sym_COLON,
       anon_sym_SEMI,
-  [6419] = 3,
+  [6119] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(401), 1,
+    ACTIONS(309), 1,
       anon_sym_COLON,
-    ACTIONS(403), 3,
+    ACTIONS(311), 1,
       anon_sym_SEMI,
+    ACTIONS(313), 2,
       anon_sym_var,
       anon_sym_begin,
-  [6431] = 5,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(365), 1,
-      anon_sym_var,
-    ACTIONS(367), 1,
-      anon_sym_begin,
-    STATE(162), 1,
-      aux_sym_body_repeat2,
-    STATE(172), 1,
-      sym_block,
-  [6447] = 4,
+  [6133] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(405), 1,
+    ACTIONS(305), 1,
       anon_sym_COMMA,
-    STATE(142), 1,
-      aux_sym_exprList_repeat1,
-    ACTIONS(408), 2,
-      anon_sym_RBRACK,
-      anon_sym_RPAREN,
-  [6461] = 3,
+    STATE(135), 1,
+      aux_sym_idList_repeat1,
+    ACTIONS(315), 2,
+      anon_sym_COLON,
+      anon_sym_SEMI,
+  [6147] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(410), 1,
+    ACTIONS(317), 1,
+      anon_sym_COMMA,
+    STATE(135), 1,
+      aux_sym_idList_repeat1,
+    ACTIONS(320), 2,
       anon_sym_COLON,
-    ACTIONS(412), 3,
       anon_sym_SEMI,
-      anon_sym_var,
-      anon_sym_begin,
-  [6473] = 5,
+  [6161] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(414), 1,
+    ACTIONS(322), 1,
+      anon_sym_COMMA,
+    STATE(137), 1,
+      aux_sym_exprList_repeat1,
+    ACTIONS(324), 2,
+      anon_sym_RBRACK,
       anon_sym_RPAREN,
-    ACTIONS(416), 1,
-      sym_identifier,
-    STATE(160), 1,
-      sym_argDef,
-    STATE(184), 1,
-      sym_argList,
-  [6489] = 4,
+  [6175] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(418), 1,
+    ACTIONS(322), 1,
       anon_sym_COMMA,
-    STATE(146), 1,
+    STATE(138), 1,
       aux_sym_exprList_repeat1,
-    ACTIONS(420), 2,
+    ACTIONS(326), 2,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
-  [6503] = 4,
+  [6189] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(418), 1,
+    ACTIONS(328), 1,
       anon_sym_COMMA,
-    STATE(142), 1,
+    STATE(138), 1,
       aux_sym_exprList_repeat1,
-    ACTIONS(422), 2,
+    ACTIONS(331), 2,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
-  [6517] = 4,
+  [6203] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(424), 1,
-      anon_sym_COMMA,
-    STATE(147), 1,
-      aux_sym_idList_repeat1,
-    ACTIONS(427), 2,
+    ACTIONS(335), 1,
       anon_sym_COLON,
-      anon_sym_SEMI,
-  [6531] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(429), 1,
+    ACTIONS(333), 2,
       anon_sym_COMMA,
-    ACTIONS(431), 1,
-      anon_sym_RBRACK,
-    STATE(166), 1,
-      aux_sym_typeRef_repeat1,
-  [6544] = 4,
+      anon_sym_RPAREN,
+  [6214] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(433), 1,
+    ACTIONS(337), 1,
       anon_sym_COMMA,
-    ACTIONS(436), 1,
-      anon_sym_RBRACK,
-    STATE(149), 1,
-      aux_sym_typeRef_repeat1,
-  [6557] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(235), 3,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6566] = 2,
+    ACTIONS(339), 1,
+      anon_sym_RPAREN,
+    STATE(143), 1,
+      aux_sym_argList_repeat1,
+  [6227] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(438), 3,
-      anon_sym_SEMI,
+    ACTIONS(341), 3,
       anon_sym_var,
       anon_sym_begin,
-  [6575] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(243), 3,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6584] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(247), 3,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6593] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(440), 1,
-      anon_sym_else,
-    ACTIONS(229), 2,
-      anon_sym_while,
-      anon_sym_until,
-  [6604] = 2,
+      sym_identifier,
+  [6236] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(255), 3,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6613] = 2,
+    ACTIONS(269), 1,
+      anon_sym_begin,
+    ACTIONS(343), 1,
+      anon_sym_var,
+    STATE(142), 1,
+      aux_sym_body_repeat2,
+  [6249] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(259), 3,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6622] = 2,
+    ACTIONS(337), 1,
+      anon_sym_COMMA,
+    ACTIONS(346), 1,
+      anon_sym_RPAREN,
+    STATE(146), 1,
+      aux_sym_argList_repeat1,
+  [6262] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(263), 3,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6631] = 2,
+    ACTIONS(348), 3,
+      anon_sym_var,
+      anon_sym_begin,
+      sym_identifier,
+  [6271] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(207), 3,
-      anon_sym_else,
-      anon_sym_while,
-      anon_sym_until,
-  [6640] = 4,
+    ACTIONS(350), 1,
+      anon_sym_SEMI,
+    ACTIONS(352), 2,
+      anon_sym_var,
+      anon_sym_begin,
+  [6282] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(442), 1,
+    ACTIONS(354), 1,
       anon_sym_COMMA,
-    ACTIONS(445), 1,
+    ACTIONS(357), 1,
       anon_sym_RPAREN,
-    STATE(159), 1,
+    STATE(146), 1,
       aux_sym_argList_repeat1,
-  [6653] = 4,
+  [6295] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(447), 1,
+    ACTIONS(320), 3,
       anon_sym_COMMA,
-    ACTIONS(449), 1,
-      anon_sym_RPAREN,
-    STATE(165), 1,
-      aux_sym_argList_repeat1,
-  [6666] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(451), 3,
-      anon_sym_var,
-      anon_sym_begin,
-      sym_identifier,
-  [6675] = 4,
+      anon_sym_COLON,
+      anon_sym_SEMI,
+  [6304] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(453), 1,
-      anon_sym_var,
-    ACTIONS(456), 1,
-      anon_sym_begin,
-    STATE(162), 1,
-      aux_sym_body_repeat2,
-  [6688] = 2,
+    ACTIONS(359), 1,
+      anon_sym_COMMA,
+    ACTIONS(361), 1,
+      anon_sym_RBRACK,
+    STATE(151), 1,
+      aux_sym_typeRef_repeat1,
+  [6317] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(458), 3,
+    ACTIONS(363), 1,
       anon_sym_SEMI,
+    ACTIONS(365), 2,
       anon_sym_var,
       anon_sym_begin,
-  [6697] = 2,
+  [6328] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(460), 3,
+    ACTIONS(367), 3,
       anon_sym_var,
       anon_sym_begin,
       sym_identifier,
-  [6706] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(447), 1,
-      anon_sym_COMMA,
-    ACTIONS(462), 1,
-      anon_sym_RPAREN,
-    STATE(159), 1,
-      aux_sym_argList_repeat1,
-  [6719] = 4,
+  [6337] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(464), 1,
+    ACTIONS(359), 1,
       anon_sym_COMMA,
-    ACTIONS(466), 1,
+    ACTIONS(369), 1,
       anon_sym_RBRACK,
-    STATE(149), 1,
+    STATE(153), 1,
       aux_sym_typeRef_repeat1,
-  [6732] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(470), 1,
-      anon_sym_COLON,
-    ACTIONS(468), 2,
-      anon_sym_COMMA,
-      anon_sym_RPAREN,
-  [6743] = 2,
+  [6350] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(408), 3,
+    ACTIONS(331), 3,
       anon_sym_COMMA,
       anon_sym_RBRACK,
       anon_sym_RPAREN,
-  [6752] = 2,
+  [6359] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(427), 3,
+    ACTIONS(371), 1,
       anon_sym_COMMA,
-      anon_sym_COLON,
-      anon_sym_SEMI,
-  [6761] = 2,
+    ACTIONS(374), 1,
+      anon_sym_RBRACK,
+    STATE(153), 1,
+      aux_sym_typeRef_repeat1,
+  [6372] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(472), 2,
-      anon_sym_COMMA,
-      anon_sym_RPAREN,
-  [6769] = 2,
+    ACTIONS(376), 1,
+      sym_identifier,
+    STATE(112), 1,
+      sym_funcSignature,
+  [6382] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(474), 2,
+    ACTIONS(378), 2,
       ts_builtin_sym_end,
       anon_sym_method,
-  [6777] = 2,
+  [6390] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(476), 2,
+    ACTIONS(380), 2,
       ts_builtin_sym_end,
       anon_sym_method,
-  [6785] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(478), 1,
-      sym_identifier,
-    STATE(126), 1,
-      sym_funcSignature,
-  [6795] = 2,
+  [6398] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(480), 2,
+    ACTIONS(382), 2,
       ts_builtin_sym_end,
       anon_sym_method,
-  [6803] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(482), 2,
-      anon_sym_while,
-      anon_sym_until,
-  [6811] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(484), 2,
-      anon_sym_while,
-      anon_sym_until,
-  [6819] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(445), 2,
-      anon_sym_COMMA,
-      anon_sym_RPAREN,
-  [6827] = 2,
+  [6406] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(486), 2,
-      anon_sym_while,
-      anon_sym_until,
-  [6835] = 2,
+    ACTIONS(384), 2,
+      ts_builtin_sym_end,
+      anon_sym_method,
+  [6414] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(488), 2,
+    ACTIONS(386), 2,
       ts_builtin_sym_end,
       anon_sym_method,
-  [6843] = 3,
+  [6422] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(490), 1,
+    ACTIONS(388), 1,
       anon_sym_COLON,
-    ACTIONS(492), 1,
+    ACTIONS(390), 1,
       anon_sym_SEMI,
-  [6853] = 3,
+  [6432] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(416), 1,
+    ACTIONS(392), 2,
+      ts_builtin_sym_end,
+      anon_sym_method,
+  [6440] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(297), 1,
       sym_identifier,
-    STATE(177), 1,
+    STATE(165), 1,
       sym_argDef,
-  [6863] = 2,
+  [6450] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(494), 1,
-      anon_sym_SEMI,
-  [6870] = 2,
+    ACTIONS(394), 1,
+      anon_sym_while,
+    ACTIONS(396), 1,
+      anon_sym_until,
+  [6460] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(496), 1,
-      anon_sym_SEMI,
-  [6877] = 2,
+    ACTIONS(398), 2,
+      anon_sym_COMMA,
+      anon_sym_RPAREN,
+  [6468] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(498), 1,
+    ACTIONS(357), 2,
+      anon_sym_COMMA,
       anon_sym_RPAREN,
-  [6884] = 2,
+  [6476] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(500), 1,
-      anon_sym_SEMI,
-  [6891] = 2,
+    ACTIONS(400), 2,
+      anon_sym_COMMA,
+      anon_sym_RBRACK,
+  [6484] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(502), 1,
-      anon_sym_SEMI,
-  [6898] = 2,
+    ACTIONS(402), 1,
+      ts_builtin_sym_end,
+  [6491] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(504), 1,
-      anon_sym_SEMI,
-  [6905] = 2,
+    ACTIONS(404), 1,
+      anon_sym_LPAREN,
+  [6498] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(506), 1,
-      anon_sym_SEMI,
-  [6912] = 2,
+    ACTIONS(406), 1,
+      anon_sym_RPAREN,
+  [6505] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(508), 1,
+    ACTIONS(408), 1,
       anon_sym_SEMI,
-  [6919] = 2,
+  [6512] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(510), 1,
+    ACTIONS(410), 1,
       anon_sym_SEMI,
-  [6926] = 2,
+  [6519] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(512), 1,
+    ACTIONS(412), 1,
       anon_sym_SEMI,
-  [6933] = 2,
+  [6526] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(514), 1,
-      anon_sym_LPAREN,
-  [6940] = 2,
+    ACTIONS(414), 1,
+      sym_identifier,
+  [6533] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(516), 1,
-      anon_sym_of,
-  [6947] = 2,
+    ACTIONS(416), 1,
+      anon_sym_RPAREN,
+  [6540] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(518), 1,
+    ACTIONS(418), 1,
       anon_sym_then,
-  [6954] = 2,
+  [6547] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(520), 1,
+    ACTIONS(420), 1,
       anon_sym_do,
-  [6961] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(522), 1,
-      ts_builtin_sym_end,
-  [6968] = 2,
+  [6554] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(524), 1,
+    ACTIONS(422), 1,
       anon_sym_SEMI,
-  [6975] = 2,
+  [6561] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(526), 1,
-      anon_sym_SEMI,
-  [6982] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(528), 1,
+    ACTIONS(424), 1,
       anon_sym_LBRACK,
-  [6989] = 2,
+  [6568] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(530), 1,
+    ACTIONS(426), 1,
       anon_sym_SEMI,
-  [6996] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(532), 1,
-      anon_sym_do,
-  [7003] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(534), 1,
-      anon_sym_RPAREN,
-  [7010] = 2,
+  [6575] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(536), 1,
+    ACTIONS(428), 1,
       anon_sym_RBRACK,
-  [7017] = 2,
+  [6582] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(538), 1,
-      anon_sym_do,
-  [7024] = 2,
+    ACTIONS(430), 1,
+      anon_sym_RPAREN,
+  [6589] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(540), 1,
+    ACTIONS(432), 1,
       anon_sym_SEMI,
-  [7031] = 2,
+  [6596] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(542), 1,
+    ACTIONS(434), 1,
       anon_sym_SEMI,
-  [7038] = 2,
+  [6603] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(544), 1,
+    ACTIONS(436), 1,
       anon_sym_SEMI,
-  [7045] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(546), 1,
-      sym_identifier,
-  [7052] = 2,
+  [6610] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(548), 1,
+    ACTIONS(438), 1,
       anon_sym_of,
-  [7059] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(550), 1,
-      anon_sym_SEMI,
-  [7066] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(552), 1,
-      anon_sym_SEMI,
-  [7073] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(554), 1,
-      anon_sym_SEMI,
-  [7080] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(556), 1,
-      anon_sym_then,
-  [7087] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(536), 1,
-      anon_sym_RPAREN,
-  [7094] = 2,
+  [6617] = 2,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(558), 1,
-      anon_sym_SEMI,
-  [7101] = 2,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(560), 1,
-      anon_sym_then,
+    ACTIONS(440), 1,
+      anon_sym_of,
 };
 
 static const uint32_t ts_small_parse_table_map[] = {
   [SMALL_STATE(2)] = 0,
-  [SMALL_STATE(3)] = 111,
-  [SMALL_STATE(4)] = 222,
-  [SMALL_STATE(5)] = 333,
-  [SMALL_STATE(6)] = 444,
-  [SMALL_STATE(7)] = 555,
-  [SMALL_STATE(8)] = 666,
-  [SMALL_STATE(9)] = 777,
-  [SMALL_STATE(10)] = 884,
-  [SMALL_STATE(11)] = 991,
-  [SMALL_STATE(12)] = 1098,
-  [SMALL_STATE(13)] = 1205,
-  [SMALL_STATE(14)] = 1312,
-  [SMALL_STATE(15)] = 1419,
-  [SMALL_STATE(16)] = 1526,
-  [SMALL_STATE(17)] = 1633,
-  [SMALL_STATE(18)] = 1740,
-  [SMALL_STATE(19)] = 1847,
-  [SMALL_STATE(20)] = 1954,
-  [SMALL_STATE(21)] = 2061,
-  [SMALL_STATE(22)] = 2147,
-  [SMALL_STATE(23)] = 2233,
-  [SMALL_STATE(24)] = 2313,
-  [SMALL_STATE(25)] = 2393,
-  [SMALL_STATE(26)] = 2473,
-  [SMALL_STATE(27)] = 2553,
-  [SMALL_STATE(28)] = 2633,
-  [SMALL_STATE(29)] = 2713,
-  [SMALL_STATE(30)] = 2793,
-  [SMALL_STATE(31)] = 2873,
-  [SMALL_STATE(32)] = 2953,
-  [SMALL_STATE(33)] = 3033,
-  [SMALL_STATE(34)] = 3113,
-  [SMALL_STATE(35)] = 3193,
-  [SMALL_STATE(36)] = 3273,
-  [SMALL_STATE(37)] = 3353,
-  [SMALL_STATE(38)] = 3390,
-  [SMALL_STATE(39)] = 3427,
-  [SMALL_STATE(40)] = 3464,
-  [SMALL_STATE(41)] = 3501,
-  [SMALL_STATE(42)] = 3538,
-  [SMALL_STATE(43)] = 3575,
-  [SMALL_STATE(44)] = 3612,
-  [SMALL_STATE(45)] = 3652,
-  [SMALL_STATE(46)] = 3693,
-  [SMALL_STATE(47)] = 3766,
-  [SMALL_STATE(48)] = 3807,
-  [SMALL_STATE(49)] = 3848,
-  [SMALL_STATE(50)] = 3918,
-  [SMALL_STATE(51)] = 3952,
-  [SMALL_STATE(52)] = 3986,
-  [SMALL_STATE(53)] = 4053,
-  [SMALL_STATE(54)] = 4091,
-  [SMALL_STATE(55)] = 4129,
-  [SMALL_STATE(56)] = 4165,
-  [SMALL_STATE(57)] = 4229,
-  [SMALL_STATE(58)] = 4265,
-  [SMALL_STATE(59)] = 4301,
-  [SMALL_STATE(60)] = 4339,
-  [SMALL_STATE(61)] = 4400,
-  [SMALL_STATE(62)] = 4431,
-  [SMALL_STATE(63)] = 4465,
-  [SMALL_STATE(64)] = 4523,
-  [SMALL_STATE(65)] = 4557,
-  [SMALL_STATE(66)] = 4591,
-  [SMALL_STATE(67)] = 4646,
-  [SMALL_STATE(68)] = 4675,
-  [SMALL_STATE(69)] = 4703,
-  [SMALL_STATE(70)] = 4737,
-  [SMALL_STATE(71)] = 4789,
-  [SMALL_STATE(72)] = 4823,
-  [SMALL_STATE(73)] = 4853,
-  [SMALL_STATE(74)] = 4881,
-  [SMALL_STATE(75)] = 4909,
-  [SMALL_STATE(76)] = 4937,
-  [SMALL_STATE(77)] = 4965,
-  [SMALL_STATE(78)] = 4993,
-  [SMALL_STATE(79)] = 5021,
-  [SMALL_STATE(80)] = 5049,
-  [SMALL_STATE(81)] = 5077,
-  [SMALL_STATE(82)] = 5107,
-  [SMALL_STATE(83)] = 5141,
-  [SMALL_STATE(84)] = 5190,
-  [SMALL_STATE(85)] = 5217,
-  [SMALL_STATE(86)] = 5244,
-  [SMALL_STATE(87)] = 5271,
-  [SMALL_STATE(88)] = 5298,
-  [SMALL_STATE(89)] = 5325,
-  [SMALL_STATE(90)] = 5352,
-  [SMALL_STATE(91)] = 5379,
-  [SMALL_STATE(92)] = 5406,
-  [SMALL_STATE(93)] = 5433,
-  [SMALL_STATE(94)] = 5460,
-  [SMALL_STATE(95)] = 5506,
-  [SMALL_STATE(96)] = 5552,
-  [SMALL_STATE(97)] = 5580,
-  [SMALL_STATE(98)] = 5608,
-  [SMALL_STATE(99)] = 5636,
-  [SMALL_STATE(100)] = 5659,
-  [SMALL_STATE(101)] = 5685,
-  [SMALL_STATE(102)] = 5711,
-  [SMALL_STATE(103)] = 5737,
-  [SMALL_STATE(104)] = 5762,
-  [SMALL_STATE(105)] = 5787,
-  [SMALL_STATE(106)] = 5808,
-  [SMALL_STATE(107)] = 5833,
-  [SMALL_STATE(108)] = 5853,
-  [SMALL_STATE(109)] = 5875,
-  [SMALL_STATE(110)] = 5897,
-  [SMALL_STATE(111)] = 5919,
-  [SMALL_STATE(112)] = 5938,
-  [SMALL_STATE(113)] = 5959,
-  [SMALL_STATE(114)] = 5980,
-  [SMALL_STATE(115)] = 6001,
-  [SMALL_STATE(116)] = 6022,
-  [SMALL_STATE(117)] = 6043,
-  [SMALL_STATE(118)] = 6064,
-  [SMALL_STATE(119)] = 6085,
-  [SMALL_STATE(120)] = 6106,
-  [SMALL_STATE(121)] = 6127,
-  [SMALL_STATE(122)] = 6143,
-  [SMALL_STATE(123)] = 6162,
-  [SMALL_STATE(124)] = 6181,
-  [SMALL_STATE(125)] = 6200,
-  [SMALL_STATE(126)] = 6214,
-  [SMALL_STATE(127)] = 6236,
-  [SMALL_STATE(128)] = 6254,
-  [SMALL_STATE(129)] = 6272,
-  [SMALL_STATE(130)] = 6290,
-  [SMALL_STATE(131)] = 6302,
-  [SMALL_STATE(132)] = 6313,
-  [SMALL_STATE(133)] = 6330,
-  [SMALL_STATE(134)] = 6341,
-  [SMALL_STATE(135)] = 6358,
-  [SMALL_STATE(136)] = 6369,
-  [SMALL_STATE(137)] = 6380,
-  [SMALL_STATE(138)] = 6391,
-  [SMALL_STATE(139)] = 6405,
-  [SMALL_STATE(140)] = 6419,
-  [SMALL_STATE(141)] = 6431,
-  [SMALL_STATE(142)] = 6447,
-  [SMALL_STATE(143)] = 6461,
-  [SMALL_STATE(144)] = 6473,
-  [SMALL_STATE(145)] = 6489,
-  [SMALL_STATE(146)] = 6503,
-  [SMALL_STATE(147)] = 6517,
-  [SMALL_STATE(148)] = 6531,
-  [SMALL_STATE(149)] = 6544,
-  [SMALL_STATE(150)] = 6557,
-  [SMALL_STATE(151)] = 6566,
-  [SMALL_STATE(152)] = 6575,
-  [SMALL_STATE(153)] = 6584,
-  [SMALL_STATE(154)] = 6593,
-  [SMALL_STATE(155)] = 6604,
-  [SMALL_STATE(156)] = 6613,
-  [SMALL_STATE(157)] = 6622,
-  [SMALL_STATE(158)] = 6631,
-  [SMALL_STATE(159)] = 6640,
-  [SMALL_STATE(160)] = 6653,
-  [SMALL_STATE(161)] = 6666,
-  [SMALL_STATE(162)] = 6675,
-  [SMALL_STATE(163)] = 6688,
-  [SMALL_STATE(164)] = 6697,
-  [SMALL_STATE(165)] = 6706,
-  [SMALL_STATE(166)] = 6719,
-  [SMALL_STATE(167)] = 6732,
-  [SMALL_STATE(168)] = 6743,
-  [SMALL_STATE(169)] = 6752,
-  [SMALL_STATE(170)] = 6761,
-  [SMALL_STATE(171)] = 6769,
-  [SMALL_STATE(172)] = 6777,
-  [SMALL_STATE(173)] = 6785,
-  [SMALL_STATE(174)] = 6795,
-  [SMALL_STATE(175)] = 6803,
-  [SMALL_STATE(176)] = 6811,
-  [SMALL_STATE(177)] = 6819,
-  [SMALL_STATE(178)] = 6827,
-  [SMALL_STATE(179)] = 6835,
-  [SMALL_STATE(180)] = 6843,
-  [SMALL_STATE(181)] = 6853,
-  [SMALL_STATE(182)] = 6863,
-  [SMALL_STATE(183)] = 6870,
-  [SMALL_STATE(184)] = 6877,
-  [SMALL_STATE(185)] = 6884,
-  [SMALL_STATE(186)] = 6891,
-  [SMALL_STATE(187)] = 6898,
-  [SMALL_STATE(188)] = 6905,
-  [SMALL_STATE(189)] = 6912,
-  [SMALL_STATE(190)] = 6919,
-  [SMALL_STATE(191)] = 6926,
-  [SMALL_STATE(192)] = 6933,
-  [SMALL_STATE(193)] = 6940,
-  [SMALL_STATE(194)] = 6947,
-  [SMALL_STATE(195)] = 6954,
-  [SMALL_STATE(196)] = 6961,
-  [SMALL_STATE(197)] = 6968,
-  [SMALL_STATE(198)] = 6975,
-  [SMALL_STATE(199)] = 6982,
-  [SMALL_STATE(200)] = 6989,
-  [SMALL_STATE(201)] = 6996,
-  [SMALL_STATE(202)] = 7003,
-  [SMALL_STATE(203)] = 7010,
-  [SMALL_STATE(204)] = 7017,
-  [SMALL_STATE(205)] = 7024,
-  [SMALL_STATE(206)] = 7031,
-  [SMALL_STATE(207)] = 7038,
-  [SMALL_STATE(208)] = 7045,
-  [SMALL_STATE(209)] = 7052,
-  [SMALL_STATE(210)] = 7059,
-  [SMALL_STATE(211)] = 7066,
-  [SMALL_STATE(212)] = 7073,
-  [SMALL_STATE(213)] = 7080,
-  [SMALL_STATE(214)] = 7087,
-  [SMALL_STATE(215)] = 7094,
-  [SMALL_STATE(216)] = 7101,
+  [SMALL_STATE(3)] = 115,
+  [SMALL_STATE(4)] = 230,
+  [SMALL_STATE(5)] = 345,
+  [SMALL_STATE(6)] = 454,
+  [SMALL_STATE(7)] = 563,
+  [SMALL_STATE(8)] = 672,
+  [SMALL_STATE(9)] = 781,
+  [SMALL_STATE(10)] = 818,
+  [SMALL_STATE(11)] = 855,
+  [SMALL_STATE(12)] = 892,
+  [SMALL_STATE(13)] = 929,
+  [SMALL_STATE(14)] = 966,
+  [SMALL_STATE(15)] = 1003,
+  [SMALL_STATE(16)] = 1040,
+  [SMALL_STATE(17)] = 1077,
+  [SMALL_STATE(18)] = 1114,
+  [SMALL_STATE(19)] = 1151,
+  [SMALL_STATE(20)] = 1188,
+  [SMALL_STATE(21)] = 1225,
+  [SMALL_STATE(22)] = 1262,
+  [SMALL_STATE(23)] = 1299,
+  [SMALL_STATE(24)] = 1336,
+  [SMALL_STATE(25)] = 1373,
+  [SMALL_STATE(26)] = 1410,
+  [SMALL_STATE(27)] = 1450,
+  [SMALL_STATE(28)] = 1524,
+  [SMALL_STATE(29)] = 1558,
+  [SMALL_STATE(30)] = 1592,
+  [SMALL_STATE(31)] = 1626,
+  [SMALL_STATE(32)] = 1660,
+  [SMALL_STATE(33)] = 1694,
+  [SMALL_STATE(34)] = 1728,
+  [SMALL_STATE(35)] = 1798,
+  [SMALL_STATE(36)] = 1868,
+  [SMALL_STATE(37)] = 1934,
+  [SMALL_STATE(38)] = 2000,
+  [SMALL_STATE(39)] = 2064,
+  [SMALL_STATE(40)] = 2126,
+  [SMALL_STATE(41)] = 2186,
+  [SMALL_STATE(42)] = 2242,
+  [SMALL_STATE(43)] = 2298,
+  [SMALL_STATE(44)] = 2346,
+  [SMALL_STATE(45)] = 2394,
+  [SMALL_STATE(46)] = 2442,
+  [SMALL_STATE(47)] = 2490,
+  [SMALL_STATE(48)] = 2534,
+  [SMALL_STATE(49)] = 2578,
+  [SMALL_STATE(50)] = 2618,
+  [SMALL_STATE(51)] = 2658,
+  [SMALL_STATE(52)] = 2692,
+  [SMALL_STATE(53)] = 2726,
+  [SMALL_STATE(54)] = 2760,
+  [SMALL_STATE(55)] = 2798,
+  [SMALL_STATE(56)] = 2874,
+  [SMALL_STATE(57)] = 2950,
+  [SMALL_STATE(58)] = 2981,
+  [SMALL_STATE(59)] = 3012,
+  [SMALL_STATE(60)] = 3082,
+  [SMALL_STATE(61)] = 3152,
+  [SMALL_STATE(62)] = 3222,
+  [SMALL_STATE(63)] = 3292,
+  [SMALL_STATE(64)] = 3362,
+  [SMALL_STATE(65)] = 3432,
+  [SMALL_STATE(66)] = 3502,
+  [SMALL_STATE(67)] = 3569,
+  [SMALL_STATE(68)] = 3636,
+  [SMALL_STATE(69)] = 3703,
+  [SMALL_STATE(70)] = 3770,
+  [SMALL_STATE(71)] = 3799,
+  [SMALL_STATE(72)] = 3828,
+  [SMALL_STATE(73)] = 3857,
+  [SMALL_STATE(74)] = 3886,
+  [SMALL_STATE(75)] = 3915,
+  [SMALL_STATE(76)] = 3944,
+  [SMALL_STATE(77)] = 3973,
+  [SMALL_STATE(78)] = 4002,
+  [SMALL_STATE(79)] = 4031,
+  [SMALL_STATE(80)] = 4098,
+  [SMALL_STATE(81)] = 4165,
+  [SMALL_STATE(82)] = 4232,
+  [SMALL_STATE(83)] = 4299,
+  [SMALL_STATE(84)] = 4366,
+  [SMALL_STATE(85)] = 4433,
+  [SMALL_STATE(86)] = 4500,
+  [SMALL_STATE(87)] = 4567,
+  [SMALL_STATE(88)] = 4634,
+  [SMALL_STATE(89)] = 4701,
+  [SMALL_STATE(90)] = 4768,
+  [SMALL_STATE(91)] = 4835,
+  [SMALL_STATE(92)] = 4902,
+  [SMALL_STATE(93)] = 4969,
+  [SMALL_STATE(94)] = 5036,
+  [SMALL_STATE(95)] = 5103,
+  [SMALL_STATE(96)] = 5170,
+  [SMALL_STATE(97)] = 5237,
+  [SMALL_STATE(98)] = 5304,
+  [SMALL_STATE(99)] = 5371,
+  [SMALL_STATE(100)] = 5402,
+  [SMALL_STATE(101)] = 5431,
+  [SMALL_STATE(102)] = 5460,
+  [SMALL_STATE(103)] = 5489,
+  [SMALL_STATE(104)] = 5518,
+  [SMALL_STATE(105)] = 5547,
+  [SMALL_STATE(106)] = 5574,
+  [SMALL_STATE(107)] = 5611,
+  [SMALL_STATE(108)] = 5648,
+  [SMALL_STATE(109)] = 5685,
+  [SMALL_STATE(110)] = 5722,
+  [SMALL_STATE(111)] = 5759,
+  [SMALL_STATE(112)] = 5796,
+  [SMALL_STATE(113)] = 5818,
+  [SMALL_STATE(114)] = 5838,
+  [SMALL_STATE(115)] = 5858,
+  [SMALL_STATE(116)] = 5878,
+  [SMALL_STATE(117)] = 5897,
+  [SMALL_STATE(118)] = 5916,
+  [SMALL_STATE(119)] = 5929,
+  [SMALL_STATE(120)] = 5942,
+  [SMALL_STATE(121)] = 5955,
+  [SMALL_STATE(122)] = 5968,
+  [SMALL_STATE(123)] = 5981,
+  [SMALL_STATE(124)] = 5994,
+  [SMALL_STATE(125)] = 6007,
+  [SMALL_STATE(126)] = 6020,
+  [SMALL_STATE(127)] = 6033,
+  [SMALL_STATE(128)] = 6046,
+  [SMALL_STATE(129)] = 6059,
+  [SMALL_STATE(130)] = 6075,
+  [SMALL_STATE(131)] = 6091,
+  [SMALL_STATE(132)] = 6105,
+  [SMALL_STATE(133)] = 6119,
+  [SMALL_STATE(134)] = 6133,
+  [SMALL_STATE(135)] = 6147,
+  [SMALL_STATE(136)] = 6161,
+  [SMALL_STATE(137)] = 6175,
+  [SMALL_STATE(138)] = 6189,
+  [SMALL_STATE(139)] = 6203,
+  [SMALL_STATE(140)] = 6214,
+  [SMALL_STATE(141)] = 6227,
+  [SMALL_STATE(142)] = 6236,
+  [SMALL_STATE(143)] = 6249,
+  [SMALL_STATE(144)] = 6262,
+  [SMALL_STATE(145)] = 6271,
+  [SMALL_STATE(146)] = 6282,
+  [SMALL_STATE(147)] = 6295,
+  [SMALL_STATE(148)] = 6304,
+  [SMALL_STATE(149)] = 6317,
+  [SMALL_STATE(150)] = 6328,
+  [SMALL_STATE(151)] = 6337,
+  [SMALL_STATE(152)] = 6350,
+  [SMALL_STATE(153)] = 6359,
+  [SMALL_STATE(154)] = 6372,
+  [SMALL_STATE(155)] = 6382,
+  [SMALL_STATE(156)] = 6390,
+  [SMALL_STATE(157)] = 6398,
+  [SMALL_STATE(158)] = 6406,
+  [SMALL_STATE(159)] = 6414,
+  [SMALL_STATE(160)] = 6422,
+  [SMALL_STATE(161)] = 6432,
+  [SMALL_STATE(162)] = 6440,
+  [SMALL_STATE(163)] = 6450,
+  [SMALL_STATE(164)] = 6460,
+  [SMALL_STATE(165)] = 6468,
+  [SMALL_STATE(166)] = 6476,
+  [SMALL_STATE(167)] = 6484,
+  [SMALL_STATE(168)] = 6491,
+  [SMALL_STATE(169)] = 6498,
+  [SMALL_STATE(170)] = 6505,
+  [SMALL_STATE(171)] = 6512,
+  [SMALL_STATE(172)] = 6519,
+  [SMALL_STATE(173)] = 6526,
+  [SMALL_STATE(174)] = 6533,
+  [SMALL_STATE(175)] = 6540,
+  [SMALL_STATE(176)] = 6547,
+  [SMALL_STATE(177)] = 6554,
+  [SMALL_STATE(178)] = 6561,
+  [SMALL_STATE(179)] = 6568,
+  [SMALL_STATE(180)] = 6575,
+  [SMALL_STATE(181)] = 6582,
+  [SMALL_STATE(182)] = 6589,
+  [SMALL_STATE(183)] = 6596,
+  [SMALL_STATE(184)] = 6603,
+  [SMALL_STATE(185)] = 6610,
+  [SMALL_STATE(186)] = 6617,
 };
 
 static const TSParseActionEntry ts_parse_actions[] = {
@@ -8372,273 +7265,242 @@ static const TSParseActionEntry ts_parse_actions[] = {
   [1] = {.entry = {.count = 1, .reusable = false}}, RECOVER(),
   [3] = {.entry = {.count = 1, .reusable = true}}, SHIFT_EXTRA(),
   [5] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_source_file, 0, 0, 0),
-  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(173),
-  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
-  [11] = {.entry = {.count = 1, .reusable = false}}, SHIFT(26),
-  [13] = {.entry = {.count = 1, .reusable = false}}, SHIFT(5),
-  [15] = {.entry = {.count = 1, .reusable = false}}, SHIFT(212),
-  [17] = {.entry = {.count = 1, .reusable = false}}, SHIFT(23),
-  [19] = {.entry = {.count = 1, .reusable = false}}, SHIFT(13),
-  [21] = {.entry = {.count = 1, .reusable = false}}, SHIFT(191),
-  [23] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
-  [25] = {.entry = {.count = 1, .reusable = false}}, SHIFT(95),
-  [27] = {.entry = {.count = 1, .reusable = false}}, SHIFT(39),
-  [29] = {.entry = {.count = 1, .reusable = true}}, SHIFT(43),
-  [31] = {.entry = {.count = 1, .reusable = false}}, SHIFT(43),
-  [33] = {.entry = {.count = 1, .reusable = false}}, SHIFT(37),
-  [35] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(24),
-  [38] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(26),
-  [41] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(5),
-  [44] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0),
-  [46] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(23),
-  [49] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(13),
-  [52] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(191),
-  [55] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(95),
-  [58] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(95),
-  [61] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(39),
-  [64] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(43),
-  [67] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(43),
-  [70] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(37),
-  [73] = {.entry = {.count = 1, .reusable = false}}, SHIFT(188),
-  [75] = {.entry = {.count = 1, .reusable = false}}, SHIFT(206),
-  [77] = {.entry = {.count = 1, .reusable = false}}, SHIFT(211),
-  [79] = {.entry = {.count = 1, .reusable = false}}, SHIFT(182),
-  [81] = {.entry = {.count = 1, .reusable = false}}, SHIFT(187),
-  [83] = {.entry = {.count = 1, .reusable = false}}, SHIFT(29),
-  [85] = {.entry = {.count = 1, .reusable = false}}, SHIFT(7),
-  [87] = {.entry = {.count = 1, .reusable = false}}, SHIFT(36),
-  [89] = {.entry = {.count = 1, .reusable = false}}, SHIFT(20),
-  [91] = {.entry = {.count = 1, .reusable = false}}, SHIFT(185),
-  [93] = {.entry = {.count = 1, .reusable = false}}, SHIFT(34),
-  [95] = {.entry = {.count = 1, .reusable = false}}, SHIFT(2),
-  [97] = {.entry = {.count = 1, .reusable = false}}, SHIFT(33),
-  [99] = {.entry = {.count = 1, .reusable = false}}, SHIFT(19),
-  [101] = {.entry = {.count = 1, .reusable = false}}, SHIFT(207),
-  [103] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
-  [105] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bool, 1, 0, 0),
-  [107] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_bool, 1, 0, 0),
-  [109] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_postfix, 1, 0, 0),
-  [111] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_postfix, 1, 0, 0),
-  [113] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_primary, 1, 0, 0),
-  [115] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_primary, 1, 0, 0),
-  [117] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_postfix, 3, 0, 0),
-  [119] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_postfix, 3, 0, 0),
-  [121] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_primary, 3, 0, 0),
-  [123] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_primary, 3, 0, 0),
-  [125] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_postfix, 4, 0, 0),
-  [127] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_postfix, 4, 0, 0),
-  [129] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_literal, 1, 0, 0),
-  [131] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_literal, 1, 0, 0),
-  [133] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
-  [135] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_unary, 1, 0, 0),
-  [137] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
-  [139] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_unary, 1, 0, 0),
-  [141] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_mul, 1, 0, 0),
-  [143] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_mul, 1, 0, 0),
-  [145] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
-  [147] = {.entry = {.count = 1, .reusable = false}}, SHIFT(94),
-  [149] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_mul, 2, 0, 0),
-  [151] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_mul, 2, 0, 0),
-  [153] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_mul_repeat1, 2, 0, 0),
-  [155] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_mul_repeat1, 2, 0, 0),
-  [157] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_mul_repeat1, 2, 0, 0), SHIFT_REPEAT(94),
-  [160] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_mul_repeat1, 2, 0, 0), SHIFT_REPEAT(94),
-  [163] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_unary, 2, 0, 0),
-  [165] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_unary, 2, 0, 0),
-  [167] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
-  [169] = {.entry = {.count = 1, .reusable = true}}, SHIFT(30),
-  [171] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_add, 1, 0, 0),
-  [173] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_add, 1, 0, 0),
-  [175] = {.entry = {.count = 1, .reusable = true}}, SHIFT(83),
-  [177] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_add_repeat1, 2, 0, 0),
-  [179] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_add_repeat1, 2, 0, 0),
-  [181] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_add_repeat1, 2, 0, 0), SHIFT_REPEAT(83),
-  [184] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_add, 2, 0, 0),
-  [186] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_add, 2, 0, 0),
-  [188] = {.entry = {.count = 1, .reusable = true}}, SHIFT(32),
-  [190] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shift, 1, 0, 0),
-  [192] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shift, 1, 0, 0),
-  [194] = {.entry = {.count = 1, .reusable = true}}, SHIFT(70),
-  [196] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_shift_repeat1, 2, 0, 0),
-  [198] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_shift_repeat1, 2, 0, 0),
-  [200] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_shift_repeat1, 2, 0, 0), SHIFT_REPEAT(70),
-  [203] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shift, 2, 0, 0),
-  [205] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shift, 2, 0, 0),
-  [207] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_if_statement, 6, 0, 0),
-  [209] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_if_statement, 6, 0, 0),
-  [211] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_relational, 2, 0, 0),
-  [213] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_relational, 2, 0, 0),
-  [215] = {.entry = {.count = 1, .reusable = false}}, SHIFT(66),
-  [217] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
-  [219] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_relational_repeat1, 2, 0, 0),
-  [221] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_relational_repeat1, 2, 0, 0),
-  [223] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_relational_repeat1, 2, 0, 0), SHIFT_REPEAT(66),
-  [226] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_relational_repeat1, 2, 0, 0), SHIFT_REPEAT(66),
-  [229] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_if_statement, 4, 0, 0),
-  [231] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_if_statement, 4, 0, 0),
-  [233] = {.entry = {.count = 1, .reusable = false}}, SHIFT(10),
-  [235] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_statement, 1, 0, 0),
-  [237] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_statement, 1, 0, 0),
-  [239] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_block, 3, 0, 0),
-  [241] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_block, 3, 0, 0),
-  [243] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_break_statement, 2, 0, 0),
-  [245] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_break_statement, 2, 0, 0),
-  [247] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_expr_stmt, 2, 0, 0),
-  [249] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_expr_stmt, 2, 0, 0),
-  [251] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_block, 4, 0, 0),
-  [253] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_block, 4, 0, 0),
-  [255] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_while_statement, 4, 0, 0),
-  [257] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_while_statement, 4, 0, 0),
-  [259] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_assignment, 4, 0, 0),
-  [261] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_assignment, 4, 0, 0),
-  [263] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_do_statement, 5, 0, 0),
-  [265] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_do_statement, 5, 0, 0),
-  [267] = {.entry = {.count = 1, .reusable = false}}, SHIFT(17),
-  [269] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_relational, 1, 0, 0),
-  [271] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_relational, 1, 0, 0),
-  [273] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_equality, 2, 0, 0),
-  [275] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_equality, 2, 0, 0),
-  [277] = {.entry = {.count = 1, .reusable = true}}, SHIFT(63),
-  [279] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_equality, 1, 0, 0),
-  [281] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_equality, 1, 0, 0),
-  [283] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_equality_repeat1, 2, 0, 0),
-  [285] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_equality_repeat1, 2, 0, 0),
-  [287] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_equality_repeat1, 2, 0, 0), SHIFT_REPEAT(63),
-  [290] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_bitwise_and_repeat1, 2, 0, 0),
-  [292] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_bitwise_and_repeat1, 2, 0, 0),
-  [294] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_bitwise_and_repeat1, 2, 0, 0), SHIFT_REPEAT(60),
-  [297] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bitwise_and, 1, 0, 0),
-  [299] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_bitwise_and, 1, 0, 0),
-  [301] = {.entry = {.count = 1, .reusable = false}}, SHIFT(60),
-  [303] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bitwise_and, 2, 0, 0),
-  [305] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_bitwise_and, 2, 0, 0),
-  [307] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bitwise_xor, 1, 0, 0),
-  [309] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_bitwise_xor, 1, 0, 0),
-  [311] = {.entry = {.count = 1, .reusable = true}}, SHIFT(56),
-  [313] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_bitwise_xor_repeat1, 2, 0, 0),
-  [315] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_bitwise_xor_repeat1, 2, 0, 0),
-  [317] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_bitwise_xor_repeat1, 2, 0, 0), SHIFT_REPEAT(56),
-  [320] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bitwise_xor, 2, 0, 0),
-  [322] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_bitwise_xor, 2, 0, 0),
-  [324] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_bitwise_or_repeat1, 2, 0, 0),
-  [326] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_bitwise_or_repeat1, 2, 0, 0), SHIFT_REPEAT(52),
-  [329] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bitwise_or, 2, 0, 0),
-  [331] = {.entry = {.count = 1, .reusable = false}}, SHIFT(52),
-  [333] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bitwise_or, 1, 0, 0),
-  [335] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_bitwise_or_repeat1, 2, 0, 0),
-  [337] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_logical_and_repeat1, 2, 0, 0),
-  [339] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_logical_and_repeat1, 2, 0, 0), SHIFT_REPEAT(49),
-  [342] = {.entry = {.count = 1, .reusable = false}}, SHIFT(137),
-  [344] = {.entry = {.count = 1, .reusable = false}}, SHIFT(199),
-  [346] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_logical_and, 2, 0, 0),
-  [348] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
-  [350] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_logical_and, 1, 0, 0),
-  [352] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_logical_or_repeat1, 2, 0, 0),
-  [354] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_logical_or_repeat1, 2, 0, 0), SHIFT_REPEAT(46),
-  [357] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_logical_or, 2, 0, 0),
-  [359] = {.entry = {.count = 1, .reusable = true}}, SHIFT(46),
-  [361] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_logical_or, 1, 0, 0),
-  [363] = {.entry = {.count = 1, .reusable = true}}, SHIFT(174),
-  [365] = {.entry = {.count = 1, .reusable = true}}, SHIFT(129),
-  [367] = {.entry = {.count = 1, .reusable = true}}, SHIFT(2),
-  [369] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_body_repeat1, 2, 0, 0),
-  [371] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_body_repeat1, 2, 0, 0), SHIFT_REPEAT(138),
-  [374] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_body_repeat2, 2, 0, 0),
-  [376] = {.entry = {.count = 1, .reusable = false}}, SHIFT(138),
-  [378] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_body_repeat2, 1, 0, 0),
-  [380] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_expr, 1, 0, 0),
-  [382] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_source_file, 1, 0, 0),
-  [384] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_typeRef, 6, 0, 0),
-  [386] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0),
-  [388] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(173),
-  [391] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_typeRef, 5, 0, 0),
-  [393] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_typeRef, 1, 0, 0),
-  [395] = {.entry = {.count = 1, .reusable = true}}, SHIFT(208),
-  [397] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_idList, 1, 0, 0),
-  [399] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_idList, 2, 0, 0),
-  [401] = {.entry = {.count = 1, .reusable = true}}, SHIFT(115),
-  [403] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 3, 0, 0),
-  [405] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_exprList_repeat1, 2, 0, 0), SHIFT_REPEAT(28),
-  [408] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_exprList_repeat1, 2, 0, 0),
-  [410] = {.entry = {.count = 1, .reusable = true}}, SHIFT(117),
-  [412] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 4, 0, 0),
-  [414] = {.entry = {.count = 1, .reusable = true}}, SHIFT(140),
-  [416] = {.entry = {.count = 1, .reusable = true}}, SHIFT(167),
-  [418] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
-  [420] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_exprList, 1, 0, 0),
-  [422] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_exprList, 2, 0, 0),
-  [424] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_idList_repeat1, 2, 0, 0), SHIFT_REPEAT(208),
-  [427] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_idList_repeat1, 2, 0, 0),
-  [429] = {.entry = {.count = 1, .reusable = true}}, SHIFT(166),
-  [431] = {.entry = {.count = 1, .reusable = true}}, SHIFT(209),
-  [433] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_typeRef_repeat1, 2, 0, 0), SHIFT_REPEAT(149),
-  [436] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_typeRef_repeat1, 2, 0, 0),
-  [438] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 5, 0, 0),
-  [440] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
-  [442] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_argList_repeat1, 2, 0, 0), SHIFT_REPEAT(181),
-  [445] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_argList_repeat1, 2, 0, 0),
-  [447] = {.entry = {.count = 1, .reusable = true}}, SHIFT(181),
-  [449] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argList, 1, 0, 0),
-  [451] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_varDecl, 2, 0, 0),
-  [453] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_body_repeat2, 2, 0, 0), SHIFT_REPEAT(129),
-  [456] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_body_repeat2, 2, 0, 0),
-  [458] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 6, 0, 0),
-  [460] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_varDecl, 4, 0, 0),
-  [462] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argList, 2, 0, 0),
-  [464] = {.entry = {.count = 1, .reusable = true}}, SHIFT(149),
-  [466] = {.entry = {.count = 1, .reusable = true}}, SHIFT(193),
-  [468] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argDef, 1, 0, 0),
-  [470] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
-  [472] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argDef, 3, 0, 0),
-  [474] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_sourceItem, 1, 0, 0),
-  [476] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_body, 2, 0, 0),
-  [478] = {.entry = {.count = 1, .reusable = true}}, SHIFT(192),
-  [480] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcDef, 3, 0, 0),
-  [482] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
-  [484] = {.entry = {.count = 1, .reusable = true}}, SHIFT(31),
-  [486] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
-  [488] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_body, 1, 0, 0),
-  [490] = {.entry = {.count = 1, .reusable = true}}, SHIFT(118),
-  [492] = {.entry = {.count = 1, .reusable = true}}, SHIFT(161),
-  [494] = {.entry = {.count = 1, .reusable = true}}, SHIFT(74),
-  [496] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
-  [498] = {.entry = {.count = 1, .reusable = true}}, SHIFT(143),
-  [500] = {.entry = {.count = 1, .reusable = true}}, SHIFT(75),
-  [502] = {.entry = {.count = 1, .reusable = true}}, SHIFT(76),
-  [504] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
-  [506] = {.entry = {.count = 1, .reusable = true}}, SHIFT(131),
-  [508] = {.entry = {.count = 1, .reusable = true}}, SHIFT(79),
-  [510] = {.entry = {.count = 1, .reusable = true}}, SHIFT(80),
-  [512] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
-  [514] = {.entry = {.count = 1, .reusable = true}}, SHIFT(144),
-  [516] = {.entry = {.count = 1, .reusable = true}}, SHIFT(114),
-  [518] = {.entry = {.count = 1, .reusable = true}}, SHIFT(14),
-  [520] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
-  [522] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
-  [524] = {.entry = {.count = 1, .reusable = true}}, SHIFT(164),
-  [526] = {.entry = {.count = 1, .reusable = true}}, SHIFT(157),
-  [528] = {.entry = {.count = 1, .reusable = true}}, SHIFT(148),
-  [530] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
-  [532] = {.entry = {.count = 1, .reusable = true}}, SHIFT(9),
-  [534] = {.entry = {.count = 1, .reusable = true}}, SHIFT(41),
-  [536] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
-  [538] = {.entry = {.count = 1, .reusable = true}}, SHIFT(12),
-  [540] = {.entry = {.count = 1, .reusable = true}}, SHIFT(92),
-  [542] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
-  [544] = {.entry = {.count = 1, .reusable = true}}, SHIFT(152),
-  [546] = {.entry = {.count = 1, .reusable = true}}, SHIFT(169),
-  [548] = {.entry = {.count = 1, .reusable = true}}, SHIFT(113),
-  [550] = {.entry = {.count = 1, .reusable = true}}, SHIFT(153),
-  [552] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
-  [554] = {.entry = {.count = 1, .reusable = true}}, SHIFT(136),
-  [556] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
-  [558] = {.entry = {.count = 1, .reusable = true}}, SHIFT(156),
-  [560] = {.entry = {.count = 1, .reusable = true}}, SHIFT(11),
+  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(154),
+  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
+  [11] = {.entry = {.count = 1, .reusable = false}}, SHIFT(60),
+  [13] = {.entry = {.count = 1, .reusable = false}}, SHIFT(2),
+  [15] = {.entry = {.count = 1, .reusable = false}}, SHIFT(170),
+  [17] = {.entry = {.count = 1, .reusable = false}}, SHIFT(61),
+  [19] = {.entry = {.count = 1, .reusable = false}}, SHIFT(5),
+  [21] = {.entry = {.count = 1, .reusable = false}}, SHIFT(171),
+  [23] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
+  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
+  [27] = {.entry = {.count = 1, .reusable = false}}, SHIFT(68),
+  [29] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
+  [31] = {.entry = {.count = 1, .reusable = false}}, SHIFT(9),
+  [33] = {.entry = {.count = 1, .reusable = true}}, SHIFT(10),
+  [35] = {.entry = {.count = 1, .reusable = false}}, SHIFT(11),
+  [37] = {.entry = {.count = 1, .reusable = false}}, SHIFT(12),
+  [39] = {.entry = {.count = 1, .reusable = false}}, SHIFT(13),
+  [41] = {.entry = {.count = 1, .reusable = false}}, SHIFT(14),
+  [43] = {.entry = {.count = 1, .reusable = false}}, SHIFT(15),
+  [45] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
+  [47] = {.entry = {.count = 1, .reusable = false}}, SHIFT(177),
+  [49] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(59),
+  [52] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(60),
+  [55] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(2),
+  [58] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0),
+  [60] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(61),
+  [63] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(5),
+  [66] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(171),
+  [69] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(66),
+  [72] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(67),
+  [75] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(68),
+  [78] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(69),
+  [81] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(9),
+  [84] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(10),
+  [87] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(11),
+  [90] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(12),
+  [93] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(13),
+  [96] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(14),
+  [99] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(15),
+  [102] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 2, 0, 0), SHIFT_REPEAT(16),
+  [105] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__operand, 1, 0, 0),
+  [107] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__operand, 1, 0, 0),
+  [109] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_literal, 1, 0, 0),
+  [111] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_literal, 1, 0, 0),
+  [113] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_bool, 1, 0, 0),
+  [115] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_bool, 1, 0, 0),
+  [117] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_parenthesized_expression, 3, 0, 0),
+  [119] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_parenthesized_expression, 3, 0, 0),
+  [121] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_postfix, 3, 0, 12),
+  [123] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_postfix, 3, 0, 12),
+  [125] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_postfix, 4, 0, 17),
+  [127] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_postfix, 4, 0, 17),
+  [129] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
+  [131] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__expression, 1, 0, 0),
+  [133] = {.entry = {.count = 1, .reusable = true}}, SHIFT(56),
+  [135] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__expression, 1, 0, 0),
+  [137] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_expr, 1, 0, 0),
+  [139] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_expr, 1, 0, 0),
+  [141] = {.entry = {.count = 1, .reusable = false}}, SHIFT(79),
+  [143] = {.entry = {.count = 1, .reusable = false}}, SHIFT(80),
+  [145] = {.entry = {.count = 1, .reusable = false}}, SHIFT(81),
+  [147] = {.entry = {.count = 1, .reusable = false}}, SHIFT(82),
+  [149] = {.entry = {.count = 1, .reusable = false}}, SHIFT(83),
+  [151] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
+  [153] = {.entry = {.count = 1, .reusable = false}}, SHIFT(85),
+  [155] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
+  [157] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
+  [159] = {.entry = {.count = 1, .reusable = false}}, SHIFT(88),
+  [161] = {.entry = {.count = 1, .reusable = false}}, SHIFT(89),
+  [163] = {.entry = {.count = 1, .reusable = false}}, SHIFT(90),
+  [165] = {.entry = {.count = 1, .reusable = false}}, SHIFT(91),
+  [167] = {.entry = {.count = 1, .reusable = false}}, SHIFT(92),
+  [169] = {.entry = {.count = 1, .reusable = false}}, SHIFT(93),
+  [171] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
+  [173] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
+  [175] = {.entry = {.count = 1, .reusable = true}}, SHIFT(96),
+  [177] = {.entry = {.count = 1, .reusable = true}}, SHIFT(97),
+  [179] = {.entry = {.count = 1, .reusable = true}}, SHIFT(98),
+  [181] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_unary_expression, 2, 0, 8),
+  [183] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_unary_expression, 2, 0, 8),
+  [185] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_binary_expression, 3, 0, 11),
+  [187] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_binary_expression, 3, 0, 11),
+  [189] = {.entry = {.count = 1, .reusable = true}}, SHIFT(62),
+  [191] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
+  [193] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
+  [195] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_block, 3, 0, 0),
+  [197] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_block, 3, 0, 0),
+  [199] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_block, 4, 0, 0),
+  [201] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_block, 4, 0, 0),
+  [203] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_statement, 1, 0, 0),
+  [205] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_statement, 1, 0, 0),
+  [207] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_break_statement, 2, 0, 0),
+  [209] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_break_statement, 2, 0, 0),
+  [211] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_expr_stmt, 2, 0, 0),
+  [213] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_expr_stmt, 2, 0, 0),
+  [215] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_if_statement, 4, 0, 15),
+  [217] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_if_statement, 4, 0, 15),
+  [219] = {.entry = {.count = 1, .reusable = false}}, SHIFT(8),
+  [221] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_while_statement, 4, 0, 16),
+  [223] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_while_statement, 4, 0, 16),
+  [225] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_assignment, 4, 0, 18),
+  [227] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_assignment, 4, 0, 18),
+  [229] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_do_statement, 5, 0, 19),
+  [231] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_do_statement, 5, 0, 19),
+  [233] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_if_statement, 6, 0, 20),
+  [235] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_if_statement, 6, 0, 20),
+  [237] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_block_repeat1, 1, 0, 0),
+  [239] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_block_repeat1, 1, 0, 0),
+  [241] = {.entry = {.count = 1, .reusable = false}}, SHIFT(118),
+  [243] = {.entry = {.count = 1, .reusable = false}}, SHIFT(119),
+  [245] = {.entry = {.count = 1, .reusable = false}}, SHIFT(120),
+  [247] = {.entry = {.count = 1, .reusable = false}}, SHIFT(121),
+  [249] = {.entry = {.count = 1, .reusable = false}}, SHIFT(122),
+  [251] = {.entry = {.count = 1, .reusable = false}}, SHIFT(123),
+  [253] = {.entry = {.count = 1, .reusable = false}}, SHIFT(124),
+  [255] = {.entry = {.count = 1, .reusable = false}}, SHIFT(125),
+  [257] = {.entry = {.count = 1, .reusable = false}}, SHIFT(178),
+  [259] = {.entry = {.count = 1, .reusable = false}}, SHIFT(126),
+  [261] = {.entry = {.count = 1, .reusable = true}}, SHIFT(157),
+  [263] = {.entry = {.count = 1, .reusable = false}}, SHIFT(113),
+  [265] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_body_repeat2, 1, 0, 0),
+  [267] = {.entry = {.count = 1, .reusable = false}}, SHIFT(132),
+  [269] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_body_repeat2, 2, 0, 0),
+  [271] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_body_repeat1, 2, 0, 0),
+  [273] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_body_repeat1, 2, 0, 0), SHIFT_REPEAT(132),
+  [276] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_source_file, 1, 0, 0),
+  [278] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0),
+  [280] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 2, 0, 0), SHIFT_REPEAT(154),
+  [283] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_typeRef, 1, 0, 0),
+  [285] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_typeRef, 1, 0, 0),
+  [287] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_typeRef, 5, 0, 0),
+  [289] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_typeRef, 5, 0, 0),
+  [291] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_typeRef, 6, 0, 0),
+  [293] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_typeRef, 6, 0, 0),
+  [295] = {.entry = {.count = 1, .reusable = true}}, SHIFT(131),
+  [297] = {.entry = {.count = 1, .reusable = true}}, SHIFT(139),
+  [299] = {.entry = {.count = 1, .reusable = true}}, SHIFT(106),
+  [301] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 3, 0, 4),
+  [303] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_funcSignature, 3, 0, 4),
+  [305] = {.entry = {.count = 1, .reusable = true}}, SHIFT(173),
+  [307] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_idList, 1, 0, 0),
+  [309] = {.entry = {.count = 1, .reusable = true}}, SHIFT(109),
+  [311] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 4, 0, 6),
+  [313] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_funcSignature, 4, 0, 6),
+  [315] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_idList, 2, 0, 0),
+  [317] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_idList_repeat1, 2, 0, 0), SHIFT_REPEAT(173),
+  [320] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_idList_repeat1, 2, 0, 0),
+  [322] = {.entry = {.count = 1, .reusable = true}}, SHIFT(65),
+  [324] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_exprList, 1, 0, 0),
+  [326] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_exprList, 2, 0, 0),
+  [328] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_exprList_repeat1, 2, 0, 0), SHIFT_REPEAT(65),
+  [331] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_exprList_repeat1, 2, 0, 0),
+  [333] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argDef, 1, 0, 4),
+  [335] = {.entry = {.count = 1, .reusable = true}}, SHIFT(107),
+  [337] = {.entry = {.count = 1, .reusable = true}}, SHIFT(162),
+  [339] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argList, 1, 0, 0),
+  [341] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_body_repeat1, 1, 0, 0),
+  [343] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_body_repeat2, 2, 0, 0), SHIFT_REPEAT(113),
+  [346] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argList, 2, 0, 0),
+  [348] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_varDecl, 2, 0, 7),
+  [350] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 5, 0, 9),
+  [352] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_funcSignature, 5, 0, 9),
+  [354] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_argList_repeat1, 2, 0, 0), SHIFT_REPEAT(162),
+  [357] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_argList_repeat1, 2, 0, 0),
+  [359] = {.entry = {.count = 1, .reusable = true}}, SHIFT(166),
+  [361] = {.entry = {.count = 1, .reusable = true}}, SHIFT(185),
+  [363] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcSignature, 6, 0, 13),
+  [365] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_funcSignature, 6, 0, 13),
+  [367] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_varDecl, 4, 0, 14),
+  [369] = {.entry = {.count = 1, .reusable = true}}, SHIFT(186),
+  [371] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_typeRef_repeat1, 2, 0, 0), SHIFT_REPEAT(166),
+  [374] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_typeRef_repeat1, 2, 0, 0),
+  [376] = {.entry = {.count = 1, .reusable = true}}, SHIFT(168),
+  [378] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_source_file_repeat1, 1, 0, 0),
+  [380] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_sourceItem, 1, 0, 0),
+  [382] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcDef, 3, 0, 1),
+  [384] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_funcDef, 3, 0, 2),
+  [386] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_body, 1, 0, 3),
+  [388] = {.entry = {.count = 1, .reusable = true}}, SHIFT(108),
+  [390] = {.entry = {.count = 1, .reusable = true}}, SHIFT(144),
+  [392] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_body, 2, 0, 5),
+  [394] = {.entry = {.count = 1, .reusable = false}}, SHIFT(63),
+  [396] = {.entry = {.count = 1, .reusable = false}}, SHIFT(64),
+  [398] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_argDef, 3, 0, 10),
+  [400] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_typeRef_repeat1, 1, 0, 0),
+  [402] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
+  [404] = {.entry = {.count = 1, .reusable = true}}, SHIFT(129),
+  [406] = {.entry = {.count = 1, .reusable = true}}, SHIFT(133),
+  [408] = {.entry = {.count = 1, .reusable = true}}, SHIFT(57),
+  [410] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
+  [412] = {.entry = {.count = 1, .reusable = true}}, SHIFT(78),
+  [414] = {.entry = {.count = 1, .reusable = true}}, SHIFT(147),
+  [416] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
+  [418] = {.entry = {.count = 1, .reusable = true}}, SHIFT(6),
+  [420] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
+  [422] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
+  [424] = {.entry = {.count = 1, .reusable = true}}, SHIFT(148),
+  [426] = {.entry = {.count = 1, .reusable = true}}, SHIFT(150),
+  [428] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
+  [430] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
+  [432] = {.entry = {.count = 1, .reusable = true}}, SHIFT(101),
+  [434] = {.entry = {.count = 1, .reusable = true}}, SHIFT(102),
+  [436] = {.entry = {.count = 1, .reusable = true}}, SHIFT(103),
+  [438] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
+  [440] = {.entry = {.count = 1, .reusable = true}}, SHIFT(111),
+};
+
+enum ts_external_scanner_symbol_identifiers {
+  ts_external_token_comment = 0,
+  ts_external_token_str = 1,
+};
+
+static const TSSymbol ts_external_scanner_symbol_map[EXTERNAL_TOKEN_COUNT] = {
+  [ts_external_token_comment] = sym_comment,
+  [ts_external_token_str] = sym_str,
+};
+
+static const bool ts_external_scanner_states[3][EXTERNAL_TOKEN_COUNT] = {
+  [1] = {
+    [ts_external_token_comment] = true,
+    [ts_external_token_str] = true,
+  },
+  [2] = {
+    [ts_external_token_comment] = true,
+  },
 };
 
 #ifdef __cplusplus
 extern "C" {
 #endif
+void *tree_sitter_v2lang_test_external_scanner_create(void);
+void tree_sitter_v2lang_test_external_scanner_destroy(void *);
+bool tree_sitter_v2lang_test_external_scanner_scan(void *, TSLexer *, const bool *);
+unsigned tree_sitter_v2lang_test_external_scanner_serialize(void *, char *);
+void tree_sitter_v2lang_test_external_scanner_deserialize(void *, const char *, unsigned);
+
 #ifdef TREE_SITTER_HIDE_SYMBOLS
 #define TS_PUBLIC
 #elif defined(_WIN32)
@@ -8665,12 +7527,26 @@ TS_PUBLIC const TSLanguage *tree_sitter_v2lang_test(void) {
     .small_parse_table_map = ts_small_parse_table_map,
     .parse_actions = ts_parse_actions,
     .symbol_names = ts_symbol_names,
+    .field_names = ts_field_names,
+    .field_map_slices = ts_field_map_slices,
+    .field_map_entries = ts_field_map_entries,
     .symbol_metadata = ts_symbol_metadata,
     .public_symbol_map = ts_symbol_map,
     .alias_map = ts_non_terminal_alias_map,
     .alias_sequences = &ts_alias_sequences[0][0],
     .lex_modes = (const void*)ts_lex_modes,
     .lex_fn = ts_lex,
+    .keyword_lex_fn = ts_lex_keywords,
+    .keyword_capture_token = sym_identifier,
+    .external_scanner = {
+      &ts_external_scanner_states[0][0],
+      ts_external_scanner_symbol_map,
+      tree_sitter_v2lang_test_external_scanner_create,
+      tree_sitter_v2lang_test_external_scanner_destroy,
+      tree_sitter_v2lang_test_external_scanner_scan,
+      tree_sitter_v2lang_test_external_scanner_serialize,
+      tree_sitter_v2lang_test_external_scanner_deserialize,
+    },
     .primary_state_ids = ts_primary_state_ids,
     .name = "v2lang_test",
     .max_reserved_word_set_size = 0,
@@ -0,0 +1,83 @@
+// scanner.c — внешний сканер для комментариев и строковых литералов.
+//
+// Комментарии (`//...`, `{...}`) и строки `"..."` с экранированием читаются
+// здесь простыми циклами до закрывающего символа, а не регулярными
+// выражениями сгенерированного лексера: длинный комментарий или строка
+// проходятся без переходов по таблице состояний на каждый символ.
+#include "tree_sitter/parser.h"
+
+// порядок совпадает с externals в grammar.js
+enum TokenType {
+    COMMENT,
+    STR,
+};
+
+void *tree_sitter_v2lang_test_external_scanner_create(void) { return NULL; }
+
+void tree_sitter_v2lang_test_external_scanner_destroy(void *payload) { (void)payload; }
+
+// состояния нет: каждый токен сканируется с нуля
+unsigned tree_sitter_v2lang_test_external_scanner_serialize(void *payload, char *buffer) {
+    (void)payload;
+    (void)buffer;
+    return 0;
+}
+
+void tree_sitter_v2lang_test_external_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
+    (void)payload;
+    (void)buffer;
+    (void)length;
+}
+
+static inline void advance(TSLexer *lexer) { lexer->advance(lexer, false); }
+
+static inline bool is_space(int32_t c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// `//` до конца строки (перевод строки не входит) или `{` до `}`
+static bool scan_comment(TSLexer *lexer) {
+    if (lexer->lookahead == '/') {
+        advance(lexer);
+        // одиночный `/` — деление, его разберёт основной лексер
+        if (lexer->lookahead != '/') return false;
+        while (lexer->lookahead != '\n' && !lexer->eof(lexer)) advance(lexer);
+        lexer->result_symbol = COMMENT;
+        return true;
+    }
+    advance(lexer);
+    while (lexer->lookahead != '}') {
+        if (lexer->eof(lexer)) return false;
+        advance(lexer);
+    }
+    advance(lexer);
+    lexer->result_symbol = COMMENT;
+    return true;
+}
+
+// `"` ... `"`, где `\` экранирует следующий символ
+static bool scan_string(TSLexer *lexer) {
+    advance(lexer);
+    for (;;) {
+        if (lexer->eof(lexer)) return false;
+        int32_t c = lexer->lookahead;
+        advance(lexer);
+        if (c == '"') break;
+        if (c == '\\') {
+            if (lexer->eof(lexer)) return false;
+            advance(lexer);
+        }
+    }
+    lexer->result_symbol = STR;
+    return true;
+}
+
+bool tree_sitter_v2lang_test_external_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+    (void)payload;
+    // пробелы — extras; пропускаем их, чтобы токен начинался с `/`, `{` или `"`
+    while (is_space(lexer->lookahead)) lexer->advance(lexer, true);
+    int32_t c = lexer->lookahead;
+    if (c == '"') return valid_symbols[STR] && scan_string(lexer);
+    if ((c == '/' || c == '{') && valid_symbols[COMMENT]) return scan_comment(lexer);
+    return false;
+}
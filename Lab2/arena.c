@@ -0,0 +1,128 @@
+#include "arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_CHUNK_SIZE (64 * 1024)
+#define ARENA_ALIGN 16
+
+static size_t align_up(size_t n) { return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1); }
+
+static char *chunk_data(ArenaChunk *c) { return (char *)c + align_up(sizeof(ArenaChunk)); }
+
+void arena_init(Arena *a) { arena_init_chunked(a, ARENA_CHUNK_SIZE); }
+
+void arena_init_chunked(Arena *a, size_t chunk_size) {
+  a->head = NULL;
+  a->spare = NULL;
+  a->chunk_size = chunk_size;
+}
+
+static ArenaChunk *new_chunk(Arena *a, size_t need) {
+  // reuse a spare chunk when it is large enough, otherwise allocate
+  ArenaChunk **pp = &a->spare;
+  while (*pp) {
+    if ((*pp)->size >= need) {
+      ArenaChunk *c = *pp;
+      *pp = c->next;
+      c->used = 0;
+      return c;
+    }
+    pp = &(*pp)->next;
+  }
+  size_t size = need > a->chunk_size ? need : a->chunk_size;
+  ArenaChunk *c = malloc(align_up(sizeof(ArenaChunk)) + size);
+  if (!c) { fprintf(stderr, "arena: out of memory\n"); abort(); }
+  c->size = size;
+  c->used = 0;
+  return c;
+}
+
+void *arena_alloc(Arena *a, size_t size) {
+  size = align_up(size ? size : 1);
+  ArenaChunk *c = a->head;
+  if (!c || c->size - c->used < size) {
+    c = new_chunk(a, size);
+    c->next = a->head;
+    a->head = c;
+  }
+  void *p = chunk_data(c) + c->used;
+  c->used += size;
+  return p;
+}
+
+void *arena_realloc(Arena *a, void *old, size_t old_size, size_t new_size) {
+  if (new_size <= old_size) return old;
+  ArenaChunk *c = a->head;
+  // the last allocation of the current chunk can grow in place
+  if (old && c && (char *)old + align_up(old_size) == chunk_data(c) + c->used
+      && c->size - c->used >= align_up(new_size) - align_up(old_size)) {
+    c->used += align_up(new_size) - align_up(old_size);
+    return old;
+  }
+  void *p = arena_alloc(a, new_size);
+  if (old && old_size) memcpy(p, old, old_size);
+  return p;
+}
+
+char *arena_strndup(Arena *a, const char *s, size_t len) {
+  char *p = arena_alloc(a, len + 1);
+  memcpy(p, s, len);
+  p[len] = '\0';
+  return p;
+}
+
+char *arena_strdup(Arena *a, const char *s) { return arena_strndup(a, s, strlen(s)); }
+
+char *arena_vprintf(Arena *a, const char *fmt, va_list ap) {
+  va_list cp;
+  va_copy(cp, ap);
+  int len = vsnprintf(NULL, 0, fmt, cp);
+  va_end(cp);
+  if (len < 0) return arena_strdup(a, "");
+  char *buf = arena_alloc(a, (size_t)len + 1);
+  vsnprintf(buf, (size_t)len + 1, fmt, ap);
+  return buf;
+}
+
+char *arena_printf(Arena *a, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  char *s = arena_vprintf(a, fmt, ap);
+  va_end(ap);
+  return s;
+}
+
+void arena_reset(Arena *a) {
+  while (a->head) {
+    ArenaChunk *c = a->head;
+    a->head = c->next;
+    c->next = a->spare;
+    a->spare = c;
+  }
+}
+
+ArenaMark arena_mark(const Arena *a) {
+  ArenaMark m = { a->head, a->head ? a->head->used : 0 };
+  return m;
+}
+
+void arena_rewind(Arena *a, ArenaMark m) {
+  while (a->head && a->head != m.chunk) {
+    ArenaChunk *c = a->head;
+    a->head = c->next;
+    c->next = a->spare;
+    a->spare = c;
+  }
+  if (a->head) a->head->used = m.used;
+}
+
+static void free_chunks(ArenaChunk *c) {
+  while (c) { ArenaChunk *next = c->next; free(c); c = next; }
+}
+
+void arena_free(Arena *a) {
+  free_chunks(a->head);
+  free_chunks(a->spare);
+  a->head = a->spare = NULL;
+}
@@ -0,0 +1,47 @@
+#ifndef LAB2_ARENA_H
+#define LAB2_ARENA_H
+
+#include <stddef.h>
+#include <stdarg.h>
+
+// Bump allocator. Everything built for one input file (CFG nodes, edge and
+// line arrays, IR strings, frozen CFGs) is carved out of an arena and released
+// at once by arena_reset(), which keeps the chunks for the next file. There is
+// no per-allocation free.
+typedef struct ArenaChunk {
+  struct ArenaChunk *next;
+  size_t size;
+  size_t used;
+} ArenaChunk;
+
+typedef struct Arena {
+  ArenaChunk *head;  /* chunk being filled; older full chunks follow */
+  ArenaChunk *spare; /* chunks kept by arena_reset() */
+  size_t chunk_size; /* minimum size of a new chunk */
+} Arena;
+
+void arena_init(Arena *a);
+// for many small arenas (one per function in a Session): smaller chunks
+void arena_init_chunked(Arena *a, size_t chunk_size);
+void *arena_alloc(Arena *a, size_t size);
+// grow a block obtained from arena_alloc; the old block is left in place
+void *arena_realloc(Arena *a, void *old, size_t old_size, size_t new_size);
+char *arena_strdup(Arena *a, const char *s);
+char *arena_strndup(Arena *a, const char *s, size_t len);
+char *arena_printf(Arena *a, const char *fmt, ...);
+char *arena_vprintf(Arena *a, const char *fmt, va_list ap);
+void arena_reset(Arena *a);
+
+// A position in the arena. arena_rewind() releases everything allocated
+// after the mark (chunks go to the spare list), e.g. one function's CFG once
+// it has been written.
+typedef struct ArenaMark {
+  ArenaChunk *chunk;
+  size_t used;
+} ArenaMark;
+
+ArenaMark arena_mark(const Arena *a);
+void arena_rewind(Arena *a, ArenaMark m);
+void arena_free(Arena *a);
+
+#endif
@@ -0,0 +1,61 @@
+#!/usr/bin/env zsh
+# Wide-node benchmark: one method whose block holds N statements, plus one
+# call with N arguments. Runs lab2_cfg on N/4, N/2 and N and prints the time
+# ratios: a linear sibling walk roughly doubles per step, the old
+# ts_node_child(node, i) loops roughly quadrupled.
+#
+# OLD_BIN=path/to/old/lab2_cfg times a second build on the same inputs, for a
+# before/after comparison in one run.
+set -euo pipefail
+zmodload zsh/datetime
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+N=${1:-100000}
+LAB2_BIN="$ROOT/Lab2/lab2_cfg"
+[ -x "$LAB2_BIN" ] || { echo "Build Lab2/lab2_cfg first (see Lab2/run_tests.sh)"; exit 2 }
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+gen_input() {
+  local n=$1 out=$2
+  {
+    echo "method wide()"
+    echo "begin"
+    awk -v n="$n" 'BEGIN { for (i = 0; i < n; i++) printf "  x := x + %d;\n", i }'
+    printf "  f("
+    awk -v n="$n" 'BEGIN { for (i = 0; i < n; i++) printf (i ? ", %d" : "%d"), i }'
+    echo ");"
+    echo "end;"
+  } > "$out"
+}
+
+OLD_BIN=${OLD_BIN:-}
+[ -z "$OLD_BIN" ] || [ -x "$OLD_BIN" ] || { echo "OLD_BIN $OLD_BIN is not executable"; exit 2 }
+
+# time_run BIN INPUT: wall seconds of one lab2_cfg run
+time_run() {
+  local t0=$EPOCHREALTIME
+  "$1" "$2" --outdir "$WORK/out" > /dev/null
+  local t1=$EPOCHREALTIME
+  echo $(( t1 - t0 ))
+}
+
+typeset -a sizes times old_times
+sizes=($(( N / 4 )) $(( N / 2 )) $N)
+for n in $sizes; do
+  gen_input $n "$WORK/wide_$n.txt"
+  times+=($(time_run "$LAB2_BIN" "$WORK/wide_$n.txt"))
+  if [ -n "$OLD_BIN" ]; then
+    old_times+=($(time_run "$OLD_BIN" "$WORK/wide_$n.txt"))
+    printf "%8d statements: %8.3f s (old %8.3f s, %.1fx)\n" $n ${times[-1]} ${old_times[-1]} $(( old_times[-1] / times[-1] ))
+  else
+    printf "%8d statements: %8.3f s\n" $n ${times[-1]}
+  fi
+done
+printf "ratio N/2 : N/4 = %.2f\n" $(( times[2] / times[1] ))
+printf "ratio N   : N/2 = %.2f\n" $(( times[3] / times[2] ))
+if [ -n "$OLD_BIN" ]; then
+  printf "old ratio N/2 : N/4 = %.2f\n" $(( old_times[2] / old_times[1] ))
+  printf "old ratio N   : N/2 = %.2f\n" $(( old_times[3] / old_times[2] ))
+fi
@@ -0,0 +1,198 @@
+#include "callgraph.h"
+#include <stdlib.h>
+#include <string.h>
+
+// FNV-1a
+static uint64_t hash_bytes(const char *s, size_t len) {
+  uint64_t h = 1469598103934665603ULL;
+  for (size_t i=0;i<len;i++) { h ^= (unsigned char)s[i]; h *= 1099511628211ULL; }
+  return h;
+}
+
+static uint64_t hash_pair(int caller, int callee) {
+  uint64_t h = ((uint64_t)(uint32_t)caller << 32) | (uint32_t)callee;
+  h ^= h >> 33; h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+static int *new_slots(size_t n) {
+  int *slots = malloc(sizeof(int) * n);
+  for (size_t i=0;i<n;i++) slots[i] = -1;
+  return slots;
+}
+
+void callgraph_init(CallGraph *g) {
+  memset(g, 0, sizeof(*g));
+  arena_init(&g->strings);
+  g->name_mask = 63;
+  g->name_slots = new_slots(g->name_mask + 1);
+  g->edge_mask = 63;
+  g->edge_slots = new_slots(g->edge_mask + 1);
+}
+
+void callgraph_free(CallGraph *g) {
+  arena_free(&g->strings);
+  free(g->names);
+  free(g->name_len);
+  free(g->name_hash);
+  free(g->name_slots);
+  free(g->edges);
+  free(g->edge_slots);
+  memset(g, 0, sizeof(*g));
+}
+
+// Tables are kept at most half full; growing re-inserts the ids, whose hashes
+// are cached (names) or cheap to recompute (edges).
+static void rehash_names(CallGraph *g) {
+  free(g->name_slots);
+  g->name_slots = new_slots(g->name_mask + 1);
+  for (int id=0; id<g->n_names; id++) {
+    size_t i = g->name_hash[id] & g->name_mask;
+    while (g->name_slots[i] >= 0) i = (i + 1) & g->name_mask;
+    g->name_slots[i] = id;
+  }
+}
+
+static void rehash_edges(CallGraph *g) {
+  free(g->edge_slots);
+  g->edge_slots = new_slots(g->edge_mask + 1);
+  for (int e=0; e<g->n_edges; e++) {
+    size_t i = hash_pair(g->edges[e].caller, g->edges[e].callee) & g->edge_mask;
+    while (g->edge_slots[i] >= 0) i = (i + 1) & g->edge_mask;
+    g->edge_slots[i] = e;
+  }
+}
+
+static void grow_names(CallGraph *g) {
+  g->name_mask = g->name_mask * 2 + 1;
+  rehash_names(g);
+}
+
+static void grow_edges(CallGraph *g) {
+  g->edge_mask = g->edge_mask * 2 + 1;
+  rehash_edges(g);
+}
+
+// slot of the edge caller -> callee, or of the empty slot ending its probe
+static size_t find_edge_slot(const CallGraph *g, int caller, int callee) {
+  size_t i = hash_pair(caller, callee) & g->edge_mask;
+  for (;;) {
+    int e = g->edge_slots[i];
+    if (e < 0) return i;
+    if (g->edges[e].caller == caller && g->edges[e].callee == callee) return i;
+    i = (i + 1) & g->edge_mask;
+  }
+}
+
+// empty slot i of the linear-probing table, moving back later entries whose
+// probe passes through it
+static void unlink_edge_slot(CallGraph *g, size_t i) {
+  size_t j = i;
+  for (;;) {
+    j = (j + 1) & g->edge_mask;
+    int e = g->edge_slots[j];
+    if (e < 0) break;
+    size_t k = hash_pair(g->edges[e].caller, g->edges[e].callee) & g->edge_mask;
+    // the entry at j may move to i unless its home k lies in (i, j]
+    int stays = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+    if (!stays) { g->edge_slots[i] = e; i = j; }
+  }
+  g->edge_slots[i] = -1;
+}
+
+static size_t find_name_slot(const CallGraph *g, const char *name, size_t len, uint64_t h) {
+  size_t i = h & g->name_mask;
+  for (;;) {
+    int id = g->name_slots[i];
+    if (id < 0) return i;
+    if (g->name_hash[id] == h && g->name_len[id] == len && memcmp(g->names[id], name, len) == 0) return i;
+    i = (i + 1) & g->name_mask;
+  }
+}
+
+int callgraph_find(const CallGraph *g, const char *name, size_t len) {
+  return g->name_slots[find_name_slot(g, name, len, hash_bytes(name, len))];
+}
+
+int callgraph_intern(CallGraph *g, const char *name, size_t len) {
+  uint64_t h = hash_bytes(name, len);
+  size_t slot = find_name_slot(g, name, len, h);
+  if (g->name_slots[slot] >= 0) return g->name_slots[slot];
+  if (g->n_names + 1 > g->cap_names) {
+    g->cap_names = (g->cap_names == 0) ? 64 : g->cap_names * 2;
+    g->names = realloc(g->names, sizeof(char*) * g->cap_names);
+    g->name_len = realloc(g->name_len, sizeof(uint32_t) * g->cap_names);
+    g->name_hash = realloc(g->name_hash, sizeof(uint64_t) * g->cap_names);
+  }
+  int id = g->n_names++;
+  g->names[id] = arena_strndup(&g->strings, name, len);
+  g->name_len[id] = (uint32_t)len;
+  g->name_hash[id] = h;
+  g->name_slots[slot] = id;
+  if ((size_t)g->n_names * 2 > g->name_mask + 1) grow_names(g);
+  return id;
+}
+
+void callgraph_add_call(CallGraph *g, int caller, int callee, int count) {
+  size_t i = find_edge_slot(g, caller, callee);
+  if (g->edge_slots[i] >= 0) { g->edges[g->edge_slots[i]].count += count; return; }
+  if (g->n_edges + 1 > g->cap_edges) {
+    g->cap_edges = (g->cap_edges == 0) ? 64 : g->cap_edges * 2;
+    g->edges = realloc(g->edges, sizeof(CallEdge) * g->cap_edges);
+  }
+  int e = g->n_edges++;
+  g->edges[e].caller = caller;
+  g->edges[e].callee = callee;
+  g->edges[e].count = count;
+  g->edge_slots[i] = e;
+  if ((size_t)g->n_edges * 2 > g->edge_mask + 1) grow_edges(g);
+}
+
+int callgraph_drop_call(CallGraph *g, int caller, int callee, int count) {
+  size_t i = find_edge_slot(g, caller, callee);
+  int e = g->edge_slots[i];
+  if (e < 0) return 0;
+  g->edges[e].count -= count;
+  if (g->edges[e].count > 0) return 0;
+  unlink_edge_slot(g, i);
+  // the last edge takes the freed index
+  int last = g->n_edges - 1;
+  if (e != last) {
+    size_t j = find_edge_slot(g, g->edges[last].caller, g->edges[last].callee);
+    g->edges[e] = g->edges[last];
+    g->edge_slots[j] = e;
+  }
+  g->n_edges--;
+  return 1;
+}
+
+void callgraph_compact(CallGraph *g, const unsigned char *keep, int *remap) {
+  Arena strings;
+  arena_init(&strings);
+  int n = 0;
+  for (int id=0; id<g->n_names; id++) {
+    if (!keep[id]) { remap[id] = -1; continue; }
+    remap[id] = n;
+    g->names[n] = arena_strndup(&strings, g->names[id], g->name_len[id]);
+    g->name_len[n] = g->name_len[id];
+    g->name_hash[n] = g->name_hash[id];
+    n++;
+  }
+  arena_free(&g->strings);
+  g->strings = strings;
+  g->n_names = n;
+  int m = 0;
+  for (int e=0; e<g->n_edges; e++) {
+    int caller = remap[g->edges[e].caller], callee = remap[g->edges[e].callee];
+    if (caller < 0 || callee < 0) continue;
+    g->edges[m].caller = caller;
+    g->edges[m].callee = callee;
+    g->edges[m].count = g->edges[e].count;
+    m++;
+  }
+  g->n_edges = m;
+  rehash_names(g);
+  rehash_edges(g);
+}
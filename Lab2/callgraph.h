@@ -0,0 +1,52 @@
+#ifndef LAB2_CALLGRAPH_H
+#define LAB2_CALLGRAPH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h"
+
+// Call graph over interned function names. Names get dense ids in the order
+// they are first interned; edges are aggregated per (caller, callee) pair and
+// kept in the order they were first seen. Both lookups are open-addressing
+// hash tables, so building the graph is linear in the number of call sites.
+typedef struct CallEdge {
+  int caller;
+  int callee;
+  int count;
+} CallEdge;
+
+typedef struct CallGraph {
+  Arena strings;     /* interned names */
+  char **names;      /* id -> NUL-terminated name */
+  uint32_t *name_len;
+  uint64_t *name_hash;
+  int n_names;
+  int cap_names;
+  int *name_slots;   /* -1 = empty, otherwise a name id */
+  size_t name_mask;
+  CallEdge *edges;
+  int n_edges;
+  int cap_edges;
+  int *edge_slots;   /* -1 = empty, otherwise an edge index */
+  size_t edge_mask;
+} CallGraph;
+
+void callgraph_init(CallGraph *g);
+void callgraph_free(CallGraph *g);
+
+// id of name[0..len), adding it if it is new
+int callgraph_intern(CallGraph *g, const char *name, size_t len);
+// id of name[0..len), or -1 if it was never interned
+int callgraph_find(const CallGraph *g, const char *name, size_t len);
+// add count calls from caller to callee (both ids)
+void callgraph_add_call(CallGraph *g, int caller, int callee, int count);
+// take back count calls from caller to callee; an edge left without calls is
+// removed and the last edge takes its index, so edges are no longer in the
+// order they were first seen. 1 if the edge was removed.
+int callgraph_drop_call(CallGraph *g, int caller, int callee, int count);
+// Keep only the names with keep[id] set, renumbered in order (remap[id] is
+// the new id, or -1), and the edges between them. The kept strings are
+// copied to a new arena, so the dropped ones are released. O(names + edges).
+void callgraph_compact(CallGraph *g, const unsigned char *keep, int *remap);
+
+#endif
@@ -0,0 +1,141 @@
+#include "cfg_cache.h"
+#include "cfgbin.h"
+#include "hash.h"
+#include "node_kind.h"
+#include "source_map.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Entry layout (native byte order): EntryHeader, then the records of
+// cfgbin_write_function() section by section (nodes, edges, stmts, exprs,
+// calls, binops) and the strings that are not slices of the function. The
+// function source itself is not stored; it is the cache key.
+#define ENTRY_MAGIC 0x46433243u /* "C2CF" */
+
+typedef struct EntryHeader {
+  uint32_t magic;
+  uint32_t format;
+  uint64_t stamp;
+  uint64_t key[2];
+  CfgBinFunc f;
+} EntryHeader;
+
+int cfg_cache_open(CfgCache *c, const char *dir, const TSLanguage *lang) {
+  memset(c, 0, sizeof(*c));
+  if (mkdir(dir, 0755) != 0 && errno != EEXIST) return -1;
+  c->dir = strdup(dir);
+  uint64_t parts[3] = { CFG_CACHE_FORMAT, ts_language_version(lang), ts_language_symbol_count(lang) };
+  c->stamp = hash64(node_kind_table, node_kind_table_len, hash64(parts, sizeof(parts), 0));
+  return 0;
+}
+
+void cfg_cache_close(CfgCache *c) {
+  free(c->dir);
+  c->dir = NULL;
+}
+
+static void entry_key(const CfgCache *c, const char *text, uint32_t len, uint64_t key[2]) {
+  key[0] = hash64(text, len, c->stamp);
+  key[1] = hash64(text, len, c->stamp ^ 0x9E3779B97F4A7C15ULL);
+}
+
+// <dir>/<first two hex digits>/<32 hex digits>; with subdir_only the directory
+static void entry_path(const CfgCache *c, const uint64_t key[2], char *out, size_t out_len, int subdir_only) {
+  char hex[33];
+  snprintf(hex, sizeof(hex), "%016llx%016llx", (unsigned long long)key[0], (unsigned long long)key[1]);
+  if (subdir_only) snprintf(out, out_len, "%s/%.2s", c->dir, hex);
+  else snprintf(out, out_len, "%s/%.2s/%s", c->dir, hex, hex);
+}
+
+// ---- store ----
+
+void cfg_cache_store(const CfgCache *c, const SourceText *fn, const FrozenCFG *cfg) {
+  static unsigned long tmp_seq;
+  if (!cfg) return;
+  uint64_t key[2];
+  entry_key(c, fn->data, fn->len, key);
+  char path[1024], tmp[1100];
+  entry_path(c, key, path, sizeof(path), 1);
+  if (mkdir(path, 0755) != 0 && errno != EEXIST) return;
+  entry_path(c, key, path, sizeof(path), 0);
+  snprintf(tmp, sizeof(tmp), "%s.tmp.%ld.%lu", path, (long)getpid(), __atomic_fetch_add(&tmp_seq, 1, __ATOMIC_RELAXED));
+  FILE *f = fopen(tmp, "wb");
+  if (!f) return;
+
+  enum { S_NODES, S_EDGES, S_STMTS, S_EXPRS, S_CALLS, S_BINOPS, S_POOL, S_COUNT };
+  char *buf[S_COUNT];
+  size_t len[S_COUNT];
+  FILE *mf[S_COUNT];
+  for (int k=0;k<S_COUNT;k++) mf[k] = open_memstream(&buf[k], &len[k]);
+  CfgBinStreams out = { mf[S_NODES], mf[S_EDGES], mf[S_STMTS], mf[S_EXPRS], mf[S_CALLS], mf[S_BINOPS], mf[S_POOL], 0 };
+  EntryHeader h;
+  memset(&h, 0, sizeof(h));
+  h.magic = ENTRY_MAGIC;
+  h.format = CFG_CACHE_FORMAT;
+  h.stamp = c->stamp;
+  h.key[0] = key[0]; h.key[1] = key[1];
+  cfgbin_write_function(cfg, fn->data, fn->base, fn->len, &out, &h.f);
+  fwrite(&h, sizeof(h), 1, f);
+  for (int k=0;k<S_COUNT;k++) {
+    fclose(mf[k]);
+    if (len[k] > 0) fwrite(buf[k], 1, len[k], f);
+    free(buf[k]);
+  }
+  int bad = ferror(f);
+  if (fclose(f) != 0 || bad || rename(tmp, path) != 0) unlink(tmp);
+}
+
+// ---- load ----
+
+typedef struct Reader {
+  const char *p;
+  size_t left;
+} Reader;
+
+static const void *take(Reader *r, size_t n) {
+  if (n > r->left) return NULL;
+  const void *p = r->p;
+  r->p += n;
+  r->left -= n;
+  return p;
+}
+
+static FrozenCFG *read_entry(const CfgCache *c, Arena *arena, Reader *r, const uint64_t key[2], const char *fn, uint32_t fn_start, uint32_t fn_len) {
+  const EntryHeader *h = take(r, sizeof(EntryHeader));
+  if (!h) return NULL;
+  if (h->magic != ENTRY_MAGIC || h->format != CFG_CACHE_FORMAT || h->stamp != c->stamp) return NULL;
+  if (h->key[0] != key[0] || h->key[1] != key[1]) return NULL;
+  const CfgBinFunc *f = &h->f;
+  if (f->end_byte < f->start_byte || f->end_byte - f->start_byte != fn_len || f->text_len < fn_len) return NULL;
+  CfgBinFuncView v;
+  v.f = f;
+  v.nodes = take(r, sizeof(CfgBinNode) * (size_t)f->n_nodes);
+  v.edges = take(r, sizeof(CfgBinEdge) * (size_t)f->n_edges);
+  v.stmts = take(r, sizeof(CfgBinStmt) * (size_t)f->n_stmts);
+  v.exprs = take(r, sizeof(CfgBinExpr) * (size_t)f->n_exprs);
+  v.calls = take(r, sizeof(CfgBinCallSite) * (size_t)f->n_calls);
+  v.binops = take(r, f->n_binops);
+  const char *pool = take(r, f->text_len - fn_len);
+  if (!v.nodes || !v.edges || !v.stmts || !v.exprs || !v.calls || !v.binops || !pool) return NULL;
+  // the map goes away after loading: strings must live in the arena
+  v.text = NULL;
+  v.pool = arena_strndup(arena, pool, f->text_len - fn_len);
+  return cfgbin_thaw_function(arena, &v, fn, fn_start);
+}
+
+FrozenCFG *cfg_cache_load(const CfgCache *c, Arena *arena, const SourceText *fn) {
+  uint64_t key[2];
+  entry_key(c, fn->data, fn->len, key);
+  char path[1024];
+  entry_path(c, key, path, sizeof(path), 0);
+  SourceMap m;
+  if (source_map_open(path, &m) != 0) return NULL;
+  Reader r = { m.data, m.len };
+  FrozenCFG *cfg = read_entry(c, arena, &r, key, fn->data, fn->base, fn->len);
+  source_map_close(&m);
+  return cfg;
+}
@@ -0,0 +1,39 @@
+#ifndef LAB2_CFG_CACHE_H
+#define LAB2_CFG_CACHE_H
+
+#include <stdint.h>
+#include <tree_sitter/api.h>
+#include "arena.h"
+#include "flow.h"
+
+// On-disk cache of per-function CFGs (--cache-dir). A CFG depends only on the
+// bytes of its funcDef, so an entry is keyed by a 128-bit hash of those bytes
+// plus a stamp of the entry format and the grammar's symbol table. An entry
+// holds the frozen CFG, its IR and its call sites as cfgbin.h records; text
+// that comes from the function is stored as offsets into it and re-pointed at
+// the current source on load, everything else (placeholders, node type names)
+// is stored inline.
+//
+// Entries are written to a temporary file and renamed into place, so workers
+// and concurrent runs can share one directory.
+typedef struct CfgCache {
+  char *dir;
+  uint64_t stamp;
+  unsigned long hits;   /* run totals, kept by the committing thread */
+  unsigned long misses;
+} CfgCache;
+
+// Bump when the CFG builder or the entry layout changes.
+#define CFG_CACHE_FORMAT 4
+
+// create dir if needed; node_kinds_init() must have run. 0 on success.
+int cfg_cache_open(CfgCache *c, const char *dir, const TSLanguage *lang);
+void cfg_cache_close(CfgCache *c);
+
+// The CFG of the function whose funcDef text is fn, allocated from arena, or
+// NULL if there is no usable entry.
+FrozenCFG *cfg_cache_load(const CfgCache *c, Arena *arena, const SourceText *fn);
+// Best effort: write errors only cost a rebuild next time.
+void cfg_cache_store(const CfgCache *c, const SourceText *fn, const FrozenCFG *cfg);
+
+#endif
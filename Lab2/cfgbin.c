@@ -0,0 +1,513 @@
+#include "cfgbin.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ---- one function ----
+
+typedef struct FnWriter {
+  const char *fn;  /* function text */
+  uint32_t fn_len;
+  FILE *text;
+  uint32_t text_len;  /* function source plus strings appended so far */
+  const IrExpr **exprs;
+  int n_exprs;
+  int cap_exprs;
+} FnWriter;
+
+static CfgBinText text_ref(FnWriter *w, const char *p, uint32_t len) {
+  CfgBinText r;
+  r.len = len;
+  if (!p) { r.off = CFGBIN_NO_TEXT; return r; }
+  uintptr_t v = (uintptr_t)p, lo = (uintptr_t)w->fn;
+  if (v >= lo && v - lo <= w->fn_len && len <= w->fn_len - (v - lo)) { r.off = (uint32_t)(v - lo); return r; }
+  r.off = w->text_len;
+  if (len > 0) fwrite(p, 1, len, w->text);
+  w->text_len += len;
+  return r;
+}
+
+static int32_t push_expr(FnWriter *w, const IrExpr *e) {
+  if (!e) return -1;
+  if (w->n_exprs + 1 > w->cap_exprs) {
+    w->cap_exprs = (w->cap_exprs == 0) ? 64 : w->cap_exprs * 2;
+    w->exprs = realloc(w->exprs, sizeof(*w->exprs) * w->cap_exprs);
+  }
+  w->exprs[w->n_exprs] = e;
+  return w->n_exprs++;
+}
+
+void cfgbin_write_function(const FrozenCFG *cfg, const char *fn_text, uint32_t fn_start, uint32_t fn_len, const CfgBinStreams *out, CfgBinFunc *f) {
+  FnWriter w;
+  memset(&w, 0, sizeof(w));
+  w.fn = fn_text;
+  w.fn_len = fn_len;
+  w.text = out->text;
+  w.text_len = fn_len;
+  if (out->with_source && fn_len > 0) fwrite(fn_text, 1, fn_len, out->text);
+
+  int n = cfg->n_nodes;
+  for (int i=0;i<n;i++) {
+    CfgBinNode x;
+    memset(&x, 0, sizeof(x));
+    x.role = cfg->role[i];
+    x.stmt_start = (uint32_t)cfg->ops_start[i];
+    x.n_stmts = (uint32_t)(cfg->ops_start[i+1] - cfg->ops_start[i]);
+    x.edge_start = (uint32_t)cfg->succ_start[i];
+    x.n_edges = (uint32_t)(cfg->succ_start[i+1] - cfg->succ_start[i]);
+    fwrite(&x, sizeof(x), 1, out->nodes);
+  }
+  for (int i=0;i<cfg->n_edges;i++) {
+    CfgBinEdge x;
+    memset(&x, 0, sizeof(x));
+    x.to = (uint32_t)cfg->succ[i];
+    x.kind = cfg->succ_kind[i];
+    fwrite(&x, sizeof(x), 1, out->edges);
+  }
+  int n_stmts = cfg->ops_start[n];
+  for (int i=0;i<n_stmts;i++) {
+    const IrStmt *s = &cfg->ops[i];
+    CfgBinStmt x;
+    memset(&x, 0, sizeof(x));
+    x.kind = s->kind;
+    x.text = text_ref(&w, s->text, s->text_len);
+    x.name = text_ref(&w, s->name, s->name_len);
+    x.target = push_expr(&w, s->target);
+    x.expr = push_expr(&w, s->expr);
+    fwrite(&x, sizeof(x), 1, out->stmts);
+  }
+  // breadth-first: the list grows behind the index while it is walked, so
+  // the arguments of each expression are consecutive records
+  uint32_t n_binops = 0;
+  for (int i=0;i<w.n_exprs;i++) {
+    const IrExpr *e = w.exprs[i];
+    CfgBinExpr x;
+    memset(&x, 0, sizeof(x));
+    x.kind = e->kind; x.group = e->group; x.op = e->op;
+    x.n_args = (uint32_t)e->n_args;
+    x.first_arg = (uint32_t)w.n_exprs;
+    for (int k=0;k<e->n_args;k++) push_expr(&w, e->args[k]);
+    x.binop_off = n_binops;
+    if (e->kind == IR_BINARY && e->n_args > 0) {
+      fwrite(e->ops, 1, (size_t)e->n_args - 1, out->binops);
+      n_binops += (uint32_t)e->n_args - 1;
+    }
+    x.start_byte = e->start_byte;
+    x.text = text_ref(&w, e->text, e->len);
+    fwrite(&x, sizeof(x), 1, out->exprs);
+  }
+  for (int k=0;k<cfg->n_calls;k++) {
+    CfgBinCallSite x;
+    x.callee = text_ref(&w, cfg->calls[k].callee, cfg->calls[k].callee_len);
+    x.byte = cfg->calls[k].byte;
+    fwrite(&x, sizeof(x), 1, out->calls);
+  }
+  free(w.exprs);
+
+  f->start_byte = fn_start;
+  f->end_byte = fn_start + fn_len;
+  f->text_len = w.text_len;
+  f->n_nodes = (uint32_t)n;
+  f->n_edges = (uint32_t)cfg->n_edges;
+  f->n_stmts = (uint32_t)n_stmts;
+  f->n_exprs = (uint32_t)w.n_exprs;
+  f->n_binops = n_binops;
+  f->n_calls = (uint32_t)cfg->n_calls;
+}
+
+typedef struct Resolver {
+  const char *fn;
+  uint32_t fn_len;
+  const char *pool;
+  uint32_t pool_len;
+} Resolver;
+
+static int resolve(const Resolver *rs, CfgBinText t, const char **out) {
+  if (t.off == CFGBIN_NO_TEXT) { *out = NULL; return t.len == 0; }
+  if (t.off < rs->fn_len) {
+    if (t.len > rs->fn_len - t.off) return 0;
+    *out = rs->fn + t.off;
+    return 1;
+  }
+  uint32_t off = t.off - rs->fn_len;
+  if (off > rs->pool_len || t.len > rs->pool_len - off) return 0;
+  *out = rs->pool + off;
+  return 1;
+}
+
+// fewest arguments the renderer reads for each IrExprKind
+static const uint32_t min_args[IR_INDEX + 1] = {
+  [IR_UNARY] = 1,
+  [IR_BINARY] = 2,
+  [IR_INDEX] = 1,
+};
+
+// kind, group and op in range, enough arguments, and arguments behind the
+// expression (breadth-first order), so rendering cannot loop
+static int expr_ok(const CfgBinExpr *x, uint32_t i) {
+  if (x->kind > IR_INDEX || x->group > IR_GROUP_MUL || x->op > IR_OP_BIT_NOT) return 0;
+  if (x->n_args < min_args[x->kind]) return 0;
+  return x->n_args == 0 || x->first_arg > i;
+}
+
+FrozenCFG *cfgbin_thaw_function(Arena *arena, const CfgBinFuncView *v, const char *fn_text, uint32_t fn_start) {
+  const CfgBinFunc *f = v->f;
+  if (f->end_byte < f->start_byte || f->text_len < f->end_byte - f->start_byte) return NULL;
+  uint32_t fn_len = f->end_byte - f->start_byte;
+  uint32_t shift = fn_start - f->start_byte; /* wraps for moves towards the start */
+  Resolver rs = { fn_text, fn_len, v->pool, f->text_len - fn_len };
+
+  IrExpr *exprs = arena_alloc(arena, sizeof(IrExpr) * ((size_t)f->n_exprs + 1));
+  for (uint32_t i=0;i<f->n_exprs;i++) {
+    const CfgBinExpr *x = &v->exprs[i];
+    IrExpr *e = &exprs[i];
+    memset(e, 0, sizeof(*e));
+    if (!expr_ok(x, i)) return NULL;
+    e->kind = x->kind; e->group = x->group; e->op = x->op;
+    if (x->first_arg > f->n_exprs || x->n_args > f->n_exprs - x->first_arg) return NULL;
+    if (!resolve(&rs, x->text, &e->text)) return NULL;
+    if (!e->text) e->text = "";
+    e->len = x->text.len;
+    e->start_byte = x->start_byte + shift;
+    e->n_args = (int)x->n_args;
+    e->args = arena_alloc(arena, sizeof(IrExpr*) * (x->n_args ? x->n_args : 1));
+    for (uint32_t k=0;k<x->n_args;k++) e->args[k] = &exprs[x->first_arg + k];
+    if (x->kind == IR_BINARY && x->n_args > 0) {
+      if (x->binop_off > f->n_binops || x->n_args - 1 > f->n_binops - x->binop_off) return NULL;
+      e->ops = arena_alloc(arena, x->n_args);
+      memcpy(e->ops, v->binops + x->binop_off, x->n_args - 1);
+      for (uint32_t k=0;k+1<x->n_args;k++) if (e->ops[k] > IR_OP_BIT_NOT) return NULL;
+    }
+  }
+
+  CFG *cfg = cfg_new(arena);
+  for (uint32_t i=0;i<f->n_nodes;i++) {
+    if (v->nodes[i].role >= CFG_ROLE_COUNT) return NULL;
+    cfg_add_node(cfg, (CFGRole)v->nodes[i].role);
+  }
+  for (uint32_t i=0;i<f->n_nodes;i++) {
+    const CfgBinNode *x = &v->nodes[i];
+    if (x->stmt_start > f->n_stmts || x->n_stmts > f->n_stmts - x->stmt_start) return NULL;
+    if (x->edge_start > f->n_edges || x->n_edges > f->n_edges - x->edge_start) return NULL;
+    for (uint32_t k=x->stmt_start;k<x->stmt_start+x->n_stmts;k++) {
+      const CfgBinStmt *y = &v->stmts[k];
+      IrStmt s;
+      memset(&s, 0, sizeof(s));
+      if (y->kind > IRS_VAR_DECL) return NULL;
+      s.kind = y->kind;
+      if (!resolve(&rs, y->text, &s.text) || !resolve(&rs, y->name, &s.name)) return NULL;
+      s.text_len = y->text.len;
+      s.name_len = y->name.len;
+      if (y->target >= (int32_t)f->n_exprs || y->expr >= (int32_t)f->n_exprs) return NULL;
+      s.target = (y->target >= 0) ? &exprs[y->target] : NULL;
+      s.expr = (y->expr >= 0) ? &exprs[y->expr] : NULL;
+      cfg_node_add_stmt(cfg, (int)i, &s);
+    }
+    for (uint32_t k=x->edge_start;k<x->edge_start+x->n_edges;k++) {
+      if (v->edges[k].to >= f->n_nodes || v->edges[k].kind > CFG_EDGE_BREAK) return NULL;
+      cfg_add_edge(cfg, (int)i, (int)v->edges[k].to, (CFGEdgeKind)v->edges[k].kind);
+    }
+  }
+
+  cfg->calls = arena_alloc(arena, sizeof(CallSite) * ((size_t)f->n_calls + 1));
+  for (uint32_t k=0;k<f->n_calls;k++) {
+    CallSite *cs = &cfg->calls[k];
+    if (!resolve(&rs, v->calls[k].callee, &cs->callee)) return NULL;
+    if (!cs->callee) cs->callee = "";
+    cs->callee_len = v->calls[k].callee.len;
+    cs->byte = v->calls[k].byte + shift;
+  }
+  cfg->n_calls = cfg->cap_calls = (int)f->n_calls;
+  return cfg_freeze(cfg);
+}
+
+// ---- one input file ----
+
+static const size_t record_size[CFGBIN_SECTION_COUNT] = {
+  [CFGBIN_BLOB] = 1,
+  [CFGBIN_STRINGS] = sizeof(CfgBinString),
+  [CFGBIN_FILES] = sizeof(CfgBinFile),
+  [CFGBIN_FUNCS] = sizeof(CfgBinFunc),
+  [CFGBIN_NODES] = sizeof(CfgBinNode),
+  [CFGBIN_EDGES] = sizeof(CfgBinEdge),
+  [CFGBIN_STMTS] = sizeof(CfgBinStmt),
+  [CFGBIN_EXPRS] = sizeof(CfgBinExpr),
+  [CFGBIN_CALLS] = sizeof(CfgBinCallSite),
+  [CFGBIN_CALL_EDGES] = sizeof(CfgBinCallEdge),
+  [CFGBIN_BINOPS] = 1,
+};
+
+void cfgbin_part_init(CfgBinPart *p) {
+  memset(p, 0, sizeof(*p));
+  for (int s=0;s<CFGBIN_SECTION_COUNT;s++) p->f[s] = open_memstream(&p->buf[s], &p->len[s]);
+  p->names_f = open_memstream(&p->names, &p->names_len);
+}
+
+void cfgbin_part_add_function(CfgBinPart *p, const char *name, const FrozenCFG *cfg, const SourceText *fn) {
+  CfgBinStreams out = {
+    p->f[CFGBIN_NODES], p->f[CFGBIN_EDGES], p->f[CFGBIN_STMTS], p->f[CFGBIN_EXPRS],
+    p->f[CFGBIN_CALLS], p->f[CFGBIN_BINOPS], p->f[CFGBIN_BLOB], 1
+  };
+  CfgBinFunc f;
+  memset(&f, 0, sizeof(f));
+  // bases are relative to the part until cfgbin_writer_add_file()
+  f.text = p->count[CFGBIN_BLOB];
+  f.node_base = p->count[CFGBIN_NODES];
+  f.edge_base = p->count[CFGBIN_EDGES];
+  f.stmt_base = p->count[CFGBIN_STMTS];
+  f.expr_base = p->count[CFGBIN_EXPRS];
+  f.binop_base = p->count[CFGBIN_BINOPS];
+  f.call_base = p->count[CFGBIN_CALLS];
+  cfgbin_write_function(cfg, fn->data, fn->base, fn->len, &out, &f);
+  p->count[CFGBIN_BLOB] += f.text_len;
+  p->count[CFGBIN_NODES] += f.n_nodes;
+  p->count[CFGBIN_EDGES] += f.n_edges;
+  p->count[CFGBIN_STMTS] += f.n_stmts;
+  p->count[CFGBIN_EXPRS] += f.n_exprs;
+  p->count[CFGBIN_BINOPS] += f.n_binops;
+  p->count[CFGBIN_CALLS] += f.n_calls;
+  fwrite(&f, sizeof(f), 1, p->f[CFGBIN_FUNCS]);
+  p->count[CFGBIN_FUNCS]++;
+  fwrite(name, 1, strlen(name) + 1, p->names_f);
+}
+
+void cfgbin_part_free(CfgBinPart *p) {
+  for (int s=0;s<CFGBIN_SECTION_COUNT;s++) {
+    if (p->f[s]) fclose(p->f[s]);
+    free(p->buf[s]);
+  }
+  if (p->names_f) fclose(p->names_f);
+  free(p->names);
+  memset(p, 0, sizeof(*p));
+}
+
+// ---- whole run ----
+
+int cfgbin_writer_open(CfgBinWriter *w) {
+  memset(w, 0, sizeof(*w));
+  callgraph_init(&w->strings);
+  for (int s=0;s<CFGBIN_SECTION_COUNT;s++) {
+    w->sec[s] = tmpfile();
+    if (!w->sec[s]) w->failed = 1;
+  }
+  return w->failed ? -1 : 0;
+}
+
+static uint32_t writer_string(CfgBinWriter *w, const char *s, size_t len) {
+  int before = w->strings.n_names;
+  int id = callgraph_intern(&w->strings, s, len);
+  if (w->strings.n_names > before) {
+    CfgBinString x;
+    memset(&x, 0, sizeof(x));
+    x.off = w->count[CFGBIN_BLOB];
+    x.len = (uint32_t)len;
+    fwrite(s, 1, len, w->sec[CFGBIN_BLOB]);
+    w->count[CFGBIN_BLOB] += len;
+    fwrite(&x, sizeof(x), 1, w->sec[CFGBIN_STRINGS]);
+    w->count[CFGBIN_STRINGS]++;
+  }
+  return (uint32_t)id;
+}
+
+void cfgbin_writer_add_file(CfgBinWriter *w, const char *path, const CfgBinPart *p) {
+  if (w->failed) return;
+  for (int s=0;s<CFGBIN_SECTION_COUNT;s++) fflush(p->f[s]);
+  fflush(p->names_f);
+  CfgBinFile file;
+  memset(&file, 0, sizeof(file));
+  file.path = writer_string(w, path, strlen(path));
+  file.first_func = (uint32_t)w->count[CFGBIN_FUNCS];
+  file.n_funcs = p->count[CFGBIN_FUNCS];
+  uint32_t file_id = (uint32_t)w->count[CFGBIN_FILES];
+  fwrite(&file, sizeof(file), 1, w->sec[CFGBIN_FILES]);
+  w->count[CFGBIN_FILES]++;
+
+  // names first: interning may append to BLOB ahead of the part's text
+  const char *name = p->names;
+  uint32_t *name_ids = malloc(sizeof(uint32_t) * (p->count[CFGBIN_FUNCS] + 1));
+  for (uint32_t i=0;i<p->count[CFGBIN_FUNCS];i++) {
+    size_t len = strlen(name);
+    name_ids[i] = writer_string(w, name, len);
+    name += len + 1;
+  }
+  const CfgBinFunc *src = (const CfgBinFunc *)p->buf[CFGBIN_FUNCS];
+  for (uint32_t i=0;i<p->count[CFGBIN_FUNCS];i++) {
+    CfgBinFunc f = src[i];
+    f.name = name_ids[i];
+    f.file = file_id;
+    f.text += w->count[CFGBIN_BLOB];
+    f.node_base += (uint32_t)w->count[CFGBIN_NODES];
+    f.edge_base += (uint32_t)w->count[CFGBIN_EDGES];
+    f.stmt_base += (uint32_t)w->count[CFGBIN_STMTS];
+    f.expr_base += (uint32_t)w->count[CFGBIN_EXPRS];
+    f.binop_base += (uint32_t)w->count[CFGBIN_BINOPS];
+    f.call_base += (uint32_t)w->count[CFGBIN_CALLS];
+    fwrite(&f, sizeof(f), 1, w->sec[CFGBIN_FUNCS]);
+  }
+  w->count[CFGBIN_FUNCS] += p->count[CFGBIN_FUNCS];
+  free(name_ids);
+
+  static const CfgBinSectionId copied[] = { CFGBIN_BLOB, CFGBIN_NODES, CFGBIN_EDGES, CFGBIN_STMTS, CFGBIN_EXPRS, CFGBIN_CALLS, CFGBIN_BINOPS };
+  for (size_t k=0;k<sizeof(copied)/sizeof(copied[0]);k++) {
+    CfgBinSectionId s = copied[k];
+    if (p->len[s] > 0) fwrite(p->buf[s], 1, p->len[s], w->sec[s]);
+    w->count[s] += p->count[s];
+  }
+}
+
+void cfgbin_writer_add_calls(CfgBinWriter *w, const CallGraph *g, const unsigned char *defined, uint32_t file) {
+  if (w->failed) return;
+  for (int p=0;p<g->n_edges;p++) {
+    const CallEdge *e = &g->edges[p];
+    if (defined && !defined[e->callee]) continue;
+    CfgBinCallEdge x;
+    x.caller = writer_string(w, g->names[e->caller], g->name_len[e->caller]);
+    x.callee = writer_string(w, g->names[e->callee], g->name_len[e->callee]);
+    x.count = (uint32_t)e->count;
+    x.file = file;
+    fwrite(&x, sizeof(x), 1, w->sec[CFGBIN_CALL_EDGES]);
+    w->count[CFGBIN_CALL_EDGES]++;
+  }
+}
+
+static void pad_to_8(FILE *f, uint64_t *pos) {
+  static const char zeros[8];
+  size_t pad = (size_t)((8 - (*pos & 7)) & 7);
+  if (pad > 0) fwrite(zeros, 1, pad, f);
+  *pos += pad;
+}
+
+int cfgbin_writer_finish(CfgBinWriter *w, const char *path) {
+  int failed = w->failed;
+  FILE *out = failed ? NULL : fopen(path, "wb");
+  if (out) {
+    CfgBinHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, CFGBIN_MAGIC, sizeof(h.magic));
+    h.version = CFGBIN_VERSION;
+    h.header_size = sizeof(h);
+    uint64_t pos = sizeof(h);
+    for (int s=0;s<CFGBIN_SECTION_COUNT;s++) {
+      pos = (pos + 7) & ~(uint64_t)7;
+      h.sections[s].offset = pos;
+      h.sections[s].count = w->count[s];
+      pos += w->count[s] * record_size[s];
+    }
+    pos = sizeof(h);
+    fwrite(&h, sizeof(h), 1, out);
+    char buf[65536];
+    for (int s=0;s<CFGBIN_SECTION_COUNT;s++) {
+      pad_to_8(out, &pos);
+      rewind(w->sec[s]);
+      size_t n;
+      while ((n = fread(buf, 1, sizeof(buf), w->sec[s])) > 0) { fwrite(buf, 1, n, out); pos += n; }
+      if (ferror(w->sec[s])) failed = 1;
+    }
+    if (ferror(out)) failed = 1;
+    if (fclose(out) != 0) failed = 1;
+  } else failed = 1;
+  for (int s=0;s<CFGBIN_SECTION_COUNT;s++) if (w->sec[s]) fclose(w->sec[s]);
+  callgraph_free(&w->strings);
+  memset(w, 0, sizeof(*w));
+  return failed ? -1 : 0;
+}
+
+// ---- reading ----
+
+static int check_header(const CfgBinHeader *h, size_t len) {
+  if (len < sizeof(*h) || memcmp(h->magic, CFGBIN_MAGIC, sizeof(h->magic)) != 0) return -1;
+  if (h->version != CFGBIN_VERSION || h->header_size < sizeof(*h) || h->header_size > len) return -1;
+  for (int s=0;s<CFGBIN_SECTION_COUNT;s++) {
+    const CfgBinSection *sec = &h->sections[s];
+    if ((sec->offset & 7) != 0 || sec->offset > len) return -1;
+    if (sec->count > (len - sec->offset) / record_size[s]) return -1;
+    if (s != CFGBIN_BLOB && s != CFGBIN_BINOPS && sec->count > UINT32_MAX) return -1;
+  }
+  return 0;
+}
+
+// ranges that accessors and cfgbin_function() rely on
+static int check_records(const CfgBin *b) {
+  const CfgBinHeader *h = b->h;
+  uint64_t blob_len = h->sections[CFGBIN_BLOB].count;
+  for (uint32_t i=0;i<b->n_strings;i++) {
+    if (b->strings[i].off > blob_len || b->strings[i].len > blob_len - b->strings[i].off) return -1;
+  }
+  for (uint32_t i=0;i<b->n_files;i++) {
+    const CfgBinFile *f = &b->files[i];
+    if (f->path >= b->n_strings || f->first_func > b->n_funcs || f->n_funcs > b->n_funcs - f->first_func) return -1;
+  }
+  static const struct { CfgBinSectionId sec; size_t base, n; } ranges[] = {
+    { CFGBIN_NODES, offsetof(CfgBinFunc, node_base), offsetof(CfgBinFunc, n_nodes) },
+    { CFGBIN_EDGES, offsetof(CfgBinFunc, edge_base), offsetof(CfgBinFunc, n_edges) },
+    { CFGBIN_STMTS, offsetof(CfgBinFunc, stmt_base), offsetof(CfgBinFunc, n_stmts) },
+    { CFGBIN_EXPRS, offsetof(CfgBinFunc, expr_base), offsetof(CfgBinFunc, n_exprs) },
+    { CFGBIN_BINOPS, offsetof(CfgBinFunc, binop_base), offsetof(CfgBinFunc, n_binops) },
+    { CFGBIN_CALLS, offsetof(CfgBinFunc, call_base), offsetof(CfgBinFunc, n_calls) },
+  };
+  for (uint32_t i=0;i<b->n_funcs;i++) {
+    const CfgBinFunc *f = &b->funcs[i];
+    if (f->name >= b->n_strings || f->file >= b->n_files) return -1;
+    if (f->text > blob_len || f->text_len > blob_len - f->text) return -1;
+    for (size_t k=0;k<sizeof(ranges)/sizeof(ranges[0]);k++) {
+      uint32_t start, n;
+      memcpy(&start, (const char *)f + ranges[k].base, 4);
+      memcpy(&n, (const char *)f + ranges[k].n, 4);
+      uint64_t count = h->sections[ranges[k].sec].count;
+      if (start > count || n > count - start) return -1;
+    }
+  }
+  for (uint32_t i=0;i<b->n_call_edges;i++) {
+    const CfgBinCallEdge *e = &b->call_edges[i];
+    if (e->caller >= b->n_strings || e->callee >= b->n_strings) return -1;
+    if (e->file != CFGBIN_NO_TEXT && e->file >= b->n_files) return -1;
+  }
+  return 0;
+}
+
+int cfgbin_open(CfgBin *b, const char *path) {
+  memset(b, 0, sizeof(*b));
+  if (source_map_open(path, &b->map) != 0) return -1;
+  const CfgBinHeader *h = (const CfgBinHeader *)b->map.data;
+  if (check_header(h, b->map.len) != 0) { cfgbin_close(b); return -1; }
+  b->h = h;
+  const char *base = b->map.data;
+  b->blob = base + h->sections[CFGBIN_BLOB].offset;
+  b->strings = (const CfgBinString *)(base + h->sections[CFGBIN_STRINGS].offset);
+  b->n_strings = (uint32_t)h->sections[CFGBIN_STRINGS].count;
+  b->files = (const CfgBinFile *)(base + h->sections[CFGBIN_FILES].offset);
+  b->n_files = (uint32_t)h->sections[CFGBIN_FILES].count;
+  b->funcs = (const CfgBinFunc *)(base + h->sections[CFGBIN_FUNCS].offset);
+  b->n_funcs = (uint32_t)h->sections[CFGBIN_FUNCS].count;
+  b->nodes = (const CfgBinNode *)(base + h->sections[CFGBIN_NODES].offset);
+  b->edges = (const CfgBinEdge *)(base + h->sections[CFGBIN_EDGES].offset);
+  b->stmts = (const CfgBinStmt *)(base + h->sections[CFGBIN_STMTS].offset);
+  b->exprs = (const CfgBinExpr *)(base + h->sections[CFGBIN_EXPRS].offset);
+  b->calls = (const CfgBinCallSite *)(base + h->sections[CFGBIN_CALLS].offset);
+  b->call_edges = (const CfgBinCallEdge *)(base + h->sections[CFGBIN_CALL_EDGES].offset);
+  b->n_call_edges = (uint32_t)h->sections[CFGBIN_CALL_EDGES].count;
+  b->binops = (const uint8_t *)(base + h->sections[CFGBIN_BINOPS].offset);
+  if (check_records(b) != 0) { cfgbin_close(b); return -1; }
+  return 0;
+}
+
+void cfgbin_close(CfgBin *b) {
+  source_map_close(&b->map);
+  memset(b, 0, sizeof(*b));
+}
+
+CfgBinFuncView cfgbin_function(const CfgBin *b, uint32_t i) {
+  const CfgBinFunc *f = &b->funcs[i];
+  CfgBinFuncView v;
+  v.f = f;
+  v.nodes = b->nodes + f->node_base;
+  v.edges = b->edges + f->edge_base;
+  v.stmts = b->stmts + f->stmt_base;
+  v.exprs = b->exprs + f->expr_base;
+  v.calls = b->calls + f->call_base;
+  v.binops = b->binops + f->binop_base;
+  v.text = b->blob + f->text;
+  uint32_t fn_len = f->end_byte - f->start_byte;
+  v.pool = v.text + (fn_len <= f->text_len ? fn_len : f->text_len);
+  return v;
+}
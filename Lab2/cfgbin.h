@@ -0,0 +1,237 @@
+#ifndef LAB2_CFGBIN_H
+#define LAB2_CFGBIN_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "arena.h"
+#include "flow.h"
+#include "callgraph.h"
+#include "source_map.h"
+
+// Binary CFG records, used for the run artifact (--emit-bin) and for the
+// entries of the CFG cache. All records are fixed-size and 4-byte aligned,
+// every section starts on an 8-byte boundary, and byte order is the writer's,
+// so a mapped file is used in place.
+//
+// Indices inside a function's records are local to that function: node ids,
+// edge/stmt ranges, expression and argument indices, and text offsets into
+// the function's text segment. A CfgBinFunc holds the bases that locate its
+// records in the run-wide sections.
+
+#define CFGBIN_MAGIC "V2CFGBIN"
+#define CFGBIN_VERSION 1
+#define CFGBIN_NO_TEXT 0xffffffffu
+
+typedef enum CfgBinSectionId {
+  CFGBIN_BLOB,       /* bytes: function text segments and strings */
+  CFGBIN_STRINGS,    /* CfgBinString */
+  CFGBIN_FILES,      /* CfgBinFile */
+  CFGBIN_FUNCS,      /* CfgBinFunc */
+  CFGBIN_NODES,      /* CfgBinNode */
+  CFGBIN_EDGES,      /* CfgBinEdge, successors in CSR order */
+  CFGBIN_STMTS,      /* CfgBinStmt */
+  CFGBIN_EXPRS,      /* CfgBinExpr, breadth-first per function */
+  CFGBIN_CALLS,      /* CfgBinCallSite */
+  CFGBIN_CALL_EDGES, /* CfgBinCallEdge */
+  CFGBIN_BINOPS,     /* bytes: IrOp of every binary chain */
+  CFGBIN_SECTION_COUNT
+} CfgBinSectionId;
+
+typedef struct CfgBinSection {
+  uint64_t offset; /* from the start of the file */
+  uint64_t count;  /* records, or bytes for BLOB and BINOPS */
+} CfgBinSection;
+
+typedef struct CfgBinHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  CfgBinSection sections[CFGBIN_SECTION_COUNT];
+} CfgBinHeader;
+
+typedef struct CfgBinString {
+  uint64_t off; /* into BLOB */
+  uint32_t len;
+  uint32_t pad;
+} CfgBinString;
+
+typedef struct CfgBinFile {
+  uint32_t path;  /* string id */
+  uint32_t first_func;
+  uint32_t n_funcs;
+  uint32_t pad;
+} CfgBinFile;
+
+typedef struct CfgBinFunc {
+  uint32_t name;  /* string id */
+  uint32_t file;
+  uint32_t start_byte;  /* funcDef range in the source file */
+  uint32_t end_byte;
+  uint64_t text;  /* BLOB offset of the text segment: the funcDef source, then other strings */
+  uint32_t text_len;
+  uint32_t node_base, n_nodes;
+  uint32_t edge_base, n_edges;
+  uint32_t stmt_base, n_stmts;
+  uint32_t expr_base, n_exprs;
+  uint32_t binop_base, n_binops;
+  uint32_t call_base, n_calls;
+} CfgBinFunc;
+
+typedef struct CfgBinNode {
+  uint8_t role;  /* CFGRole */
+  uint8_t pad[3];
+  uint32_t stmt_start, n_stmts;
+  uint32_t edge_start, n_edges;
+} CfgBinNode;
+
+typedef struct CfgBinEdge {
+  uint32_t to;
+  uint8_t kind;  /* CFGEdgeKind */
+  uint8_t pad[3];
+} CfgBinEdge;
+
+// off is relative to the function's text segment; CFGBIN_NO_TEXT for none
+typedef struct CfgBinText {
+  uint32_t off;
+  uint32_t len;
+} CfgBinText;
+
+typedef struct CfgBinStmt {
+  uint8_t kind;  /* IrStmtKind */
+  uint8_t pad[3];
+  CfgBinText text;
+  CfgBinText name;
+  int32_t target;  /* expression index or -1 */
+  int32_t expr;
+} CfgBinStmt;
+
+typedef struct CfgBinExpr {
+  uint8_t kind, group, op, pad;
+  uint32_t n_args;
+  uint32_t first_arg;  /* arguments are the n_args expressions from here */
+  uint32_t binop_off;  /* IR_BINARY: n_args-1 operators in BINOPS */
+  uint32_t start_byte;
+  CfgBinText text;
+} CfgBinExpr;
+
+typedef struct CfgBinCallSite {
+  CfgBinText callee;
+  uint32_t byte;
+} CfgBinCallSite;
+
+typedef struct CfgBinCallEdge {
+  uint32_t caller;  /* string ids */
+  uint32_t callee;
+  uint32_t count;
+  uint32_t file;    /* file index, or CFGBIN_NO_TEXT for the --global-callgraph graph */
+} CfgBinCallEdge;
+
+// ---- writing one function ----
+
+// Destination streams for the records of a function. The text segment starts
+// with the function source (written only with with_source set) and goes on
+// with strings that are not slices of it.
+typedef struct CfgBinStreams {
+  FILE *nodes, *edges, *stmts, *exprs, *calls, *binops, *text;
+  int with_source;
+} CfgBinStreams;
+
+// Append the records of cfg, built from fn_text = source[fn_start, fn_start +
+// fn_len). f gets the ranges, the local counts and text_len; its bases, text,
+// name and file are left to the caller.
+void cfgbin_write_function(const FrozenCFG *cfg, const char *fn_text, uint32_t fn_start, uint32_t fn_len, const CfgBinStreams *out, CfgBinFunc *f);
+
+// Records of one function, as written by cfgbin_write_function.
+typedef struct CfgBinFuncView {
+  const CfgBinFunc *f;
+  const CfgBinNode *nodes;
+  const CfgBinEdge *edges;
+  const CfgBinStmt *stmts;
+  const CfgBinExpr *exprs;
+  const CfgBinCallSite *calls;
+  const uint8_t *binops;
+  const char *text;  /* text segment, or NULL if the source was left out */
+  const char *pool;  /* the segment past the function source */
+} CfgBinFuncView;
+
+// Rebuild a FrozenCFG in arena, checking every index, text range and enum
+// value and that each expression has the arguments its kind reads. Text
+// below the source length resolves into fn_text (v->text for an artifact),
+// and byte offsets are moved from f->start_byte to fn_start. NULL if the
+// records are inconsistent.
+FrozenCFG *cfgbin_thaw_function(Arena *arena, const CfgBinFuncView *v, const char *fn_text, uint32_t fn_start);
+
+// ---- writing a run (--emit-bin) ----
+
+// Records of one input file, filled by the worker that processes it.
+typedef struct CfgBinPart {
+  char *buf[CFGBIN_SECTION_COUNT];
+  size_t len[CFGBIN_SECTION_COUNT];
+  FILE *f[CFGBIN_SECTION_COUNT];
+  uint32_t count[CFGBIN_SECTION_COUNT];
+  char *names;  /* function names, NUL-separated, in CFGBIN_FUNCS order */
+  size_t names_len;
+  FILE *names_f;
+} CfgBinPart;
+
+void cfgbin_part_init(CfgBinPart *p);
+// fn is the funcDef text the CFG was built from
+void cfgbin_part_add_function(CfgBinPart *p, const char *name, const FrozenCFG *cfg, const SourceText *fn);
+void cfgbin_part_free(CfgBinPart *p);
+
+// Sections are spooled to temporary files as parts come in, and copied
+// behind the header by cfgbin_writer_finish(), so memory use does not grow
+// with the run. Strings (paths, function and callee names) are interned.
+typedef struct CfgBinWriter {
+  FILE *sec[CFGBIN_SECTION_COUNT];
+  uint64_t count[CFGBIN_SECTION_COUNT];
+  CallGraph strings;  /* string ids are name ids */
+  int failed;
+} CfgBinWriter;
+
+// 0 on success
+int cfgbin_writer_open(CfgBinWriter *w);
+// append the functions of one input; its file index is count[CFGBIN_FILES]-1
+void cfgbin_writer_add_file(CfgBinWriter *w, const char *path, const CfgBinPart *p);
+// append the edges of g whose callee is marked in defined (all if NULL)
+void cfgbin_writer_add_calls(CfgBinWriter *w, const CallGraph *g, const unsigned char *defined, uint32_t file);
+// write the artifact to path and release w; 0 on success
+int cfgbin_writer_finish(CfgBinWriter *w, const char *path);
+
+// ---- reading an artifact ----
+
+typedef struct CfgBin {
+  SourceMap map;
+  const CfgBinHeader *h;
+  const char *blob;
+  const CfgBinString *strings; uint32_t n_strings;
+  const CfgBinFile *files;     uint32_t n_files;
+  const CfgBinFunc *funcs;     uint32_t n_funcs;
+  const CfgBinNode *nodes;
+  const CfgBinEdge *edges;
+  const CfgBinStmt *stmts;
+  const CfgBinExpr *exprs;
+  const CfgBinCallSite *calls;
+  const CfgBinCallEdge *call_edges; uint32_t n_call_edges;
+  const uint8_t *binops;
+} CfgBin;
+
+// Map path and check the header, the section bounds and the ranges of every
+// string and function; the records inside a function are not checked here
+// (cfgbin_thaw_function does). 0 on success.
+int cfgbin_open(CfgBin *b, const char *path);
+void cfgbin_close(CfgBin *b);
+// records of function i
+CfgBinFuncView cfgbin_function(const CfgBin *b, uint32_t i);
+
+static inline const char *cfgbin_string(const CfgBin *b, uint32_t id, uint32_t *len) {
+  *len = b->strings[id].len;
+  return b->blob + b->strings[id].off;
+}
+
+// NULL for CFGBIN_NO_TEXT
+static inline const char *cfgbin_text(const CfgBinFuncView *v, CfgBinText t) {
+  return (t.off == CFGBIN_NO_TEXT) ? NULL : v->text + t.off;
+}
+
+#endif
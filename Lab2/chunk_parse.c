@@ -0,0 +1,389 @@
+#include "chunk_parse.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ---- pre-scan ----
+
+// lexer states
+enum { SC_CODE, SC_SLASH, SC_LINE_COMMENT, SC_BRACE_COMMENT, SC_STRING, SC_STRING_ESC, SC_CHAR1, SC_CHAR2, SC_WORD };
+// tokens that matter for finding functions and their ends
+enum { TK_SEMI, TK_METHOD, TK_BEGIN, TK_END, TK_VAR, TK_WORD, TK_LPAREN, TK_RPAREN, TK_OTHER };
+// progress through `method <name> (` at a possible function start
+enum { FN_NONE, FN_METHOD, FN_NAME };
+// chunk_index(): where the function being indexed is
+enum { CUR_NONE, CUR_ARGS, CUR_SIG, CUR_VARS, CUR_BODY, CUR_END };
+
+typedef struct SigBuf {
+  char *data;
+  size_t len;
+  size_t cap;
+} SigBuf;
+
+static void sig_push(SigBuf *b, char c) {
+  if (b->len + 1 > b->cap) { b->cap = (b->cap==0)?256:b->cap*2; b->data = realloc(b->data, b->cap); }
+  b->data[b->len++] = c;
+}
+
+typedef struct Scan {
+  int state;
+  int after_semi;  /* the last token was ';', or there was none yet */
+  int fn;
+  uint32_t word_start;
+  TSPoint word_point;
+  uint32_t word_len;
+  char word[8];     /* first bytes of the word, to spot keywords */
+  int word_keep;    /* the word may be a function name: copy it to name */
+  uint32_t last_end;  /* end of the last token */
+  ChunkFunc cand;   /* the function start being matched */
+  TSPoint point;    /* of the byte being scanned */
+  ChunkFuncFn cb;
+  void *ctx;
+  int stop;         /* cb asked to stop */
+  // chunk_index() only
+  int full;
+  int cur;
+  int depth;        /* parentheses in CUR_ARGS, begin/end in CUR_BODY */
+  ChunkFunc rec;    /* the function being indexed */
+  SigBuf spec;      /* bytes from a candidate's name on */
+  int spec_on;
+  uint32_t spec_start;
+  SigBuf sig;       /* rec's signature */
+} Scan;
+
+static void report(Scan *sc, const ChunkFunc *f) {
+  if (!sc->stop && sc->cb(sc->ctx, f)) sc->stop = 1;
+}
+
+// report rec, ending at end
+static void finish_rec(Scan *sc, uint32_t end, int complete) {
+  sc->rec.end_byte = end;
+  sc->rec.complete = complete;
+  sc->rec.sig = sc->sig.data;
+  if (!complete && (sc->cur == CUR_ARGS || sc->cur == CUR_SIG)) sc->rec.sig_len = 0;  /* never got to its end */
+  report(sc, &sc->rec);
+  sc->cur = CUR_NONE;
+}
+
+// the signature ends with the token before the one at hand
+static void end_signature(Scan *sc) {
+  sc->rec.sig_len = sc->last_end - sc->rec.sig_start;
+}
+
+// feed one token ending at end (exclusive); pos is the byte being scanned
+static void scan_token(Scan *sc, int tk, uint32_t pos, uint32_t end) {
+  int found = 0;
+  switch (tk) {
+    case TK_METHOD:
+      sc->fn = sc->after_semi ? FN_METHOD : FN_NONE;
+      sc->cand.byte = sc->word_start;
+      sc->cand.point = sc->word_point;
+      break;
+    case TK_LPAREN: found = sc->fn == FN_NAME; sc->fn = FN_NONE; break;
+    default:
+      // the name is any word, keywords included; the grammar decides later
+      sc->fn = (sc->fn == FN_METHOD && tk != TK_SEMI && tk != TK_RPAREN && tk != TK_OTHER) ? FN_NAME : FN_NONE;
+      break;
+  }
+  if (sc->fn == FN_NONE) sc->spec_on = 0;
+  if (found && !sc->full) report(sc, &sc->cand);
+  if (found && sc->full) {
+    // a new start inside a function means that function is broken
+    if (sc->cur != CUR_NONE) finish_rec(sc, sc->cand.byte, 0);
+    sc->rec = sc->cand;
+    sc->rec.sig_start = sc->spec_start;
+    SigBuf t = sc->sig; sc->sig = sc->spec; sc->spec = t;
+    sc->spec.len = 0;
+    sc->spec_on = 0;
+    sc->cur = CUR_ARGS;
+    sc->depth = 1;
+  } else if (sc->full) {
+    switch (sc->cur) {
+      case CUR_ARGS:
+        if (tk == TK_LPAREN) sc->depth++;
+        else if (tk == TK_RPAREN && --sc->depth == 0) sc->cur = CUR_SIG;
+        break;
+      case CUR_SIG:
+        if (tk == TK_VAR) { end_signature(sc); sc->cur = CUR_VARS; }
+        else if (tk == TK_BEGIN) { end_signature(sc); sc->cur = CUR_BODY; sc->depth = 1; }
+        else if (tk == TK_SEMI) { end_signature(sc); finish_rec(sc, pos + 1, 1); }
+        break;
+      case CUR_VARS:
+        if (tk == TK_BEGIN) { sc->cur = CUR_BODY; sc->depth = 1; }
+        break;
+      case CUR_BODY:
+        if (tk == TK_BEGIN) sc->depth++;
+        else if (tk == TK_END && --sc->depth == 0) sc->cur = CUR_END;
+        break;
+      case CUR_END:
+        if (tk == TK_SEMI) finish_rec(sc, pos + 1, 1);
+        else finish_rec(sc, sc->last_end, 0);
+        break;
+      default:
+        break;
+    }
+  }
+  sc->after_semi = tk == TK_SEMI;
+  sc->last_end = end;
+}
+
+static int is_word_char(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static int word_token(const Scan *sc) {
+  if (sc->word[0] >= '0' && sc->word[0] <= '9') return TK_OTHER;
+  if (sc->word_len == 6 && memcmp(sc->word, "method", 6) == 0) return TK_METHOD;
+  if (sc->word_len == 5 && memcmp(sc->word, "begin", 5) == 0) return TK_BEGIN;
+  if (sc->word_len == 3 && memcmp(sc->word, "end", 3) == 0) return TK_END;
+  if (sc->word_len == 3 && memcmp(sc->word, "var", 3) == 0) return TK_VAR;
+  return TK_WORD;
+}
+
+static void lex_byte(Scan *sc, char c, uint32_t pos) {
+  // a byte that ends a token is looked at again as code
+  for (;;) {
+    switch (sc->state) {
+      case SC_LINE_COMMENT: if (c == '\n') sc->state = SC_CODE; return;
+      case SC_BRACE_COMMENT: if (c == '}') sc->state = SC_CODE; return;
+      case SC_STRING:
+        if (c == '\\') sc->state = SC_STRING_ESC;
+        else if (c == '"') sc->state = SC_CODE;
+        return;
+      case SC_STRING_ESC: sc->state = SC_STRING; return;
+      case SC_CHAR1:
+        if (c != '\'' && c != '\\') { sc->state = SC_CHAR2; return; }
+        sc->state = SC_CODE;
+        continue;
+      case SC_CHAR2:
+        sc->state = SC_CODE;
+        if (c == '\'') return;
+        continue;
+      case SC_SLASH:
+        if (c == '/') { sc->state = SC_LINE_COMMENT; return; }
+        sc->state = SC_CODE;
+        scan_token(sc, TK_OTHER, pos, pos);
+        continue;
+      case SC_WORD:
+        if (is_word_char(c)) {
+          if (sc->word_len < sizeof(sc->word)) sc->word[sc->word_len] = c;
+          if (sc->word_keep && sc->word_len < CHUNK_NAME_MAX - 1) sc->cand.name[sc->word_len] = c;
+          sc->word_len++;
+          return;
+        }
+        sc->state = SC_CODE;
+        if (sc->word_keep) sc->cand.name[(sc->word_len < CHUNK_NAME_MAX) ? sc->word_len : CHUNK_NAME_MAX - 1] = '\0';
+        scan_token(sc, word_token(sc), pos, pos);
+        continue;
+      default:
+        break;
+    }
+    // SC_CODE
+    switch (c) {
+      case ' ': case '\t': case '\n': case '\r': case '\f': case '\v': return;
+      case '/': sc->state = SC_SLASH; return;
+      case '{': sc->state = SC_BRACE_COMMENT; return;
+      case '"': sc->state = SC_STRING; scan_token(sc, TK_OTHER, pos, pos + 1); return;
+      case '\'': sc->state = SC_CHAR1; scan_token(sc, TK_OTHER, pos, pos + 1); return;
+      case ';': scan_token(sc, TK_SEMI, pos, pos + 1); return;
+      case '(': scan_token(sc, TK_LPAREN, pos, pos + 1); return;
+      case ')': scan_token(sc, TK_RPAREN, pos, pos + 1); return;
+      default: break;
+    }
+    if (!is_word_char(c)) { scan_token(sc, TK_OTHER, pos, pos + 1); return; }
+    sc->state = SC_WORD;
+    sc->word_start = pos;
+    sc->word_point = sc->point;
+    sc->word_len = 1;
+    sc->word[0] = c;
+    sc->word_keep = sc->fn == FN_METHOD;
+    if (sc->word_keep) sc->cand.name[0] = c;
+    if (sc->word_keep && sc->full) { sc->spec_on = 1; sc->spec.len = 0; sc->spec_start = pos; }
+    return;
+  }
+}
+
+static void scan_byte(Scan *sc, char c, uint32_t pos) {
+  lex_byte(sc, c, pos);
+  if (sc->spec_on) sig_push(&sc->spec, c);
+  if (sc->cur == CUR_ARGS || sc->cur == CUR_SIG) sig_push(&sc->sig, c);
+  if (c == '\n') { sc->point.row++; sc->point.column = 0; }
+  else sc->point.column++;
+}
+
+static int run_scan(SourceReader *r, Scan *sc) {
+  uint32_t size = r->size;
+  sc->state = SC_CODE;
+  sc->after_semi = 1;
+  int rc = 0;
+  for (uint32_t pos = 0; pos < size && !sc->stop; ) {
+    uint32_t end = (size - pos > SOURCE_READER_WINDOW) ? pos + SOURCE_READER_WINDOW : size;
+    SourceText t;
+    if (source_reader_text(r, pos, end, &t) != 0) { rc = -1; break; }
+    for (uint32_t i = 0; i < t.len && !sc->stop; i++) scan_byte(sc, t.data[i], pos + i);
+    pos = end;
+  }
+  if (rc == 0 && !sc->stop) {
+    // end the last token, then whatever function is still open
+    lex_byte(sc, '\n', size);
+    if (sc->cur != CUR_NONE) finish_rec(sc, size, 0);
+  }
+  free(sc->spec.data);
+  free(sc->sig.data);
+  return rc;
+}
+
+int chunk_scan(SourceReader *r, ChunkFuncFn fn, void *ctx) {
+  Scan sc;
+  memset(&sc, 0, sizeof(sc));
+  sc.cb = fn;
+  sc.ctx = ctx;
+  return run_scan(r, &sc);
+}
+
+int chunk_index(SourceReader *r, ChunkFuncFn fn, void *ctx) {
+  Scan sc;
+  memset(&sc, 0, sizeof(sc));
+  sc.cb = fn;
+  sc.ctx = ctx;
+  sc.full = 1;
+  return run_scan(r, &sc);
+}
+
+// next token of a signature from *i, skipping blanks and comments; 0 at the end
+static int sig_token(const char *s, uint32_t len, uint32_t *i, uint32_t *ts, uint32_t *te) {
+  while (*i < len) {
+    char c = s[*i];
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v') { (*i)++; continue; }
+    if (c == '/' && *i + 1 < len && s[*i + 1] == '/') { while (*i < len && s[*i] != '\n') (*i)++; continue; }
+    if (c == '{') { while (*i < len && s[*i] != '}') (*i)++; if (*i < len) (*i)++; continue; }
+    *ts = *i;
+    if (is_word_char(c)) { while (*i < len && is_word_char(s[*i])) (*i)++; }
+    else (*i)++;
+    *te = *i;
+    return 1;
+  }
+  return 0;
+}
+
+int chunk_split_signature(const char *sig, uint32_t len, ChunkArg *args, int max_args, const char **ret, uint32_t *ret_len) {
+  uint32_t i = 0, ts = 0, te = 0;
+  *ret = NULL;
+  *ret_len = 0;
+  // name (
+  if (!sig_token(sig, len, &i, &ts, &te)) return 0;
+  if (!sig_token(sig, len, &i, &ts, &te) || sig[ts] != '(') return 0;
+  // argDef: name (':' typeRef)?, where a typeRef may hold commas in brackets
+  int n = 0, depth = 0, have = 0, in_type = 0;
+  ChunkArg cur;
+  memset(&cur, 0, sizeof(cur));
+  while (sig_token(sig, len, &i, &ts, &te)) {
+    char c = sig[ts];
+    if (depth == 0 && (c == ',' || c == ')')) {
+      if (have) { if (n < max_args) args[n] = cur; n++; }
+      memset(&cur, 0, sizeof(cur));
+      have = 0;
+      in_type = 0;
+      if (c == ')') break;
+      continue;
+    }
+    if (!have) { cur.name = sig + ts; cur.name_len = te - ts; have = 1; continue; }
+    if (!in_type) { in_type = c == ':'; continue; }
+    if (c == '[') depth++;
+    else if (c == ']') depth--;
+    if (!cur.type) cur.type = sig + ts;
+    cur.type_len = (uint32_t)(sig + te - cur.type);
+  }
+  // ':' typeRef up to the end
+  if (sig_token(sig, len, &i, &ts, &te) && sig[ts] == ':' && sig_token(sig, len, &i, &ts, &te)) {
+    *ret = sig + ts;
+    uint32_t last = te;
+    while (sig_token(sig, len, &i, &ts, &te)) last = te;
+    *ret_len = (uint32_t)(sig + last - *ret);
+  }
+  return n;
+}
+
+typedef struct Cuts {
+  TSRange *out;
+  int n;
+  int max;
+  uint64_t size;
+  uint64_t target;  /* the next cut goes at the first start at or after this */
+} Cuts;
+
+static int add_cut(void *ctx, const ChunkFunc *f) {
+  Cuts *c = ctx;
+  if (f->byte < c->target || f->byte <= c->out[c->n-1].start_byte) return 0;
+  c->out[c->n-1].end_byte = f->byte;
+  c->out[c->n-1].end_point = f->point;
+  memset(&c->out[c->n], 0, sizeof(TSRange));
+  c->out[c->n].start_byte = f->byte;
+  c->out[c->n].start_point = f->point;
+  c->n++;
+  c->target = c->size * (uint64_t)c->n / (uint64_t)c->max;
+  return c->n == c->max;
+}
+
+int chunk_find_ranges(SourceReader *r, int max_chunks, TSRange *out) {
+  memset(&out[0], 0, sizeof(TSRange));
+  // the k-th cut goes at the first function start at or after size*k/max_chunks
+  Cuts c = { out, 1, max_chunks, r->size, (uint64_t)r->size / (uint64_t)max_chunks };
+  if (max_chunks > 1) chunk_scan(r, add_cut, &c);
+  out[c.n-1].end_byte = UINT32_MAX;
+  out[c.n-1].end_point = (TSPoint){ UINT32_MAX, UINT32_MAX };
+  return c.n;
+}
+
+// ---- parallel parse ----
+
+typedef struct ChunkJob {
+  const SourceReader *r;
+  const TSLanguage *lang;
+  TSRange range;
+  TSTree *tree;  /* NULL if the chunk could not be read or has errors */
+} ChunkJob;
+
+static void *chunk_worker(void *arg) {
+  ChunkJob *j = arg;
+  SourceReader rd;
+  if (source_reader_clone(j->r, &rd) != 0) return NULL;
+  TSParser *parser = ts_parser_new();
+  if (ts_parser_set_language(parser, j->lang) && ts_parser_set_included_ranges(parser, &j->range, 1)) {
+    j->tree = ts_parser_parse(parser, NULL, source_reader_input(&rd));
+    if (j->tree && (rd.error || ts_node_has_error(ts_tree_root_node(j->tree)))) {
+      ts_tree_delete(j->tree);
+      j->tree = NULL;
+    }
+  }
+  ts_parser_delete(parser);
+  source_reader_close(&rd);
+  return NULL;
+}
+
+int chunk_parse(const SourceReader *r, const TSLanguage *lang, const TSRange *ranges, int n, TSTree **trees) {
+  ChunkJob *jobs = calloc((size_t)n, sizeof(ChunkJob));
+  pthread_t *threads = malloc(sizeof(pthread_t) * n);
+  char *started = calloc((size_t)n, 1);
+  for (int i=0;i<n;i++) {
+    jobs[i].r = r;
+    jobs[i].lang = lang;
+    jobs[i].range = ranges[i];
+    started[i] = pthread_create(&threads[i], NULL, chunk_worker, &jobs[i]) == 0;
+  }
+  // a chunk whose thread did not start is parsed here
+  for (int i=0;i<n;i++) {
+    if (started[i]) pthread_join(threads[i], NULL);
+    else chunk_worker(&jobs[i]);
+  }
+  int ok = 1;
+  for (int i=0;i<n;i++) if (!jobs[i].tree) ok = 0;
+  for (int i=0;i<n;i++) {
+    if (ok) trees[i] = jobs[i].tree;
+    else if (jobs[i].tree) ts_tree_delete(jobs[i].tree);
+  }
+  free(jobs);
+  free(threads);
+  free(started);
+  return ok ? 0 : -1;
+}
@@ -0,0 +1,77 @@
+#ifndef LAB2_CHUNK_PARSE_H
+#define LAB2_CHUNK_PARSE_H
+
+#include <stdint.h>
+#include <tree_sitter/api.h>
+#include "source_map.h"
+
+// Parsing one large input as several independent chunks (--parse-jobs).
+//
+// The grammar only has funcDef at the top level, so the input can be cut at
+// the `method` keyword that starts a function. A pre-scan lexes just enough
+// to skip comments (`//...`, `{...}`), strings and character literals, and
+// takes `method` as a boundary when it follows the start of the input or a
+// `;` and is followed by an identifier and `(`, which cannot occur inside a
+// body. Each chunk is then parsed on its own thread with its own TSParser,
+// restricted to the chunk with ts_parser_set_included_ranges(), so nodes
+// carry byte offsets and points of the whole input and need no adjusting.
+//
+// chunk_scan() is the pre-scan on its own; --function and --range use it to
+// find the text of the functions they select.
+//
+// A chunk tree with errors means the cut or the input is not clean; callers
+// then parse the input whole, so error recovery matches a serial run.
+
+// A function found by the pre-scan.
+#define CHUNK_NAME_MAX 256
+typedef struct ChunkFunc {
+  uint32_t byte;   /* offset of `method` */
+  TSPoint point;
+  char name[CHUNK_NAME_MAX];  /* NUL-terminated, truncated if longer */
+  // chunk_index() only
+  uint32_t end_byte;   /* past the closing `;` of the body or declaration */
+  int complete;        /* 0: the next function or the input started first */
+  uint32_t sig_start;  /* funcSignature text: from the name up to the body */
+  uint32_t sig_len;    /* 0 if its end was not reached */
+  const char *sig;     /* valid during the callback */
+} ChunkFunc;
+
+// nonzero stops the scan
+typedef int (*ChunkFuncFn)(void *ctx, const ChunkFunc *f);
+
+// Report every function start to fn, in source order. Reads the input once
+// through r; fn must not read through r itself. -1 on a read error.
+int chunk_scan(SourceReader *r, ChunkFuncFn fn, void *ctx);
+
+// Report every function once its end is found, with its signature text,
+// without parsing it: after the signature, `begin`/`end` are only counted
+// to find where the body closes. For indexing (--index-only).
+int chunk_index(SourceReader *r, ChunkFuncFn fn, void *ctx);
+
+// An argument of a funcSignature; type is NULL when it has none.
+typedef struct ChunkArg {
+  const char *name;
+  uint32_t name_len;
+  const char *type;
+  uint32_t type_len;
+} ChunkArg;
+
+// Split funcSignature text (as in ChunkFunc.sig) into its arguments and
+// return typeRef (*ret NULL if there is none). Returns the number of
+// arguments; only the first max_args are written to args.
+int chunk_split_signature(const char *sig, uint32_t len, ChunkArg *args, int max_args, const char **ret, uint32_t *ret_len);
+
+// chunks smaller than this are not worth a thread
+#define CHUNK_PARSE_MIN (256u * 1024u)
+
+// Split the input into at most max_chunks ranges of similar size, cut at
+// function starts. Returns the number of ranges written to out (1 if no cut
+// was found). Reads the input once through r.
+int chunk_find_ranges(SourceReader *r, int max_chunks, TSRange *out);
+
+// Parse ranges[i] into trees[i], each on its own thread, reading through
+// clones of r. 0 if every chunk parsed without errors; otherwise -1 and no
+// trees are left.
+int chunk_parse(const SourceReader *r, const TSLanguage *lang, const TSRange *ranges, int n, TSTree **trees);
+
+#endif
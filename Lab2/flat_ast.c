@@ -0,0 +1,162 @@
+#include "flat_ast.h"
+#include "hash.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+_Static_assert(sizeof(FlatNode) == 16, "FlatNode is a 16-byte on-disk record");
+_Static_assert(sizeof(FlatAstHeader) % 8 == 0, "nodes must stay aligned behind the header");
+
+// grow a heap block, or an arena block when arena is set
+static void *grow(Arena *arena, void *p, size_t old_size, size_t new_size) {
+  return arena ? arena_realloc(arena, p, old_size, new_size) : realloc(p, new_size);
+}
+
+static void reserve_nodes(FlatAst *a, Arena *arena, uint32_t n) {
+  if (n <= a->cap) return;
+  uint32_t cap = (a->cap == 0) ? 64 : a->cap;
+  while (cap < n) cap *= 2;
+  a->own = grow(arena, a->own, sizeof(FlatNode) * a->cap, sizeof(FlatNode) * cap);
+  a->cap = cap;
+}
+
+int flat_ast_build(FlatAst *a, Arena *arena, TSNode root) {
+  const TSLanguage *lang = ts_tree_language(root.tree);
+  if (ts_language_field_count(lang) > UINT8_MAX) return -1;
+  a->lang = lang;
+  a->n = 0;
+  a->source_len = 0;
+  a->source_hash = 0;
+  // a heap array from an earlier build is not reused by an arena build
+  if (arena) { free(a->own); a->own = NULL; a->cap = 0; }
+  // the cursor visits the visible nodes, the same ones descendant_count counts
+  reserve_nodes(a, arena, ts_node_descendant_count(root));
+  uint32_t *open = NULL; int depth = 0, cap = 0;  /* indices of unfinished ancestors */
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    reserve_nodes(a, arena, a->n + 1);
+    uint32_t i = a->n++;
+    FlatNode *f = &a->own[i];
+    f->symbol = ts_node_symbol(node);
+    f->field = (uint8_t)ts_tree_cursor_current_field_id(&cursor);
+    f->flags = (uint8_t)((ts_node_is_named(node) ? FLAT_NAMED : 0) | (ts_node_is_missing(node) ? FLAT_MISSING : 0));
+    f->start_byte = ts_node_start_byte(node);
+    f->end_byte = ts_node_end_byte(node);
+    f->size = 1;
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      if (depth + 1 > cap) {
+        int new_cap = (cap==0)?32:cap*2;
+        open = grow(arena, open, sizeof(uint32_t)*cap, sizeof(uint32_t)*new_cap);
+        cap = new_cap;
+      }
+      open[depth++] = i;
+      continue;
+    }
+    // leaving the last child of a node closes the node
+    int walking = 1;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (depth == 0 || !ts_tree_cursor_goto_parent(&cursor)) { walking = 0; break; }
+      uint32_t p = open[--depth];
+      a->own[p].size = a->n - p;
+    }
+    if (!walking) break;
+  }
+  ts_tree_cursor_delete(&cursor);
+  a->nodes = a->own;
+  if (arena) { a->own = NULL; a->cap = 0; }
+  else free(open);
+  return 0;
+}
+
+void flat_ast_free(FlatAst *a) {
+  free(a->own);
+  source_map_close(&a->map);
+  memset(a, 0, sizeof(*a));
+}
+
+uint64_t flat_ast_stamp(const TSLanguage *lang) {
+  uint64_t parts[3] = { FLAT_AST_VERSION, ts_language_version(lang), ts_language_symbol_count(lang) };
+  uint64_t h = hash64(parts, sizeof(parts), 0);
+  uint32_t n_symbols = ts_language_symbol_count(lang);
+  for (uint32_t s=0;s<n_symbols;s++) {
+    const char *name = ts_language_symbol_name(lang, (TSSymbol)s);
+    if (name) h = hash64(name, strlen(name) + 1, h);
+  }
+  uint32_t n_fields = ts_language_field_count(lang);
+  for (uint32_t f=1;f<=n_fields;f++) {
+    const char *name = ts_language_field_name_for_id(lang, (TSFieldId)f);
+    if (name) h = hash64(name, strlen(name) + 1, h);
+  }
+  return h;
+}
+
+int flat_ast_source_hash(SourceReader *r, uint64_t *out) {
+  uint64_t h = 0;
+  for (uint32_t at = 0; at < r->size; ) {
+    uint32_t end = (r->size - at > FLAT_HASH_BLOCK) ? at + FLAT_HASH_BLOCK : r->size;
+    SourceText t;
+    if (source_reader_text(r, at, end, &t) != 0 || t.len != end - at) return -1;
+    h = hash64(t.data, t.len, h);
+    at = end;
+  }
+  *out = h;
+  return 0;
+}
+
+int flat_ast_write(const FlatAst *a, uint64_t source_len, uint64_t source_hash, const char *path) {
+  FlatAstHeader h;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, FLAT_AST_MAGIC, sizeof(h.magic));
+  h.version = FLAT_AST_VERSION;
+  h.header_size = sizeof(h);
+  h.stamp = flat_ast_stamp(a->lang);
+  h.source_len = source_len;
+  h.source_hash = source_hash;
+  h.n_nodes = a->n;
+  FILE *f = fopen(path, "wb");
+  if (!f) return -1;
+  int bad = fwrite(&h, sizeof(h), 1, f) != 1;
+  if (!bad && a->n > 0) bad = fwrite(a->nodes, sizeof(FlatNode), a->n, f) != a->n;
+  if (fclose(f) != 0) bad = 1;
+  return bad ? -1 : 0;
+}
+
+int flat_ast_open(FlatAst *a, const char *path, const TSLanguage *lang) {
+  memset(a, 0, sizeof(*a));
+  if (source_map_open(path, &a->map) != 0) return -1;
+  const FlatAstHeader *h = (const FlatAstHeader *)a->map.data;
+  int ok = a->map.len >= sizeof(*h)
+        && memcmp(h->magic, FLAT_AST_MAGIC, sizeof(h->magic)) == 0
+        && h->version == FLAT_AST_VERSION
+        && h->header_size >= sizeof(*h) && h->header_size % 8 == 0 && h->header_size <= a->map.len
+        && h->stamp == flat_ast_stamp(lang)
+        && h->n_nodes >= 1 && h->n_nodes < FLAT_NONE
+        && h->n_nodes <= (a->map.len - h->header_size) / sizeof(FlatNode);
+  if (ok) {
+    a->nodes = (const FlatNode *)(a->map.data + h->header_size);
+    a->n = (uint32_t)h->n_nodes;
+    // every subtree inside the array and the root spanning all of it, so the
+    // child loops stay in bounds; symbols and fields that name something, so
+    // flat_type() and flat_field_name() never return NULL
+    uint32_t n_symbols = ts_language_symbol_count(lang);
+    uint32_t n_fields = ts_language_field_count(lang);
+    ok = a->nodes[0].size == a->n;
+    for (uint32_t i=0; ok && i<a->n; i++) {
+      const FlatNode *f = &a->nodes[i];
+      ok = f->size >= 1 && f->size <= a->n - i
+        && (f->symbol < n_symbols || f->symbol == (TSSymbol)-1)  /* ERROR */
+        && f->field <= n_fields;
+    }
+  }
+  if (!ok) {
+    flat_ast_free(a);
+    errno = EINVAL;
+    return -1;
+  }
+  a->lang = lang;
+  a->source_len = h->source_len;
+  a->source_hash = h->source_hash;
+  return 0;
+}
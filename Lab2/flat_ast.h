@@ -0,0 +1,127 @@
+#ifndef LAB2_FLAT_AST_H
+#define LAB2_FLAT_AST_H
+
+#include <stdint.h>
+#include <tree_sitter/api.h>
+#include "arena.h"
+#include "source_map.h"
+
+// Flat preorder snapshot of a tree-sitter (sub)tree: one 16-byte FlatNode per
+// visible node, built in one TSTreeCursor pass. Children of node i start at
+// i + 1 and follow each other at i + size steps, so a subtree is skipped in
+// O(1) and passes over it read a plain array instead of calling the node API
+// on every access.
+//
+//   for (uint32_t c = flat_first_child(a, i); c != FLAT_NONE; c = flat_next_sibling(a, i, c))
+//
+// A snapshot can be written to disk and mapped back with flat_ast_open(), so
+// later passes over the same file (dump, CFG, ...) do not parse it again.
+// The file records the grammar it was built with (flat_ast_stamp) and the
+// size and content hash of the source.
+
+#define FLAT_NONE 0xffffffffu
+
+#define FLAT_NAMED 1u
+#define FLAT_MISSING 2u
+
+typedef struct FlatNode {
+  uint16_t symbol;     /* ts_node_symbol, aliases resolved */
+  uint8_t field;       /* TSFieldId under the parent, 0 if none */
+  uint8_t flags;       /* FLAT_NAMED, FLAT_MISSING */
+  uint32_t start_byte;
+  uint32_t end_byte;
+  uint32_t size;       /* nodes in the subtree, this one included */
+} FlatNode;
+
+// File layout (native byte order): FlatAstHeader, then n_nodes FlatNode
+// records at offset header_size (a multiple of 8).
+#define FLAT_AST_MAGIC "V2FLATAS"
+#define FLAT_AST_VERSION 2
+
+typedef struct FlatAstHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  uint64_t stamp;       /* flat_ast_stamp() of the grammar */
+  uint64_t source_len;  /* bytes of the source the tree was parsed from */
+  uint64_t source_hash; /* flat_ast_source_hash() of that source */
+  uint64_t n_nodes;
+} FlatAstHeader;
+
+typedef struct FlatAst {
+  const TSLanguage *lang;  /* symbol and field names */
+  const FlatNode *nodes;
+  uint32_t n;
+  uint64_t source_len;
+  uint64_t source_hash;
+  FlatNode *own;           /* built on the heap: the array, reused by the next build */
+  uint32_t cap;
+  SourceMap map;           /* opened: the mapped file */
+} FlatAst;
+
+// Snapshot the subtree of root; the language is the tree's. With an arena the
+// nodes (and the work stack) are allocated from it and live as long as it
+// does, so a per-function snapshot is released with the function's CFG; a
+// is then only read. Without, they go to a heap array in a (zero-initialized
+// or previously built), released by flat_ast_free(). 0 on success, -1 if the
+// language has field ids that do not fit FlatNode.field.
+int flat_ast_build(FlatAst *a, Arena *arena, TSNode root);
+void flat_ast_free(FlatAst *a);
+
+// hash of the grammar's version, symbol and field names
+uint64_t flat_ast_stamp(const TSLanguage *lang);
+
+// XXH64 of the whole input of r, block by block (each FLAT_HASH_BLOCK bytes
+// hashed with the previous block's hash as seed). 0 on success, -1 on a read
+// error.
+#define FLAT_HASH_BLOCK (1u << 20)
+int flat_ast_source_hash(SourceReader *r, uint64_t *out);
+
+// Write a snapshot of a source of source_len bytes with the given
+// flat_ast_source_hash(). 0 on success.
+int flat_ast_write(const FlatAst *a, uint64_t source_len, uint64_t source_hash, const char *path);
+// Map a snapshot written for lang and check the header, that every subtree
+// stays inside the array and that every symbol and field id belongs to lang;
+// the nodes are used in place. 0 on success, -1 on an I/O error (errno is
+// set) or a file that is not a snapshot for lang. Checking that it belongs to
+// a given source (source_len, source_hash) is left to the caller.
+int flat_ast_open(FlatAst *a, const char *path, const TSLanguage *lang);
+
+static inline uint32_t flat_first_child(const FlatAst *a, uint32_t i) {
+  return (a->nodes[i].size > 1) ? i + 1 : FLAT_NONE;
+}
+
+// sibling after child c of parent p, or FLAT_NONE
+static inline uint32_t flat_next_sibling(const FlatAst *a, uint32_t p, uint32_t c) {
+  uint32_t next = c + a->nodes[c].size;
+  return (next < p + a->nodes[p].size) ? next : FLAT_NONE;
+}
+
+static inline uint32_t flat_child_count(const FlatAst *a, uint32_t i) {
+  uint32_t n = 0;
+  for (uint32_t c = flat_first_child(a, i); c != FLAT_NONE; c = flat_next_sibling(a, i, c)) n++;
+  return n;
+}
+
+// first child of i stored under field id, or FLAT_NONE
+static inline uint32_t flat_child_by_field_id(const FlatAst *a, uint32_t i, TSFieldId id) {
+  if (i == FLAT_NONE || id == 0) return FLAT_NONE;
+  for (uint32_t c = flat_first_child(a, i); c != FLAT_NONE; c = flat_next_sibling(a, i, c))
+    if (a->nodes[c].field == id) return c;
+  return FLAT_NONE;
+}
+
+static inline int flat_is_named(const FlatAst *a, uint32_t i) {
+  return (a->nodes[i].flags & FLAT_NAMED) != 0;
+}
+
+static inline const char *flat_type(const FlatAst *a, uint32_t i) {
+  return ts_language_symbol_name(a->lang, a->nodes[i].symbol);
+}
+
+// name of the field node i is stored under, or NULL
+static inline const char *flat_field_name(const FlatAst *a, uint32_t i) {
+  return a->nodes[i].field ? ts_language_field_name_for_id(a->lang, a->nodes[i].field) : NULL;
+}
+
+#endif
@@ -1,9 +1,9 @@
 #include "flow.h"
+#include "node_kind.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
-#include <stdarg.h>
 
 static void intlist_init(IntList *l) { l->a = NULL; l->n = 0; l->cap = 0; }
 static void intlist_push(IntList *l, int v) {
@@ -15,843 +15,634 @@ static void intlist_push(IntList *l, int v) {
 }
 static void intlist_free(IntList *l) { free(l->a); l->a = NULL; l->n = l->cap = 0; }
 
-static void textlist_init(TextList *t) { t->lines = NULL; t->n_lines = 0; t->cap_lines = 0; }
-static void textlist_add_owned(TextList *t, char *line) {
-  if (!line) return;
-  if (t->n_lines + 1 > t->cap_lines) {
-    t->cap_lines = (t->cap_lines == 0) ? 4 : t->cap_lines * 2;
-    t->lines = realloc(t->lines, sizeof(char*) * t->cap_lines);
+// IrStmtList arrays live in the arena; nothing is freed one by one
+static void stmtlist_init(IrStmtList *l) { l->a = NULL; l->n = 0; l->cap = 0; }
+static IrStmt *stmtlist_add(Arena *a, IrStmtList *l) {
+  if (l->n + 1 > l->cap) {
+    int cap = (l->cap == 0) ? 4 : l->cap * 2;
+    l->a = arena_realloc(a, l->a, sizeof(IrStmt) * l->cap, sizeof(IrStmt) * cap);
+    l->cap = cap;
   }
-  t->lines[t->n_lines++] = line;
-}
-static void textlist_add(TextList *t, const char *line) {
-  if (!line) return;
-  textlist_add_owned(t, strdup(line));
+  IrStmt *s = &l->a[l->n++];
+  memset(s, 0, sizeof(*s));
+  return s;
 }
-static void textlist_clear(TextList *t) {
-  for (int i=0;i<t->n_lines;i++) free(t->lines[i]);
-  free(t->lines);
-  t->lines = NULL; t->n_lines = t->cap_lines = 0;
+
+static const char *const role_names[CFG_ROLE_COUNT] = {
+  [CFG_ROLE_NONE] = "block",
+  [CFG_ROLE_BLOCK] = "block",
+  [CFG_ROLE_ENTRY] = "entry",
+  [CFG_ROLE_EXIT] = "exit",
+  [CFG_ROLE_IF_COND] = "if.cond",
+  [CFG_ROLE_IF_THEN] = "if.then",
+  [CFG_ROLE_IF_ELSE] = "if.else",
+  [CFG_ROLE_IF_JOIN] = "if.join",
+  [CFG_ROLE_WHILE_COND] = "while.cond",
+  [CFG_ROLE_WHILE_BODY] = "while.body",
+  [CFG_ROLE_AFTER_WHILE] = "after_while",
+};
+
+const char *cfg_role_name(CFGRole role) {
+  if ((unsigned)role >= CFG_ROLE_COUNT) return "block";
+  return role_names[role];
 }
 
-CFG *cfg_new(void) {
-  CFG *c = malloc(sizeof(CFG));
-  c->nodes = NULL; c->n_nodes = 0; c->cap_nodes = 0;
-  return c;
+const char *cfg_edge_label(CFGEdgeKind kind) {
+  if (kind == CFG_EDGE_TRUE) return "true";
+  if (kind == CFG_EDGE_FALSE) return "false";
+  return NULL;
 }
 
-void cfg_free(CFG *c) {
-  if (!c) return;
-  for (int i=0;i<c->n_nodes;i++) {
-    free(c->nodes[i].label);
-    free(c->nodes[i].role);
-    textlist_clear(&c->nodes[i].ops);
-    if (c->nodes[i].succ_labels) {
-      for (int j=0;j<c->nodes[i].succ.n;j++) free(c->nodes[i].succ_labels[j]);
-      free(c->nodes[i].succ_labels);
-    }
-    intlist_free(&c->nodes[i].succ);
+const char *cfg_edge_kind_name(CFGEdgeKind kind) {
+  switch (kind) {
+    case CFG_EDGE_TRUE: return "true";
+    case CFG_EDGE_FALSE: return "false";
+    case CFG_EDGE_BACK: return "back";
+    case CFG_EDGE_BREAK: return "break";
+    default: return "fallthrough";
   }
-  free(c->nodes);
-  free(c);
 }
 
-int cfg_add_node(CFG *c, const char *role) {
+CFG *cfg_new(Arena *arena) {
+  CFG *c = arena_alloc(arena, sizeof(CFG));
+  c->nodes = NULL; c->n_nodes = 0; c->cap_nodes = 0;
+  c->calls = NULL; c->n_calls = 0; c->cap_calls = 0;
+  c->arena = arena;
+  return c;
+}
+
+int cfg_add_node(CFG *c, CFGRole role) {
   if (c->n_nodes + 1 > c->cap_nodes) {
-    c->cap_nodes = (c->cap_nodes == 0) ? 8 : c->cap_nodes * 2;
-    c->nodes = realloc(c->nodes, sizeof(CFGNode) * c->cap_nodes);
+    int cap = (c->cap_nodes == 0) ? 8 : c->cap_nodes * 2;
+    c->nodes = arena_realloc(c->arena, c->nodes, sizeof(CFGNode) * c->cap_nodes, sizeof(CFGNode) * cap);
+    c->cap_nodes = cap;
   }
   int id = c->n_nodes++;
   c->nodes[id].id = id;
-  const char *r = role ? role : "block";
-  c->nodes[id].role = strdup(r);
-  c->nodes[id].label = strdup(r);
+  c->nodes[id].role = (role == CFG_ROLE_NONE) ? CFG_ROLE_BLOCK : role;
   intlist_init(&c->nodes[id].succ);
-  c->nodes[id].succ_labels = NULL;
-  textlist_init(&c->nodes[id].ops);
+  c->nodes[id].succ_kinds = NULL;
+  stmtlist_init(&c->nodes[id].ops);
   return id;
 }
 
-void cfg_add_edge(CFG *c, int from, int to, const char *label) {
+void cfg_add_edge(CFG *c, int from, int to, CFGEdgeKind kind) {
   if (!c) return;
   if (from < 0 || from >= c->n_nodes) return;
   if (to < 0 || to >= c->n_nodes) return;
   CFGNode *n = &c->nodes[from];
   if (n->succ.n + 1 > n->succ.cap) {
     int newcap = (n->succ.cap == 0) ? 4 : n->succ.cap * 2;
-    n->succ.a = realloc(n->succ.a, sizeof(int) * newcap);
-    n->succ_labels = realloc(n->succ_labels, sizeof(char*) * newcap);
+    n->succ.a = arena_realloc(c->arena, n->succ.a, sizeof(int) * n->succ.cap, sizeof(int) * newcap);
+    n->succ_kinds = arena_realloc(c->arena, n->succ_kinds, n->succ.cap, newcap);
     n->succ.cap = newcap;
   }
   n->succ.a[n->succ.n] = to;
-  n->succ_labels[n->succ.n] = label ? strdup(label) : NULL;
+  n->succ_kinds[n->succ.n] = (unsigned char)kind;
   n->succ.n++;
 }
 
-void cfg_node_add_line(CFG *c, int node_id, const char *line) {
+void cfg_node_add_stmt(CFG *c, int node_id, const IrStmt *s) {
   if (!c || node_id < 0 || node_id >= c->n_nodes) return;
-  textlist_add(&c->nodes[node_id].ops, line);
-}
-
-void cfg_node_add_line_owned(CFG *c, int node_id, char *line) {
-  if (!c || node_id < 0 || node_id >= c->n_nodes) { free(line); return; }
-  textlist_add_owned(&c->nodes[node_id].ops, line);
+  *stmtlist_add(c->arena, &c->nodes[node_id].ops) = *s;
 }
 
-static void dot_escape(FILE *f, const char *s) {
-  for (; *s; ++s) {
-    unsigned char ch = (unsigned char)*s;
-    if (ch == '"' || ch == '\\') fprintf(f, "\\%c", ch);
-    else if (ch == '\n') fputs("\\n", f);
-    else if (ch == '\r') fputs("\\r", f);
-    else fputc(ch, f);
+void cfg_node_add_line(CFG *c, int node_id, const char *line) {
+  if (!c || !line || node_id < 0 || node_id >= c->n_nodes) return;
+  IrStmt *s = stmtlist_add(c->arena, &c->nodes[node_id].ops);
+  s->kind = IRS_TEXT;
+  s->text = line;
+  s->text_len = (uint32_t)strlen(line);
+}
+
+FrozenCFG *cfg_freeze(CFG *c) {
+  if (!c) return NULL;
+  Arena *arena = c->arena;
+  int n = c->n_nodes;
+  int n_edges = 0, n_ops = 0;
+  for (int i=0;i<n;i++) {
+    n_edges += c->nodes[i].succ.n;
+    n_ops += c->nodes[i].ops.n;
+  }
+  FrozenCFG *f = arena_alloc(arena, sizeof(FrozenCFG));
+  f->n_nodes = n;
+  f->n_edges = n_edges;
+  f->role = arena_alloc(arena, (size_t)n + 1);
+  f->ops_start = arena_alloc(arena, sizeof(int) * (n + 1));
+  f->ops = arena_alloc(arena, sizeof(IrStmt) * (n_ops + 1));
+  f->succ_start = arena_alloc(arena, sizeof(int) * (n + 1));
+  f->succ = arena_alloc(arena, sizeof(int) * (n_edges + 1));
+  f->succ_kind = arena_alloc(arena, (size_t)n_edges + 1);
+  f->pred_start = arena_alloc(arena, sizeof(int) * (n + 1));
+  memset(f->pred_start, 0, sizeof(int) * (n + 1));
+  f->pred = arena_alloc(arena, sizeof(int) * (n_edges + 1));
+  f->pred_kind = arena_alloc(arena, (size_t)n_edges + 1);
+
+  int op = 0, e = 0;
+  for (int i=0;i<n;i++) {
+    CFGNode *node = &c->nodes[i];
+    f->role[i] = (unsigned char)node->role;
+    f->ops_start[i] = op;
+    if (node->ops.n > 0) memcpy(f->ops + op, node->ops.a, sizeof(IrStmt) * node->ops.n);
+    op += node->ops.n;
+    f->succ_start[i] = e;
+    for (int j=0;j<node->succ.n;j++) {
+      f->succ[e] = node->succ.a[j];
+      f->succ_kind[e] = node->succ_kinds[j];
+      f->pred_start[node->succ.a[j] + 1]++;
+      e++;
+    }
+  }
+  f->ops_start[n] = op;
+  f->succ_start[n] = e;
+  // in-degree counts -> offsets, then fill in source order
+  for (int i=0;i<n;i++) f->pred_start[i + 1] += f->pred_start[i];
+  int *fill = arena_alloc(arena, sizeof(int) * (n + 1));
+  memcpy(fill, f->pred_start, sizeof(int) * (n + 1));
+  for (int i=0;i<n;i++) {
+    for (int k=f->succ_start[i]; k<f->succ_start[i + 1]; k++) {
+      int slot = fill[f->succ[k]]++;
+      f->pred[slot] = i;
+      f->pred_kind[slot] = f->succ_kind[k];
+    }
   }
+  // the call list is complete once the CFG is built; share it
+  f->calls = c->calls;
+  f->n_calls = c->n_calls;
+  return f;
 }
 
-void cfg_write_dot(CFG *c, FILE *f, const char *fname) {
+void cfg_write_dot(const FrozenCFG *c, FILE *f, const char *fname) {
   fprintf(f, "digraph CFG_%s {\n", fname);
   for (int i=0;i<c->n_nodes;i++) {
-    fprintf(f, "  n%d [label=\"", c->nodes[i].id);
-    dot_escape(f, c->nodes[i].label);
-    for (int j=0;j<c->nodes[i].ops.n_lines;j++) {
+    fprintf(f, "  n%d [label=\"B%d (%s)", i, i, cfg_role_name(c->role[i]));
+    for (int j=c->ops_start[i];j<c->ops_start[i + 1];j++) {
       fputs("\\n", f);
-      dot_escape(f, c->nodes[i].ops.lines[j]);
+      ir_write_stmt(f, &c->ops[j], IR_ESC_DOT);
     }
     fputs("\"];\n", f);
   }
   for (int i=0;i<c->n_nodes;i++) {
-    for (int j=0;j<c->nodes[i].succ.n;j++) {
-      char *lab = (c->nodes[i].succ_labels) ? c->nodes[i].succ_labels[j] : NULL;
-      if (lab) fprintf(f, "  n%d -> n%d [label=\"%s\"];\n", i, c->nodes[i].succ.a[j], lab);
-      else fprintf(f, "  n%d -> n%d;\n", i, c->nodes[i].succ.a[j]);
+    for (int j=c->succ_start[i];j<c->succ_start[i + 1];j++) {
+      const char *lab = cfg_edge_label(c->succ_kind[j]);
+      if (lab) fprintf(f, "  n%d -> n%d [label=\"%s\"];\n", i, c->succ[j], lab);
+      else fprintf(f, "  n%d -> n%d;\n", i, c->succ[j]);
     }
   }
   fprintf(f, "}\n");
 }
 
-static char *dup_printf(const char *fmt, ...) {
-  va_list ap;
-  va_start(ap, fmt);
-  int len = vsnprintf(NULL, 0, fmt, ap);
-  va_end(ap);
-  if (len < 0) return NULL;
-  char *buf = malloc((size_t)len + 1);
-  if (!buf) return NULL;
-  va_start(ap, fmt);
-  vsnprintf(buf, (size_t)len + 1, fmt, ap);
-  va_end(ap);
-  return buf;
-}
-
-static char *node_text_trimmed(const char *src, TSNode node) {
-  uint32_t s = ts_node_start_byte(node);
-  uint32_t e = ts_node_end_byte(node);
-  if (e <= s) return strdup("");
-  size_t len = (size_t)(e - s);
-  while (len > 0 && isspace((unsigned char)src[s])) { s++; len--; }
-  while (len > 0 && isspace((unsigned char)src[s+len-1])) len--;
-  char *txt = malloc(len + 1);
-  memcpy(txt, src + s, len);
-  txt[len] = '\0';
-  return txt;
-}
-
-static int has_operator_char(const char *s) {
-  if (!s) return 0;
-  while (*s) {
-    if (strchr("+-*/%&|^=!<>", *s)) return 1;
-    s++;
-  }
-  return 0;
-}
-
-static char *summarize_expr(const char *txt) {
-  if (!txt || !*txt) return strdup("expr");
-  size_t len = strlen(txt);
-  if (len <= 18) return strdup(txt);
-  if (strchr(txt, '(') && len <= 28) return strdup(txt);
-  if (has_operator_char(txt)) return strdup("complex_expr");
-  return strdup("expr");
+static void trimmed_slice(const SourceText *src, const FlatNode *node, const char **out, uint32_t *out_len) {
+  uint32_t s = node->start_byte;
+  uint32_t e = node->end_byte;
+  uint32_t len = (e > s) ? e - s : 0;
+  const char *p = source_text_at(src, s);
+  while (len > 0 && isspace((unsigned char)p[0])) { p++; len--; }
+  while (len > 0 && isspace((unsigned char)p[len-1])) len--;
+  *out = p;
+  *out_len = len;
 }
 
-#define MAX_IR_DEPTH 4
 #define MAX_BLOCK_LINES 3
 
-typedef void (*VarDeclEmitter)(const char *type_txt, const char *name, void *userdata);
-
-typedef struct {
-  CFG *cfg;
-  int node_id;
-} VarDeclNodeCtx;
-
-static void for_each_var_decl_entry(const char *src, TSNode stmt, VarDeclEmitter cb, void *userdata) {
-  if (!cb) return;
-  uint32_t cc = ts_node_child_count(stmt);
-  if (cc == 0) return;
-  TSNode id_list = ts_node_child(stmt, 0);
-  TSNode type_node = {0};
-  for (uint32_t i=1;i<cc;i++) {
-    TSNode child = ts_node_child(stmt, i);
-    if (strcmp(ts_node_type(child), "typeRef") == 0) { type_node = child; break; }
-  }
-  char *type_txt = type_node.id ? node_text_trimmed(src, type_node) : strdup("auto");
+// One VarDecl operation per declared name: "a, b: int;" -> VarDecl(int) a,
+// VarDecl(int) b. Untyped declarations get type "auto".
+static void add_var_decl_stmts(Arena *a, const SourceText *src, const FlatAst *ast, uint32_t stmt, IrStmtList *out) {
+  uint32_t id_list = flat_field(ast, stmt, NF_NAMES);
+  uint32_t type_node = flat_field(ast, stmt, NF_TYPE);
+  if (id_list == FLAT_NONE) return;
+  const char *type_txt = "auto";
+  uint32_t type_len = 4;
+  if (type_node != FLAT_NONE) trimmed_slice(src, &ast->nodes[type_node], &type_txt, &type_len);
   int emitted = 0;
-  if (!ts_node_is_null(id_list)) {
-    uint32_t ic = ts_node_child_count(id_list);
-    for (uint32_t i=0;i<ic;i++) {
-      TSNode child = ts_node_child(id_list, i);
-      if (!ts_node_is_named(child)) continue;
-      if (strcmp(ts_node_type(child), "identifier") == 0) {
-        char *name = node_text_trimmed(src, child);
-        cb(type_txt, name, userdata);
-        free(name);
-        emitted = 1;
-      }
+  for (uint32_t c = flat_first_child(ast, id_list); c != FLAT_NONE; c = flat_next_sibling(ast, id_list, c)) {
+    if (!flat_is_named(ast, c)) continue;
+    if (flat_kind(ast, c) == NK_IDENTIFIER) {
+      IrStmt *s = stmtlist_add(a, out);
+      s->kind = IRS_VAR_DECL;
+      s->text = type_txt; s->text_len = type_len;
+      trimmed_slice(src, &ast->nodes[c], &s->name, &s->name_len);
+      emitted = 1;
     }
   }
   if (!emitted) {
-    char *fallback = node_text_trimmed(src, stmt);
-    cb(type_txt, fallback, userdata);
-    free(fallback);
-  }
-  free(type_txt);
-}
-
-static void emit_var_decl_to_textlist(const char *type_txt, const char *name, void *userdata) {
-  TextList *seq = userdata;
-  char *line = dup_printf("VarDecl(%s)\n  var: %s", type_txt, name);
-  textlist_add_owned(seq, line);
-}
-
-static void emit_var_decl_to_node(const char *type_txt, const char *name, void *userdata) {
-  VarDeclNodeCtx *ctx = userdata;
-  char *line = dup_printf("VarDecl(%s)\n  var: %s", type_txt, name);
-  cfg_node_add_line_owned(ctx->cfg, ctx->node_id, line);
-}
-
-static char *join_textlist(const TextList *t, const char *sep) {
-  if (!t || t->n_lines == 0) return strdup("");
-  size_t sep_len = strlen(sep);
-  size_t total = 1;
-  for (int i=0;i<t->n_lines;i++) total += strlen(t->lines[i]);
-  total += sep_len * (t->n_lines - 1);
-  char *buf = malloc(total);
-  buf[0] = '\0';
-  for (int i=0;i<t->n_lines;i++) {
-    if (i > 0) strcat(buf, sep);
-    strcat(buf, t->lines[i]);
-  }
-  return buf;
-}
-
-static int extract_identifier_name(const char *src, TSNode node, char *out, size_t out_len) {
-  if (ts_node_is_null(node) || !out || out_len == 0) return 0;
-  const char *t = ts_node_type(node);
-  if (strcmp(t, "identifier") == 0) {
-    char *txt = node_text_trimmed(src, node);
-    snprintf(out, out_len, "%s", txt);
-    free(txt);
-    return 1;
-  }
-  uint32_t cc = ts_node_child_count(node);
-  for (uint32_t i=0;i<cc;i++) {
-    if (extract_identifier_name(src, ts_node_child(node, i), out, out_len)) return 1;
-  }
-  return 0;
-}
-
-static char *format_expr_ir(const char *src, TSNode node, int depth);
-static char *format_postfix_ir(const char *src, TSNode node, int depth);
-static char *format_call_ir(const char *src, TSNode callee, TSNode args_node, int depth);
-static char *format_index_ir(const char *src, TSNode base_node, TSNode args_node, int depth);
-static char *format_unary_ir(const char *src, TSNode node, int depth);
-static char *format_binary_chain(const char *src, TSNode node, const char *kind, int depth);
-
-static char *format_binary_chain(const char *src, TSNode node, const char *kind, int depth) {
-  uint32_t cc = ts_node_child_count(node);
-  if (cc == 0) return strdup("...");
-  int operands = 0;
-  for (uint32_t i=0;i<cc;i++) if (ts_node_is_named(ts_node_child(node, i))) operands++;
-  if (operands == 0) return strdup("...");
-  if (operands == 1) {
-    for (uint32_t i=0;i<cc;i++) {
-      TSNode child = ts_node_child(node, i);
-      if (!ts_node_is_named(child)) continue;
-      return format_expr_ir(src, child, depth);
-    }
-  }
-  char *acc = NULL;
-  int seen = 0;
-  for (uint32_t i=0;i<cc;i++) {
-    TSNode child = ts_node_child(node, i);
-    if (!ts_node_is_named(child)) continue;
-    if (seen == 0) {
-      acc = format_expr_ir(src, child, depth + 1);
-      seen = 1;
-      continue;
-    }
-    char *rhs = format_expr_ir(src, child, depth + 1);
-    char *combined = dup_printf("BinaryOp(%s) { %s | %s }", kind, acc, rhs);
-    free(acc); free(rhs);
-    acc = combined;
-    seen++;
-  }
-  if (!acc) acc = strdup("...");
-  return acc;
-}
-
-static char *format_unary_ir(const char *src, TSNode node, int depth) {
-  uint32_t cc = ts_node_child_count(node);
-  if (cc == 0) return strdup("...");
-  TSNode first = ts_node_child(node, 0);
-  if (!ts_node_is_named(first)) {
-    char *op_txt = node_text_trimmed(src, first);
-    TSNode operand = (cc > 1) ? ts_node_child(node, 1) : (TSNode){0};
-    char *arg = format_expr_ir(src, operand, depth + 1);
-    char *line = dup_printf("UnaryOp(%s) { %s }", op_txt, arg);
-    free(op_txt); free(arg);
-    return line;
-  }
-  return format_expr_ir(src, first, depth);
-}
-
-static char *format_call_ir(const char *src, TSNode callee, TSNode args_node, int depth) {
-  char name_buf[64];
-  if (!extract_identifier_name(src, callee, name_buf, sizeof(name_buf))) {
-    char *raw = node_text_trimmed(src, callee);
-    char *short_txt = summarize_expr(raw);
-    snprintf(name_buf, sizeof(name_buf), "%s", short_txt);
-    free(raw); free(short_txt);
-  }
-  TextList args; textlist_init(&args);
-  if (!ts_node_is_null(args_node)) {
-    uint32_t cc = ts_node_child_count(args_node);
-    for (uint32_t i=0;i<cc;i++) {
-      TSNode child = ts_node_child(args_node, i);
-      if (!ts_node_is_named(child)) continue;
-      char *arg = format_expr_ir(src, child, depth + 1);
-      textlist_add_owned(&args, arg);
-    }
-  }
-  char *joined = NULL;
-  if (args.n_lines > 0) joined = join_textlist(&args, " | ");
-  char *line = (joined && *joined)
-                 ? dup_printf("Call(%s) { %s }", name_buf, joined)
-                 : dup_printf("Call(%s) { }", name_buf);
-  free(joined);
-  textlist_clear(&args);
-  return line;
-}
-
-static char *format_index_ir(const char *src, TSNode base_node, TSNode args_node, int depth) {
-  char *base = format_expr_ir(src, base_node, depth + 1);
-  char *index_str = NULL;
-  if (!ts_node_is_null(args_node)) {
-    TextList idx; textlist_init(&idx);
-    uint32_t cc = ts_node_child_count(args_node);
-    for (uint32_t i=0;i<cc;i++) {
-      TSNode child = ts_node_child(args_node, i);
-      if (!ts_node_is_named(child)) continue;
-      char *arg = format_expr_ir(src, child, depth + 1);
-      textlist_add_owned(&idx, arg);
-    }
-    if (idx.n_lines == 1) {
-      index_str = idx.lines[0];
-      idx.lines[0] = NULL;
-    } else if (idx.n_lines > 1) {
-      char *joined = join_textlist(&idx, " | ");
-      index_str = dup_printf("Tuple { %s }", joined);
-      free(joined);
-    }
-    textlist_clear(&idx);
-  }
-  if (!index_str) index_str = strdup("...");
-  char *line = dup_printf("BinaryOp(IndexExpr) { %s | %s }", base, index_str);
-  free(base); free(index_str);
-  return line;
-}
-
-static char *format_postfix_ir(const char *src, TSNode node, int depth) {
-  uint32_t cc = ts_node_child_count(node);
-  if (cc == 0) return strdup("...");
-  TSNode callee = ts_node_child(node, 0);
-  for (uint32_t i=1;i<cc;i++) {
-    TSNode child = ts_node_child(node, i);
-    const char *ct = ts_node_type(child);
-    if (strcmp(ct, "(") == 0) {
-      TSNode args = {0};
-      for (uint32_t j=i+1;j<cc;j++) {
-        TSNode maybe = ts_node_child(node, j);
-        if (strcmp(ts_node_type(maybe), "exprList") == 0) { args = maybe; break; }
-      }
-      return format_call_ir(src, callee, args, depth + 1);
+    IrStmt *s = stmtlist_add(a, out);
+    s->kind = IRS_VAR_DECL;
+    s->text = type_txt; s->text_len = type_len;
+    trimmed_slice(src, &ast->nodes[stmt], &s->name, &s->name_len);
+  }
+}
+
+// assignment, expr_stmt and varDecl operations
+static void build_simple_stmts(Arena *a, const SourceText *src, const FlatAst *ast, uint32_t stmt, IrStmtList *out) {
+  switch (flat_kind(ast, stmt)) {
+    case NK_ASSIGNMENT: {
+      IrStmt *s = stmtlist_add(a, out);
+      s->kind = IRS_ASSIGN;
+      s->target = ir_build_expr(a, src, ast, flat_field(ast, stmt, NF_TARGET));
+      s->expr = ir_build_expr(a, src, ast, flat_field(ast, stmt, NF_VALUE));
+      return;
     }
-    if (strcmp(ct, "[") == 0) {
-      TSNode idx = {0};
-      for (uint32_t j=i+1;j<cc;j++) {
-        TSNode maybe = ts_node_child(node, j);
-        if (strcmp(ts_node_type(maybe), "exprList") == 0) { idx = maybe; break; }
+    case NK_EXPR_STMT: {
+      IrStmt *s = stmtlist_add(a, out);
+      uint32_t first = flat_first_child(ast, stmt);
+      if (first == FLAT_NONE) {
+        s->kind = IRS_TEXT; s->text = "Expr"; s->text_len = 4;
+        return;
       }
-      return format_index_ir(src, callee, idx, depth + 1);
-    }
-  }
-  return format_expr_ir(src, callee, depth);
-}
-
-static char *format_expr_ir(const char *src, TSNode node, int depth) {
-  if (depth > MAX_IR_DEPTH || ts_node_is_null(node)) return strdup("...");
-  const char *t = ts_node_type(node);
-  if (strcmp(t, "expr") == 0 || strcmp(t, "_expr") == 0) {
-    uint32_t cc = ts_node_child_count(node);
-    for (uint32_t i=0;i<cc;i++) {
-      TSNode child = ts_node_child(node, i);
-      if (!ts_node_is_named(child)) continue;
-      return format_expr_ir(src, child, depth);
-    }
-    return strdup("...");
-  }
-  if (strcmp(t, "identifier") == 0) {
-    char *txt = node_text_trimmed(src, node);
-    char *line = dup_printf("Nop(Identifier) [var:%s]", txt);
-    free(txt);
-    return line;
-  }
-  if (strcmp(t, "literal") == 0 || strcmp(t, "bool") == 0 || strcmp(t, "str") == 0 ||
-      strcmp(t, "char") == 0 || strcmp(t, "hex") == 0 || strcmp(t, "bits") == 0 ||
-      strcmp(t, "dec") == 0) {
-    char *txt = node_text_trimmed(src, node);
-    char *line = dup_printf("Nop(Literal) [const:%s]", txt);
-    free(txt);
-    return line;
-  }
-  if (strcmp(t, "primary") == 0) {
-    uint32_t cc = ts_node_child_count(node);
-    for (uint32_t i=0;i<cc;i++) {
-      TSNode child = ts_node_child(node, i);
-      if (!ts_node_is_named(child)) continue;
-      return format_expr_ir(src, child, depth + 1);
+      s->kind = IRS_EXPR;
+      s->expr = ir_build_expr(a, src, ast, first);
+      return;
     }
-    char *txt = node_text_trimmed(src, node);
-    char *line = dup_printf("Expr(%s)", txt);
-    free(txt);
-    return line;
-  }
-  if (strcmp(t, "postfix") == 0) return format_postfix_ir(src, node, depth);
-  if (strcmp(t, "unary") == 0) return format_unary_ir(src, node, depth);
-  if (strcmp(t, "logical_or") == 0 || strcmp(t, "logical_and") == 0)
-    return format_binary_chain(src, node, "LogicExpr", depth);
-  if (strcmp(t, "bitwise_or") == 0 || strcmp(t, "bitwise_xor") == 0 ||
-      strcmp(t, "bitwise_and") == 0 || strcmp(t, "shift") == 0)
-    return format_binary_chain(src, node, "BitwiseExpr", depth);
-  if (strcmp(t, "equality") == 0 || strcmp(t, "relational") == 0)
-    return format_binary_chain(src, node, "CompareExpr", depth);
-  if (strcmp(t, "add") == 0)
-    return format_binary_chain(src, node, "AddExpr", depth);
-  if (strcmp(t, "mul") == 0)
-    return format_binary_chain(src, node, "MulExpr", depth);
-  char *txt = node_text_trimmed(src, node);
-  char *short_txt = summarize_expr(txt);
-  char *line = dup_printf("Expr(%s)", short_txt);
-  free(txt); free(short_txt);
-  return line;
-}
-
-static char *format_assignment_ir(const char *src, TSNode stmt) {
-  TSNode lhs = ts_node_child(stmt, 0);
-  TSNode rhs = ts_node_child(stmt, 2);
-  char *lhs_ir = format_expr_ir(src, lhs, 0);
-  char *rhs_ir = format_expr_ir(src, rhs, 0);
-  char *line = dup_printf("Assign(=)\n  lhs: %s\n  rhs: %s", lhs_ir, rhs_ir);
-  free(lhs_ir); free(rhs_ir);
-  return line;
-}
-
-static char *format_expr_stmt_ir(const char *src, TSNode stmt) {
-  if (ts_node_child_count(stmt) == 0) return strdup("Expr");
-  TSNode expr = ts_node_child(stmt, 0);
-  char *expr_txt = format_expr_ir(src, expr, 0);
-  char *line = dup_printf("ExprStmt\n  expr: %s", expr_txt);
-  free(expr_txt);
-  return line;
-}
-
-static char *format_return_line(const char *src, TSNode stmt) {
-  uint32_t cc = ts_node_child_count(stmt);
-  for (uint32_t i=0;i<cc;i++) {
-    TSNode child = ts_node_child(stmt, i);
-    if (!ts_node_is_named(child)) continue;
-    char *expr_ir = format_expr_ir(src, child, 0);
-    char *line = dup_printf("Return\n  value: %s", expr_ir);
-    free(expr_ir);
-    return line;
-  }
-  return strdup("Return");
-}
-
-static int is_wrapper(const char *t) {
-  return strcmp(t,"statement")==0 || strcmp(t,"statements")==0 ||
-         strcmp(t,"statement_list")==0 || strcmp(t,"statement_seq")==0;
-}
-
-static int is_simple_stmt(const char *t) {
-  return strcmp(t,"assignment")==0 || strcmp(t,"expr_stmt")==0 || strcmp(t,"varDecl")==0;
-}
+    case NK_VAR_DECL:
+      add_var_decl_stmts(a, src, ast, stmt, out);
+      return;
+    default:
+      return;
+  }
+}
+
+
+static int is_wrapper(NodeKind k) {
+  return k == NK_STATEMENT;
+}
+
+static int is_simple_stmt(NodeKind k) {
+  return k == NK_ASSIGNMENT || k == NK_EXPR_STMT || k == NK_VAR_DECL;
+}
+
+// Statements are built iteratively: every compound statement (block, wrapper,
+// if, while, repeat) gets a Frame on a growable stack instead of a C stack
+// frame, so nesting depth is limited only by memory. A frame yields when it
+// needs a nested compound statement built and is resumed with that
+// statement's entry/exit.
+typedef enum FrameKind {
+  FR_BLOCK,  /* begin ... end; simple statements are merged into basic blocks */
+  FR_SEQ,    /* statement wrapper: children chained one after another */
+  FR_IF,
+  FR_WHILE,
+  FR_DO
+} FrameKind;
+
+typedef struct Frame {
+  FrameKind kind;
+  uint32_t node;
+  CFGRole role;       /* role hint; first_role for FR_BLOCK */
+  int stage;
+  uint32_t child;     /* FR_BLOCK / FR_SEQ: next child, FLAT_NONE at the end */
+  uint32_t wrapper;   /* FR_BLOCK: statement wrapper being walked ... */
+  uint32_t wchild;    /* ... and its next child */
+  int in_wrapper;
+  IrStmtList seq;     /* FR_BLOCK: pending simple statements */
+  int first, last, block_count;
+  int cond_id, exit_id, then_entry, then_exit;
+  IrExpr *cond;       /* FR_DO: condition, built before the body */
+} Frame;
 
 typedef struct Builder {
-  const char *source;
+  const SourceText *source;
+  const FlatAst *ast;
+  Arena *arena;
   CFG *cfg;
-  int loop_exit_stack[32];
-  int loop_cond_stack[32];
-  int loop_depth;
+  IntList loop_exits;
+  Frame *frames;
+  int n_frames;
+  int cap_frames;
   int func_exit;
 } Builder;
 
-static void push_loop(Builder *b, int cond_id, int exit_id) {
-  if (b->loop_depth < 32) {
-    b->loop_cond_stack[b->loop_depth] = cond_id;
-    b->loop_exit_stack[b->loop_depth] = exit_id;
-    b->loop_depth++;
+static void push_loop(Builder *b, int exit_id) { intlist_push(&b->loop_exits, exit_id); }
+static void pop_loop(Builder *b) { if (b->loop_exits.n > 0) b->loop_exits.n--; }
+static int current_loop_exit(Builder *b) { if (b->loop_exits.n==0) return -1; return b->loop_exits.a[b->loop_exits.n-1]; }
+
+static void builder_free(Builder *b) {
+  intlist_free(&b->loop_exits);
+  free(b->frames);
+  b->frames = NULL; b->n_frames = b->cap_frames = 0;
+}
+
+static void record_call(const IrExpr *call, void *userdata) {
+  CFG *c = userdata;
+  if (c->n_calls + 1 > c->cap_calls) {
+    int cap = (c->cap_calls == 0) ? 8 : c->cap_calls * 2;
+    c->calls = arena_realloc(c->arena, c->calls, sizeof(CallSite) * c->cap_calls, sizeof(CallSite) * cap);
+    c->cap_calls = cap;
   }
+  CallSite *cs = &c->calls[c->n_calls++];
+  cs->callee = call->text;
+  cs->callee_len = call->len;
+  cs->byte = call->start_byte;
 }
-static void pop_loop(Builder *b) { if (b->loop_depth > 0) b->loop_depth--; }
-static int current_loop_exit(Builder *b) { if (b->loop_depth==0) return -1; return b->loop_exit_stack[b->loop_depth-1]; }
-static int current_loop_cond(Builder *b) { if (b->loop_depth==0) return -1; return b->loop_cond_stack[b->loop_depth-1]; }
 
-static void process_statement(Builder *b, TSNode stmt, const char *role_hint, int *out_entry, int *out_exit);
-static void append_simple_stmt_lines(Builder *b, TSNode stmt, TextList *seq);
+static void add_simple_stmts(Builder *b, uint32_t stmt, IrStmtList *out) {
+  int first = out->n;
+  build_simple_stmts(b->arena, b->source, b->ast, stmt, out);
+  for (int i=first;i<out->n;i++) ir_for_each_call(&out->a[i], record_call, b->cfg);
+}
 
-static void append_simple_stmt_lines(Builder *b, TSNode stmt, TextList *seq) {
-  const char *t = ts_node_type(stmt);
-  if (strcmp(t, "assignment") == 0) {
-    textlist_add_owned(seq, format_assignment_ir(b->source, stmt));
-    return;
-  }
-  if (strcmp(t, "expr_stmt") == 0) {
-    textlist_add_owned(seq, format_expr_stmt_ir(b->source, stmt));
-    return;
-  }
-  if (strcmp(t, "varDecl") == 0) {
-    for_each_var_decl_entry(b->source, stmt, emit_var_decl_to_textlist, seq);
-    return;
-  }
+static void add_cond_stmt(Builder *b, int node, IrStmtKind kind, IrExpr *cond, const char *text) {
+  IrStmt st;
+  memset(&st, 0, sizeof(st));
+  st.kind = kind;
+  st.expr = cond;
+  if (text) { st.text = text; st.text_len = (uint32_t)strlen(text); }
+  ir_for_each_call(&st, record_call, b->cfg);
+  cfg_node_add_stmt(b->cfg, node, &st);
 }
 
-static void flush_seq_block(Builder *b, TextList *seq, int *first, int *last_exit, const char *first_role, int *block_count) {
-  if (seq->n_lines == 0) return;
-  const char *role = (*block_count == 0 && first_role) ? first_role : "block";
+static void flush_seq_block(Builder *b, IrStmtList *seq, int *first, int *last_exit, CFGRole first_role, int *block_count) {
+  if (seq->n == 0) return;
+  CFGRole role = (*block_count == 0) ? first_role : CFG_ROLE_BLOCK;
   int node = cfg_add_node(b->cfg, role);
-  for (int i=0;i<seq->n_lines;i++) cfg_node_add_line_owned(b->cfg, node, seq->lines[i]);
-  free(seq->lines); seq->lines = NULL; seq->n_lines = seq->cap_lines = 0;
+  // the node takes over the pending operations, the next block starts a new list
+  b->cfg->nodes[node].ops = *seq;
+  stmtlist_init(seq);
   if (*first == -1) *first = node;
-  if (*last_exit >= 0) cfg_add_edge(b->cfg, *last_exit, node, NULL);
+  if (*last_exit >= 0) cfg_add_edge(b->cfg, *last_exit, node, CFG_EDGE_FALLTHROUGH);
   *last_exit = node;
   (*block_count)++;
 }
 
-static void process_block(Builder *b, TSNode block_node, const char *first_role, int *out_entry, int *out_exit) {
-  TextList seq; textlist_init(&seq);
-  int first = -1, last = -1, block_count = 0;
-  uint32_t cc = ts_node_child_count(block_node);
-  for (uint32_t i=0;i<cc;i++) {
-    TSNode child = ts_node_child(block_node, i);
-    const char *t = ts_node_type(child);
-    if (strcmp(t,"begin")==0 || strcmp(t,"end")==0 || strcmp(t,";")==0) continue;
-    if (is_wrapper(t)) {
-      uint32_t wc = ts_node_child_count(child);
-      for (uint32_t j=0;j<wc;j++) {
-        TSNode wchild = ts_node_child(child, j);
-        if (!ts_node_is_named(wchild)) continue;
-        const char *wt = ts_node_type(wchild);
-        if (is_simple_stmt(wt)) {
-          append_simple_stmt_lines(b, wchild, &seq);
-          if (seq.n_lines >= MAX_BLOCK_LINES) flush_seq_block(b, &seq, &first, &last, first_role, &block_count);
-        } else {
-          flush_seq_block(b, &seq, &first, &last, first_role, &block_count);
-          int se=-1,sx=-1;
-          process_statement(b, wchild, NULL, &se, &sx);
-          if (se >= 0) {
-            if (first == -1) first = se;
-            if (last >= 0) cfg_add_edge(b->cfg, last, se, NULL);
-          }
-          if (sx == -1) last = -2;
-          else last = sx;
-        }
-      }
-      continue;
-    }
-    if (is_simple_stmt(t)) {
-      append_simple_stmt_lines(b, child, &seq);
-      if (seq.n_lines >= MAX_BLOCK_LINES) flush_seq_block(b, &seq, &first, &last, first_role, &block_count);
-      continue;
-    }
-    flush_seq_block(b, &seq, &first, &last, first_role, &block_count);
-    int se=-1,sx=-1;
-    process_statement(b, child, NULL, &se, &sx);
-    if (se >= 0) {
-      if (first == -1) first = se;
-      if (last >= 0) cfg_add_edge(b->cfg, last, se, NULL);
-    }
-    if (sx == -1) last = -2;
-    else last = sx;
-  }
-  flush_seq_block(b, &seq, &first, &last, first_role, &block_count);
-  textlist_clear(&seq);
-  if (first == -1) {
-    first = cfg_add_node(b->cfg, first_role ? first_role : "block");
-    cfg_node_add_line(b->cfg, first, "empty");
-    last = first;
-  }
-  if (last == -2) last = -1;
-  *out_entry = first;
-  *out_exit = last;
-}
-
-static void process_statement(Builder *b, TSNode stmt, const char *role_hint, int *out_entry, int *out_exit) {
-  const char *t = ts_node_type(stmt);
-  if (strcmp(t,"block")==0) { process_block(b, stmt, role_hint, out_entry, out_exit); return; }
-  if (is_wrapper(t)) {
-    int first = -1, last = -1;
-    uint32_t cc = ts_node_child_count(stmt);
-    for (uint32_t i=0;i<cc;i++) {
-      TSNode child = ts_node_child(stmt, i);
-      if (!ts_node_is_named(child)) continue;
-      int se=-1,sx=-1;
-      process_statement(b, child, NULL, &se, &sx);
-      if (se >= 0) {
-        if (first == -1) first = se;
-        if (last >= 0) cfg_add_edge(b->cfg, last, se, NULL);
-      }
-      if (sx == -1) last = -2;
-      else last = sx;
-    }
-    if (first == -1) {
-      first = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-      cfg_node_add_line(b->cfg, first, "empty");
-      last = first;
-    }
-    if (last == -2) last = -1;
-    *out_entry = first; *out_exit = last;
-    return;
+// Chain a finished child statement after the ones before it. An exit of -1
+// (break) leaves nothing to fall through from; -2 marks that in `last`.
+static void link_child(Builder *b, Frame *f, int se, int sx) {
+  if (se >= 0) {
+    if (f->first == -1) f->first = se;
+    if (f->last >= 0) cfg_add_edge(b->cfg, f->last, se, CFG_EDGE_FALLTHROUGH);
   }
-  if (strcmp(t,"assignment")==0) {
-    char *line = format_assignment_ir(b->source, stmt);
-    int node = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-    cfg_node_add_line_owned(b->cfg, node, line);
+  if (sx == -1) f->last = -2;
+  else f->last = sx;
+}
+
+static int empty_node(Builder *b, CFGRole role) {
+  int node = cfg_add_node(b->cfg, role);
+  cfg_node_add_line(b->cfg, node, "empty");
+  return node;
+}
+
+// Start building stmt. Statements without nested statements are built right
+// away and 0 is returned with their entry/exit; compound ones push a frame
+// and return 1.
+static int begin_statement(Builder *b, uint32_t stmt, CFGRole role_hint, int *out_entry, int *out_exit) {
+  FrameKind kind;
+  // a field left empty by error recovery: no nodes, the caller fills in
+  if (stmt == FLAT_NONE) { *out_entry = *out_exit = -1; return 0; }
+  switch (flat_kind(b->ast, stmt)) {
+  case NK_BLOCK: kind = FR_BLOCK; break;
+  case NK_STATEMENT: kind = FR_SEQ; break;
+  case NK_IF_STATEMENT: kind = FR_IF; break;
+  case NK_WHILE_STATEMENT: kind = FR_WHILE; break;
+  case NK_DO_STATEMENT: kind = FR_DO; break;
+  case NK_ASSIGNMENT:
+  case NK_EXPR_STMT:
+  case NK_VAR_DECL: {
+    int node = cfg_add_node(b->cfg, role_hint);
+    add_simple_stmts(b, stmt, &b->cfg->nodes[node].ops);
     *out_entry = *out_exit = node;
-    return;
+    return 0;
   }
-  if (strcmp(t,"expr_stmt")==0) {
-    char *line = format_expr_stmt_ir(b->source, stmt);
-    int node = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-    cfg_node_add_line_owned(b->cfg, node, line);
-    *out_entry = *out_exit = node;
-    return;
+  case NK_BREAK_STATEMENT: {
+    int node = cfg_add_node(b->cfg, role_hint);
+    cfg_node_add_line(b->cfg, node, "Nop(break)");
+    int exit = current_loop_exit(b);
+    if (exit != -1) cfg_add_edge(b->cfg, node, exit, CFG_EDGE_BREAK);
+    *out_entry = node; *out_exit = -1;
+    return 0;
   }
-  if (strcmp(t,"varDecl")==0) {
-    int node = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-    VarDeclNodeCtx ctx = { b->cfg, node };
-    for_each_var_decl_entry(b->source, stmt, emit_var_decl_to_node, &ctx);
+  default: {
+    int node = cfg_add_node(b->cfg, role_hint);
+    cfg_node_add_line(b->cfg, node, flat_type(b->ast, stmt));
     *out_entry = *out_exit = node;
-    return;
+    return 0;
   }
-  if (strcmp(t,"if_statement")==0) {
-    TSNode cond = ts_node_child(stmt, 1);
-    TSNode then_stmt = ts_node_child(stmt, 3);
-    TSNode else_stmt = (ts_node_child_count(stmt) > 4) ? ts_node_child(stmt, 5) : (TSNode){0};
-    char *cond_ir = format_expr_ir(b->source, cond, 0);
-    int cond_id = cfg_add_node(b->cfg, "if.cond");
-    cfg_node_add_line_owned(b->cfg, cond_id, dup_printf("IfCond\n  expr: %s", cond_ir));
-    free(cond_ir);
-
-    int then_entry=-1, then_exit=-1;
-    process_statement(b, then_stmt, "if.then", &then_entry, &then_exit);
-    if (then_entry < 0) {
-      then_entry = cfg_add_node(b->cfg, "if.then");
-      cfg_node_add_line(b->cfg, then_entry, "empty");
-      then_exit = then_entry;
-    }
-    int else_entry=-1, else_exit=-1;
-    if (ts_node_is_null(else_stmt)) {
-      else_entry = cfg_add_node(b->cfg, "if.else");
-      cfg_node_add_line(b->cfg, else_entry, "empty");
-      else_exit = else_entry;
+  }
+  if (b->n_frames + 1 > b->cap_frames) {
+    b->cap_frames = (b->cap_frames == 0) ? 16 : b->cap_frames * 2;
+    b->frames = realloc(b->frames, sizeof(Frame) * b->cap_frames);
+  }
+  Frame *f = &b->frames[b->n_frames++];
+  memset(f, 0, sizeof(*f));
+  f->kind = kind;
+  f->node = stmt;
+  f->role = role_hint;
+  f->first = f->last = -1;
+  f->cond_id = f->exit_id = f->then_entry = f->then_exit = -1;
+  stmtlist_init(&f->seq);
+  if (kind == FR_BLOCK || kind == FR_SEQ) f->child = flat_first_child(b->ast, stmt);
+  return 1;
+}
+
+#define STEP_PUSHED 0
+#define STEP_DONE 1
+
+// Advance the top frame. `have` says whether (se, sx) holds the result of the
+// child statement it yielded on. Returns STEP_PUSHED after pushing a child
+// frame, or STEP_DONE with the frame's own entry/exit in (*se, *sx).
+static int step_block(Builder *b, int have, int *se, int *sx) {
+  Frame *f = &b->frames[b->n_frames-1];
+  if (have) link_child(b, f, *se, *sx);
+  const FlatAst *ast = b->ast;
+  for (;;) {
+    uint32_t child;
+    if (f->in_wrapper) {
+      if (f->wchild == FLAT_NONE) { f->in_wrapper = 0; continue; }
+      child = f->wchild;
+      f->wchild = flat_next_sibling(ast, f->wrapper, child);
+      if (!flat_is_named(ast, child)) continue;
     } else {
-      process_statement(b, else_stmt, "if.else", &else_entry, &else_exit);
-      if (else_entry < 0) {
-        else_entry = cfg_add_node(b->cfg, "if.else");
-        cfg_node_add_line(b->cfg, else_entry, "empty");
-        else_exit = else_entry;
-      }
+      if (f->child == FLAT_NONE) break;
+      child = f->child;
+      f->child = flat_next_sibling(ast, f->node, child);
+      NodeKind k = flat_kind(ast, child);
+      if (k == NK_KW_BEGIN || k == NK_KW_END || k == NK_SEMI) continue;
+      if (is_wrapper(k)) { f->wrapper = child; f->wchild = flat_first_child(ast, child); f->in_wrapper = 1; continue; }
     }
-    int join = cfg_add_node(b->cfg, "if.join");
-    cfg_node_add_line(b->cfg, join, "join");
-
-    cfg_add_edge(b->cfg, cond_id, then_entry, "true");
-    cfg_add_edge(b->cfg, cond_id, else_entry, "false");
-    if (then_exit >= 0) cfg_add_edge(b->cfg, then_exit, join, NULL);
-    if (else_exit >= 0) cfg_add_edge(b->cfg, else_exit, join, NULL);
-    *out_entry = cond_id; *out_exit = join;
-    return;
-  }
-  if (strcmp(t,"while_statement")==0) {
-    TSNode cond = ts_node_child(stmt, 1);
-    TSNode body = ts_node_child(stmt, 3);
-    char *cond_ir = format_expr_ir(b->source, cond, 0);
-    int cond_id = cfg_add_node(b->cfg, "while.cond");
-    cfg_node_add_line_owned(b->cfg, cond_id, dup_printf("WhileCond\n  expr: %s", cond_ir));
-    free(cond_ir);
-    int exit_id = cfg_add_node(b->cfg, "after_while");
-    cfg_node_add_line(b->cfg, exit_id, "Nop(exit)");
-    push_loop(b, cond_id, exit_id);
-
-    int body_entry=-1, body_exit=-1;
-    process_statement(b, body, "while.body", &body_entry, &body_exit);
-    if (body_entry < 0) {
-      body_entry = cfg_add_node(b->cfg, "while.body");
-      cfg_node_add_line(b->cfg, body_entry, "empty");
-      body_exit = body_entry;
+    if (is_simple_stmt(flat_kind(ast, child))) {
+      add_simple_stmts(b, child, &f->seq);
+      if (f->seq.n >= MAX_BLOCK_LINES) flush_seq_block(b, &f->seq, &f->first, &f->last, f->role, &f->block_count);
+      continue;
     }
-
-    cfg_add_edge(b->cfg, cond_id, body_entry, "true");
-    if (body_exit >= 0) cfg_add_edge(b->cfg, body_exit, cond_id, NULL);
-    cfg_add_edge(b->cfg, cond_id, exit_id, "false");
-    pop_loop(b);
-    *out_entry = cond_id; *out_exit = exit_id;
-    return;
-  }
-  if (strcmp(t,"do_statement")==0) {
-    TSNode body = ts_node_child(stmt, 1);
-    TSNode kind = ts_node_child(stmt, 2);
-    TSNode cond = ts_node_child(stmt, 3);
-    char *cond_ir = format_expr_ir(b->source, cond, 0);
-
-    int body_entry=-1, body_exit=-1;
-    process_statement(b, body, "while.body", &body_entry, &body_exit);
-    if (body_entry < 0) {
-      body_entry = cfg_add_node(b->cfg, "while.body");
-      cfg_node_add_line(b->cfg, body_entry, "empty");
-      body_exit = body_entry;
+    flush_seq_block(b, &f->seq, &f->first, &f->last, f->role, &f->block_count);
+    if (begin_statement(b, child, CFG_ROLE_NONE, se, sx)) return STEP_PUSHED;
+    link_child(b, f, *se, *sx);
+  }
+  flush_seq_block(b, &f->seq, &f->first, &f->last, f->role, &f->block_count);
+  if (f->first == -1) f->first = f->last = empty_node(b, f->role);
+  if (f->last == -2) f->last = -1;
+  *se = f->first; *sx = f->last;
+  return STEP_DONE;
+}
+
+static int step_seq(Builder *b, int have, int *se, int *sx) {
+  Frame *f = &b->frames[b->n_frames-1];
+  if (have) link_child(b, f, *se, *sx);
+  while (f->child != FLAT_NONE) {
+    uint32_t child = f->child;
+    f->child = flat_next_sibling(b->ast, f->node, child);
+    if (!flat_is_named(b->ast, child)) continue;
+    if (begin_statement(b, child, CFG_ROLE_NONE, se, sx)) return STEP_PUSHED;
+    link_child(b, f, *se, *sx);
+  }
+  if (f->first == -1) f->first = f->last = empty_node(b, f->role);
+  if (f->last == -2) f->last = -1;
+  *se = f->first; *sx = f->last;
+  return STEP_DONE;
+}
+
+static int step_if(Builder *b, int have, int *se, int *sx) {
+  Frame *f = &b->frames[b->n_frames-1];
+  uint32_t stmt = f->node;
+  (void)have;
+  switch (f->stage) {
+  case 0: {
+    IrExpr *cond = ir_build_expr(b->arena, b->source, b->ast, flat_field(b->ast, stmt, NF_CONDITION));
+    f->cond_id = cfg_add_node(b->cfg, CFG_ROLE_IF_COND);
+    add_cond_stmt(b, f->cond_id, IRS_IF_COND, cond, NULL);
+    f->stage = 1;
+    if (begin_statement(b, flat_field(b->ast, stmt, NF_CONSEQUENCE), CFG_ROLE_IF_THEN, se, sx)) return STEP_PUSHED;
+  }
+  /* fall through */
+  case 1:
+    if (*se < 0) *se = *sx = empty_node(b, CFG_ROLE_IF_THEN);
+    f->then_entry = *se; f->then_exit = *sx;
+    f->stage = 2;
+    // no else: begin_statement() leaves *se < 0 and an empty node follows
+    if (begin_statement(b, flat_field(b->ast, stmt, NF_ALTERNATIVE), CFG_ROLE_IF_ELSE, se, sx)) return STEP_PUSHED;
+  /* fall through */
+  default: {
+    if (*se < 0) *se = *sx = empty_node(b, CFG_ROLE_IF_ELSE);
+    int join = cfg_add_node(b->cfg, CFG_ROLE_IF_JOIN);
+    cfg_node_add_line(b->cfg, join, "join");
+    cfg_add_edge(b->cfg, f->cond_id, f->then_entry, CFG_EDGE_TRUE);
+    cfg_add_edge(b->cfg, f->cond_id, *se, CFG_EDGE_FALSE);
+    if (f->then_exit >= 0) cfg_add_edge(b->cfg, f->then_exit, join, CFG_EDGE_FALLTHROUGH);
+    if (*sx >= 0) cfg_add_edge(b->cfg, *sx, join, CFG_EDGE_FALLTHROUGH);
+    *se = f->cond_id; *sx = join;
+    return STEP_DONE;
+  }
+  }
+}
+
+static int step_while(Builder *b, int have, int *se, int *sx) {
+  Frame *f = &b->frames[b->n_frames-1];
+  (void)have;
+  if (f->stage == 0) {
+    IrExpr *cond = ir_build_expr(b->arena, b->source, b->ast, flat_field(b->ast, f->node, NF_CONDITION));
+    f->cond_id = cfg_add_node(b->cfg, CFG_ROLE_WHILE_COND);
+    add_cond_stmt(b, f->cond_id, IRS_WHILE_COND, cond, NULL);
+    f->exit_id = cfg_add_node(b->cfg, CFG_ROLE_AFTER_WHILE);
+    cfg_node_add_line(b->cfg, f->exit_id, "Nop(exit)");
+    push_loop(b, f->exit_id);
+    f->stage = 1;
+    if (begin_statement(b, flat_field(b->ast, f->node, NF_BODY), CFG_ROLE_WHILE_BODY, se, sx)) return STEP_PUSHED;
+  }
+  if (*se < 0) *se = *sx = empty_node(b, CFG_ROLE_WHILE_BODY);
+  cfg_add_edge(b->cfg, f->cond_id, *se, CFG_EDGE_TRUE);
+  if (*sx >= 0) cfg_add_edge(b->cfg, *sx, f->cond_id, CFG_EDGE_BACK);
+  cfg_add_edge(b->cfg, f->cond_id, f->exit_id, CFG_EDGE_FALSE);
+  pop_loop(b);
+  *se = f->cond_id; *sx = f->exit_id;
+  return STEP_DONE;
+}
+
+static int step_do(Builder *b, int have, int *se, int *sx) {
+  Frame *f = &b->frames[b->n_frames-1];
+  (void)have;
+  uint32_t kind = flat_field(b->ast, f->node, NF_KIND);
+  if (f->stage == 0) {
+    f->cond = ir_build_expr(b->arena, b->source, b->ast, flat_field(b->ast, f->node, NF_CONDITION));
+    f->stage = 1;
+    if (begin_statement(b, flat_field(b->ast, f->node, NF_BODY), CFG_ROLE_WHILE_BODY, se, sx)) return STEP_PUSHED;
+  }
+  if (*se < 0) *se = *sx = empty_node(b, CFG_ROLE_WHILE_BODY);
+  int cond_id = cfg_add_node(b->cfg, CFG_ROLE_WHILE_COND);
+  add_cond_stmt(b, cond_id, IRS_REPEAT_COND, f->cond, (kind == FLAT_NONE) ? NULL : flat_type(b->ast, kind));
+  int exit_id = cfg_add_node(b->cfg, CFG_ROLE_AFTER_WHILE);
+  cfg_node_add_line(b->cfg, exit_id, "Nop(exit)");
+  push_loop(b, exit_id);
+
+  if (*sx >= 0) cfg_add_edge(b->cfg, *sx, cond_id, CFG_EDGE_FALLTHROUGH);
+  int true_is_loop = kind != FLAT_NONE && flat_kind(b->ast, kind) == NK_KW_WHILE;
+  cfg_add_edge(b->cfg, cond_id, *se, true_is_loop ? CFG_EDGE_TRUE : CFG_EDGE_FALSE);
+  cfg_add_edge(b->cfg, cond_id, exit_id, true_is_loop ? CFG_EDGE_FALSE : CFG_EDGE_TRUE);
+  pop_loop(b);
+  *sx = exit_id;
+  return STEP_DONE;
+}
+
+static void process_statement(Builder *b, uint32_t stmt, CFGRole role_hint, int *out_entry, int *out_exit) {
+  int base = b->n_frames;
+  int se = -1, sx = -1, have = 0;
+  if (!begin_statement(b, stmt, role_hint, &se, &sx)) { *out_entry = se; *out_exit = sx; return; }
+  while (b->n_frames > base) {
+    int r;
+    switch (b->frames[b->n_frames-1].kind) {
+    case FR_BLOCK: r = step_block(b, have, &se, &sx); break;
+    case FR_SEQ: r = step_seq(b, have, &se, &sx); break;
+    case FR_IF: r = step_if(b, have, &se, &sx); break;
+    case FR_WHILE: r = step_while(b, have, &se, &sx); break;
+    default: r = step_do(b, have, &se, &sx); break;
     }
-
-    int cond_id = cfg_add_node(b->cfg, "while.cond");
-    cfg_node_add_line_owned(b->cfg, cond_id, dup_printf("RepeatCond(%s)\n  expr: %s", ts_node_type(kind), cond_ir));
-    int exit_id = cfg_add_node(b->cfg, "after_while");
-    cfg_node_add_line(b->cfg, exit_id, "Nop(exit)");
-    push_loop(b, cond_id, exit_id);
-
-    if (body_exit >= 0) cfg_add_edge(b->cfg, body_exit, cond_id, NULL);
-    int true_is_loop = strcmp(ts_node_type(kind), "while") == 0;
-    cfg_add_edge(b->cfg, cond_id, body_entry, true_is_loop ? "true" : "false");
-    cfg_add_edge(b->cfg, cond_id, exit_id, true_is_loop ? "false" : "true");
-    pop_loop(b);
-    free(cond_ir);
-    *out_entry = body_entry; *out_exit = exit_id;
-    return;
-  }
-  if (strcmp(t,"continue_statement")==0 || strcmp(t,"continue")==0) {
-    int node = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-    cfg_node_add_line(b->cfg, node, "Nop(continue)");
-    int cond = current_loop_cond(b);
-    if (cond != -1) cfg_add_edge(b->cfg, node, cond, NULL);
-    *out_entry = node; *out_exit = -1; return;
-  }
-  if (strcmp(t,"break_statement")==0) {
-    int node = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-    cfg_node_add_line(b->cfg, node, "Nop(break)");
-    int exit = current_loop_exit(b);
-    if (exit != -1) cfg_add_edge(b->cfg, node, exit, NULL);
-    *out_entry = node; *out_exit = -1; return;
-  }
-  if (strcmp(t,"return_statement")==0 || strcmp(t,"return")==0) {
-    int node = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-    cfg_node_add_line_owned(b->cfg, node, format_return_line(b->source, stmt));
-    if (b->func_exit != -1) cfg_add_edge(b->cfg, node, b->func_exit, NULL);
-    *out_entry = node; *out_exit = -1; return;
-  }
-  int node = cfg_add_node(b->cfg, role_hint ? role_hint : "block");
-  cfg_node_add_line_owned(b->cfg, node, dup_printf("%s", t));
-  *out_entry = *out_exit = node;
-}
-
-static void finalize_cfg_labels(CFG *cfg) {
-  if (!cfg) return;
-  for (int i=0;i<cfg->n_nodes;i++) {
-    CFGNode *n = &cfg->nodes[i];
-    free(n->label);
-    const char *role = n->role ? n->role : "block";
-    n->label = dup_printf("B%d (%s)", n->id, role);
+    if (r == STEP_PUSHED) { have = 0; continue; }
+    b->n_frames--;
+    have = 1;
   }
+  *out_entry = se; *out_exit = sx;
 }
 
-int build_cfg_for_function(const char *source, TSNode func_node, CFG **out_cfg, char *out_fname, size_t fname_len, const char *file_prefix) {
-  (void)file_prefix;
-  uint32_t cc = ts_node_child_count(func_node);
+int build_cfg_flat(Arena *arena, const SourceText *source, const FlatAst *ast, uint32_t func, CFG **out_cfg, char *out_fname, size_t fname_len) {
   char fname[256]; fname[0] = '\0';
-  for (uint32_t i=0;i<cc;i++) {
-    TSNode c = ts_node_child(func_node, i);
-    if (strcmp(ts_node_type(c),"funcSignature") == 0) {
-      uint32_t gc = ts_node_child_count(c);
-      for (uint32_t j=0;j<gc;j++) {
-        TSNode g = ts_node_child(c, j);
-        if (strcmp(ts_node_type(g),"identifier")==0) {
-          uint32_t s = ts_node_start_byte(g);
-          uint32_t e = ts_node_end_byte(g);
-          size_t len = (e>s)?(size_t)(e-s):0;
-          if (len >= sizeof(fname)) len = sizeof(fname)-1;
-          memcpy(fname, source + s, len);
-          fname[len] = '\0';
-          break;
-        }
-      }
-    }
+  uint32_t body = flat_field(ast, func, NF_BODY);
+  uint32_t sig = flat_field(ast, func, NF_SIGNATURE);
+  uint32_t name = flat_field(ast, sig, NF_NAME);
+  if (name != FLAT_NONE) {
+    uint32_t s = ast->nodes[name].start_byte;
+    uint32_t e = ast->nodes[name].end_byte;
+    size_t len = (e>s)?(size_t)(e-s):0;
+    if (len >= sizeof(fname)) len = sizeof(fname)-1;
+    memcpy(fname, source_text_at(source, s), len);
+    fname[len] = '\0';
   }
   if (fname[0] == '\0') strcpy(fname, "<anon>");
   if (out_fname && fname_len>0) snprintf(out_fname, fname_len, "%s", fname);
 
   Builder b = {0};
   b.source = source;
-  b.cfg = cfg_new();
-  b.loop_depth = 0;
-  b.func_exit = cfg_add_node(b.cfg, "exit");
+  b.ast = ast;
+  b.arena = arena;
+  b.cfg = cfg_new(arena);
+  intlist_init(&b.loop_exits);
+  b.func_exit = cfg_add_node(b.cfg, CFG_ROLE_EXIT);
   cfg_node_add_line(b.cfg, b.func_exit, "Nop(exit)");
 
-  TSNode body = {0};
-  for (uint32_t i=0;i<cc;i++) {
-    TSNode c = ts_node_child(func_node, i);
-    if (strcmp(ts_node_type(c),"body")==0) { body = c; break; }
-  }
-  if (ts_node_is_null(body)) {
-    int entry = cfg_add_node(b.cfg, "entry");
+  // var sections come first, then the block
+  uint32_t block = flat_field(ast, body, NF_BLOCK);
+  if (block == FLAT_NONE) {
+    int entry = cfg_add_node(b.cfg, CFG_ROLE_ENTRY);
     cfg_node_add_line(b.cfg, entry, "empty");
-    cfg_add_edge(b.cfg, entry, b.func_exit, NULL);
-    finalize_cfg_labels(b.cfg);
-    *out_cfg = b.cfg;
-    return 0;
-  }
-  TSNode block = {0};
-  uint32_t bc = ts_node_child_count(body);
-  for (uint32_t i=0;i<bc;i++) {
-    TSNode c = ts_node_child(body, i);
-    if (strcmp(ts_node_type(c),"block")==0) { block = c; break; }
-  }
-  if (ts_node_is_null(block)) {
-    int entry = cfg_add_node(b.cfg, "entry");
-    cfg_node_add_line(b.cfg, entry, "empty");
-    cfg_add_edge(b.cfg, entry, b.func_exit, NULL);
-    finalize_cfg_labels(b.cfg);
+    cfg_add_edge(b.cfg, entry, b.func_exit, CFG_EDGE_FALLTHROUGH);
     *out_cfg = b.cfg;
     return 0;
   }
   int entry=-1, exit=-1;
-  process_block(&b, block, "entry", &entry, &exit);
+  process_statement(&b, block, CFG_ROLE_ENTRY, &entry, &exit);
   if (entry < 0) {
-    entry = cfg_add_node(b.cfg, "entry");
+    entry = cfg_add_node(b.cfg, CFG_ROLE_ENTRY);
     cfg_node_add_line(b.cfg, entry, "empty");
     exit = entry;
   }
-  if (exit >= 0) cfg_add_edge(b.cfg, exit, b.func_exit, NULL);
-  else cfg_add_edge(b.cfg, entry, b.func_exit, NULL);
-  finalize_cfg_labels(b.cfg);
+  if (exit >= 0) cfg_add_edge(b.cfg, exit, b.func_exit, CFG_EDGE_FALLTHROUGH);
+  else cfg_add_edge(b.cfg, entry, b.func_exit, CFG_EDGE_FALLTHROUGH);
+  builder_free(&b);
   *out_cfg = b.cfg;
   return 0;
 }
+
+int build_cfg_for_function(Arena *arena, const SourceText *source, TSNode func_node, CFG **out_cfg, char *out_fname, size_t fname_len, const char *file_prefix) {
+  (void)file_prefix;
+  // one cursor pass over the funcDef; the builder then reads the array,
+  // which goes to the caller's arena along with the CFG
+  FlatAst ast = {0};
+  if (flat_ast_build(&ast, arena, func_node) != 0) { *out_cfg = NULL; return -1; }
+  return build_cfg_flat(arena, source, &ast, 0, out_cfg, out_fname, fname_len);
+}
@@ -3,6 +3,8 @@
 
 #include <stdio.h>
 #include <tree_sitter/api.h>
+#include "arena.h"
+#include "ir.h"
 
 typedef struct IntList {
   int *a;
@@ -10,48 +12,113 @@ typedef struct IntList {
   int cap;
 } IntList;
 
-typedef struct TextList {
-  char **lines;
-  int n_lines;
-  int cap_lines;
-} TextList;
+typedef struct IrStmtList {
+  IrStmt *a;
+  int n;
+  int cap;
+} IrStmtList;
+
+// A call expression in a function body, recorded while its CFG is built. The
+// caller is the function owning the CFG; callee points into the source (or is
+// a placeholder such as "expr" for computed callees) and is not NUL-terminated.
+typedef struct CallSite {
+  const char *callee;
+  uint32_t callee_len;
+  uint32_t byte;  /* start of the call expression in the source */
+} CallSite;
+
+// logical role of a block; printed as "B<id> (<role>)"
+typedef enum CFGRole {
+  CFG_ROLE_NONE, /* no role hint: becomes CFG_ROLE_BLOCK when a node is added */
+  CFG_ROLE_BLOCK,
+  CFG_ROLE_ENTRY,
+  CFG_ROLE_EXIT,
+  CFG_ROLE_IF_COND,
+  CFG_ROLE_IF_THEN,
+  CFG_ROLE_IF_ELSE,
+  CFG_ROLE_IF_JOIN,
+  CFG_ROLE_WHILE_COND,
+  CFG_ROLE_WHILE_BODY,
+  CFG_ROLE_AFTER_WHILE,
+  CFG_ROLE_COUNT
+} CFGRole;
+
+typedef enum CFGEdgeKind {
+  CFG_EDGE_FALLTHROUGH,
+  CFG_EDGE_TRUE,
+  CFG_EDGE_FALSE,
+  CFG_EDGE_BACK,  /* loop body back to its condition */
+  CFG_EDGE_BREAK
+} CFGEdgeKind;
 
 typedef struct CFGNode {
   int id;
-  char *label; /* printable label */
-  char *role;  /* logical role: entry, if.then, ... */
+  CFGRole role;
   IntList succ;
-  char **succ_labels;
-  TextList ops; /* textual statements */
+  unsigned char *succ_kinds; /* CFGEdgeKind per successor */
+  IrStmtList ops; /* operations, in execution order */
 } CFGNode;
 
+// A CFG and everything hanging off it (node and edge arrays, IR trees) is
+// allocated from `arena`; it goes away with arena_reset()/arena_free().
 typedef struct CFG {
   CFGNode *nodes;
   int n_nodes;
   int cap_nodes;
+  CallSite *calls; /* in the order the operations were built */
+  int n_calls;
+  int cap_calls;
+  Arena *arena;
 } CFG;
 
-typedef struct ProgramFunction {
-  char *name;
-  char *signature;
-  char *source_file;
-  CFG *cfg;
-} ProgramFunction;
+// Read-only CFG produced by cfg_freeze(): nodes as parallel arrays, successor
+// and predecessor lists in CSR form (edges of node n are
+// [succ_start[n], succ_start[n+1])), the operations of all nodes in one array.
+typedef struct FrozenCFG {
+  int n_nodes;
+  int n_edges;
+  unsigned char *role;      /* CFGRole per node */
+  int *ops_start;           /* n_nodes+1 offsets into ops */
+  IrStmt *ops;
+  int *succ_start;          /* n_nodes+1 */
+  int *succ;                /* n_edges target nodes */
+  unsigned char *succ_kind; /* CFGEdgeKind per successor edge */
+  int *pred_start;          /* n_nodes+1 */
+  int *pred;                /* n_edges source nodes */
+  unsigned char *pred_kind; /* CFGEdgeKind per predecessor edge */
+  CallSite *calls;
+  int n_calls;
+} FrozenCFG;
+
+// create; there is no cfg_free, reset the arena instead
+CFG *cfg_new(Arena *arena);
 
-// create/free
-CFG *cfg_new(void);
-void cfg_free(CFG *c);
+const char *cfg_role_name(CFGRole role);
+// DOT edge label: "true"/"false" for branch edges, NULL otherwise
+const char *cfg_edge_label(CFGEdgeKind kind);
+// "fallthrough", "true", "false", "back", "break"
+const char *cfg_edge_kind_name(CFGEdgeKind kind);
 
 // add node/edge
-int cfg_add_node(CFG *c, const char *role);
-void cfg_add_edge(CFG *c, int from, int to, const char *label);
+int cfg_add_node(CFG *c, CFGRole role);
+void cfg_add_edge(CFG *c, int from, int to, CFGEdgeKind kind);
+void cfg_node_add_stmt(CFG *c, int node_id, const IrStmt *s);
+// fixed-text operation ("empty", "join", ...); line must outlive the CFG
 void cfg_node_add_line(CFG *c, int node_id, const char *line);
-void cfg_node_add_line_owned(CFG *c, int node_id, char *line);
+
+// compact a built CFG into c->arena; c is not used afterwards
+FrozenCFG *cfg_freeze(CFG *c);
 
 // write dot
-void cfg_write_dot(CFG *c, FILE *f, const char *fname);
+void cfg_write_dot(const FrozenCFG *c, FILE *f, const char *fname);
+
+// build CFG for funcDef node `func` of ast; source must cover the node.
+// Returns 0 on success
+int build_cfg_flat(Arena *arena, const SourceText *source, const FlatAst *ast, uint32_t func, CFG **out_cfg, char *out_fname, size_t fname_len);
 
-// build CFG for function node; returns 0 on success
-int build_cfg_for_function(const char *source, TSNode func_node, CFG **out_cfg, char *out_fname, size_t fname_len, const char *file_prefix);
+// build CFG for function node; source must cover the node. Snapshots the
+// funcDef into arena with flat_ast_build() and runs build_cfg_flat() on it.
+// Returns 0 on success
+int build_cfg_for_function(Arena *arena, const SourceText *source, TSNode func_node, CFG **out_cfg, char *out_fname, size_t fname_len, const char *file_prefix);
 
 #endif
@@ -0,0 +1,121 @@
+#!/usr/bin/env node
+// gen_node_kinds.js — генерирует Lab2/node_kinds.h из Lab1/src/node-types.json.
+//
+// Every node type of the grammar becomes a NodeKind enumerator and every field
+// name a NodeField enumerator; node_kind.c maps the runtime TSSymbol and
+// TSFieldId values onto them once at startup, so the CFG builder can switch
+// over integers and look children up by field id instead of comparing
+// ts_node_type() strings or scanning siblings.
+//
+// The names are looked up in Lab1/src/parser.c first: tree-sitter generate
+// writes node-types.json and parser.c together, and a parser.c left over from
+// an older grammar.js would leave kinds and fields unresolved at runtime.
+//
+// usage: node Lab2/gen_node_kinds.js [node-types.json] [out.h] [parser.c]
+const fs = require('fs');
+const path = require('path');
+
+const root = path.resolve(__dirname, '..');
+const input = process.argv[2] || path.join(root, 'Lab1/src/node-types.json');
+const output = process.argv[3] || path.join(__dirname, 'node_kinds.h');
+const parserPath = process.argv[4] || path.join(path.dirname(input), 'parser.c');
+
+const PUNCT = {
+  '!': 'BANG', '%': 'PERCENT', '&': 'AMP', '(': 'LPAREN', ')': 'RPAREN',
+  '*': 'STAR', '+': 'PLUS', ',': 'COMMA', '-': 'MINUS', '/': 'SLASH',
+  ':': 'COLON', ';': 'SEMI', '<': 'LT', '=': 'EQ', '>': 'GT', '[': 'LBRACK',
+  ']': 'RBRACK', '^': 'CARET', '|': 'PIPE', '~': 'TILDE', '.': 'DOT',
+  '{': 'LBRACE', '}': 'RBRACE', '"': 'DQUOTE', "'": 'SQUOTE', '?': 'QUESTION',
+  '@': 'AT', '#': 'HASH', '$': 'DOLLAR', '\\': 'BACKSLASH',
+};
+
+function upperSnake(name) {
+  return name
+    .replace(/([a-z0-9])([A-Z])/g, '$1_$2')
+    .replace(/[^A-Za-z0-9]+/g, '_')
+    .replace(/^_+|_+$/g, '')
+    .toUpperCase();
+}
+
+function enumName(type, named) {
+  if (named) return 'NK_' + upperSnake(type);
+  if (/^[A-Za-z_][A-Za-z0-9_]*$/.test(type)) return 'NK_KW_' + upperSnake(type);
+  const parts = [...type].map((ch) => {
+    if (!(ch in PUNCT)) throw new Error(`no enum spelling for token ${JSON.stringify(type)}`);
+    return PUNCT[ch];
+  });
+  return 'NK_' + parts.join('_');
+}
+
+function cString(s) {
+  return '"' + s.replace(/\\/g, '\\\\').replace(/"/g, '\\"') + '"';
+}
+
+const types = JSON.parse(fs.readFileSync(input, 'utf8'));
+const seen = new Map();
+const kinds = [];
+for (const t of types) {
+  const name = enumName(t.type, t.named);
+  const key = `${t.type}\u0000${t.named}`;
+  if (seen.has(key)) continue;
+  if ([...seen.values()].includes(name)) throw new Error(`duplicate enum name ${name}`);
+  seen.set(key, name);
+  kinds.push({ name, type: t.type, named: t.named });
+}
+
+const fieldNames = [...new Set(types.flatMap((t) => Object.keys(t.fields || {})))].sort();
+const fields = fieldNames.map((f) => ({ name: 'NF_' + upperSnake(f), field: f }));
+
+// every kind must be in ts_symbol_names and every field in ts_field_names
+function checkParser() {
+  const src = fs.readFileSync(parserPath, 'utf8');
+  const table = (name) => {
+    const m = src.match(new RegExp(`\\b${name}\\[\\] = \\{([\\s\\S]*?)\\n\\};`));
+    return m ? m[1] : '';
+  };
+  const symbols = table('ts_symbol_names');
+  const fieldTable = table('ts_field_names');
+  const missing = [
+    ...kinds.filter((k) => !symbols.includes(`= ${cString(k.type)},`)).map((k) => k.type),
+    ...fields.filter((f) => !fieldTable.includes(`= ${cString(f.field)},`)).map((f) => `field ${f.field}`),
+  ];
+  // the external scanner and keyword extraction only run if parser.c was
+  // generated with the externals and word of grammar.json
+  const grammarPath = path.join(path.dirname(parserPath), 'grammar.json');
+  if (fs.existsSync(grammarPath)) {
+    const grammar = JSON.parse(fs.readFileSync(grammarPath, 'utf8'));
+    const externals = (grammar.externals || []).length;
+    const m = src.match(/#define EXTERNAL_TOKEN_COUNT (\d+)/);
+    if (!m || Number(m[1]) !== externals) missing.push(`${externals} external tokens (EXTERNAL_TOKEN_COUNT ${m ? m[1] : 'absent'})`);
+    if (grammar.word && !src.includes('.keyword_capture_token')) missing.push(`keyword extraction (word: ${grammar.word})`);
+  }
+  if (missing.length > 0) {
+    console.error(`${path.relative(root, parserPath)} does not match ${path.relative(root, input)}; missing: ${missing.join(', ')}`);
+    console.error('Regenerate the parser first: (cd Lab1 && npx tree-sitter generate)');
+    process.exit(1);
+  }
+}
+checkParser();
+
+const width = Math.max(...kinds.map((k) => k.name.length));
+let out = '';
+out += '/* Generated by Lab2/gen_node_kinds.js from Lab1/src/node-types.json. Do not edit. */\n';
+out += '#ifndef LAB2_NODE_KINDS_H\n#define LAB2_NODE_KINDS_H\n\n';
+out += 'typedef enum NodeKind {\n  NK_UNKNOWN = 0,\n';
+for (const k of kinds) out += `  ${k.name},\n`;
+out += '  NK_COUNT\n} NodeKind;\n\n';
+out += '/* X(kind, type name, is_named) */\n#define NODE_KIND_LIST(X) \\\n';
+out += kinds
+  .map((k) => `  X(${(k.name + ',').padEnd(width + 1)} ${cString(k.type)}, ${k.named ? 1 : 0})`)
+  .join(' \\\n');
+out += '\n\ntypedef enum NodeField {\n  NF_NONE = 0,\n';
+for (const f of fields) out += `  ${f.name},\n`;
+out += '  NF_COUNT\n} NodeField;\n\n';
+const fieldWidth = Math.max(...fields.map((f) => f.name.length));
+out += '/* X(field, field name) */\n#define NODE_FIELD_LIST(X) \\\n';
+out += fields
+  .map((f) => `  X(${(f.name + ',').padEnd(fieldWidth + 1)} ${cString(f.field)})`)
+  .join(' \\\n');
+out += '\n\n#endif\n';
+
+fs.writeFileSync(output, out);
@@ -11,8 +11,10 @@ rm -f "$OUTDIR"/*.dot "$OUTDIR"/*.pdf || true
 LAB2_BIN="$ROOT/lab2_cfg"
 if [ ! -x "$LAB2_BIN" ]; then
   echo "Building lab2_cfg..."
-  clang "$ROOT/Lab2/main.c" "$ROOT/Lab1/src/parser.c" \
-    "$ROOT/vendor/tree-sitter/lib/src/lib.c" -I "$ROOT/vendor/tree-sitter/lib/include" -I "$ROOT/vendor/tree-sitter/lib/src" -o "$LAB2_BIN"
+  node "$ROOT/Lab2/gen_node_kinds.js"
+  clang "$ROOT/Lab2/main.c" "$ROOT/Lab2/flow.c" "$ROOT/Lab2/ir.c" "$ROOT/Lab2/callgraph.c" "$ROOT/Lab2/session.c" "$ROOT/Lab2/cfg_cache.c" "$ROOT/Lab2/cfgbin.c" "$ROOT/Lab2/ndjson.c" "$ROOT/Lab2/worksteal.c" "$ROOT/Lab2/chunk_parse.c" "$ROOT/Lab2/hash.c" "$ROOT/Lab2/node_kind.c" "$ROOT/Lab2/flat_ast.c" "$ROOT/Lab2/query.c" "$ROOT/Lab2/source_map.c" "$ROOT/Lab2/arena.c" "$ROOT/Lab1/src/parser.c" "$ROOT/Lab1/src/scanner.c" \
+    "$ROOT/vendor/tree-sitter/lib/src/lib.c" -I "$ROOT/vendor/tree-sitter/lib/include" -I "$ROOT/vendor/tree-sitter/lib/src" \
+    -I "$ROOT/Lab2" -lm -pthread -o "$LAB2_BIN"
 fi
 
 if [ $# -eq 0 ]; then
@@ -22,7 +24,7 @@ else
 fi
 
 echo "Generating CFG DOTs into $OUTDIR"
-"$LAB2_BIN" "${files[@]}" --outdir "$OUTDIR"
+"$LAB2_BIN" "${files[@]}" --outdir "$OUTDIR" --jobs "${JOBS:-0}" --global-callgraph
 
 echo "Assembling global all_functions.dot"
 ALLF="$OUTDIR/all_functions.dot"
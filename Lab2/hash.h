@@ -0,0 +1,10 @@
+#ifndef LAB2_HASH_H
+#define LAB2_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// XXH64 (xxHash, 64-bit variant): fast non-cryptographic hash of a byte range.
+uint64_t hash64(const void *data, size_t len, uint64_t seed);
+
+#endif
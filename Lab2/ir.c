@@ -0,0 +1,495 @@
+#include "ir.h"
+#include "node_kind.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ---- building ----
+
+typedef struct BuildTask {
+  uint32_t node;
+  IrExpr **slot;
+} BuildTask;
+
+typedef struct TaskStack {
+  BuildTask *a;
+  int n;
+  int cap;
+} TaskStack;
+
+static void push_task(TaskStack *st, uint32_t node, IrExpr **slot) {
+  if (st->n + 1 > st->cap) {
+    st->cap = (st->cap == 0) ? 32 : st->cap * 2;
+    st->a = realloc(st->a, sizeof(BuildTask) * st->cap);
+  }
+  st->a[st->n].node = node;
+  st->a[st->n].slot = slot;
+  st->n++;
+}
+
+static void trimmed_slice(const SourceText *src, const FlatNode *node, const char **out, uint32_t *out_len) {
+  uint32_t s = node->start_byte;
+  uint32_t e = node->end_byte;
+  uint32_t len = (e > s) ? e - s : 0;
+  const char *p = source_text_at(src, s);
+  while (len > 0 && isspace((unsigned char)p[0])) { p++; len--; }
+  while (len > 0 && isspace((unsigned char)p[len-1])) len--;
+  *out = p;
+  *out_len = len;
+}
+
+static IrExpr *new_expr(Arena *a, IrExprKind kind, const FlatAst *ast, uint32_t node) {
+  IrExpr *e = arena_alloc(a, sizeof(IrExpr));
+  memset(e, 0, sizeof(*e));
+  e->kind = (unsigned char)kind;
+  e->text = "";
+  if (node != FLAT_NONE) e->start_byte = ast->nodes[node].start_byte;
+  return e;
+}
+
+static IrExpr *leaf(Arena *a, IrExprKind kind, const SourceText *src, const FlatAst *ast, uint32_t node) {
+  IrExpr *e = new_expr(a, kind, ast, node);
+  trimmed_slice(src, &ast->nodes[node], &e->text, &e->len);
+  return e;
+}
+
+static void set_static_text(IrExpr *e, const char *s) { e->text = s; e->len = (uint32_t)strlen(s); }
+
+// Long or compound expressions nobody has a dedicated IR for are shown as a
+// short placeholder instead of their full text.
+static IrExpr *summarized(Arena *a, const SourceText *src, const FlatAst *ast, uint32_t node) {
+  IrExpr *e = leaf(a, IR_TEXT, src, ast, node);
+  if (e->len == 0) { set_static_text(e, "expr"); return e; }
+  if (e->len <= 18) return e;
+  if (e->len <= 28 && memchr(e->text, '(', e->len)) return e;
+  for (uint32_t i=0;i<e->len;i++) {
+    if (strchr("+-*/%&|^=!<>", e->text[i])) { set_static_text(e, "complex_expr"); return e; }
+  }
+  set_static_text(e, "expr");
+  return e;
+}
+
+static uint32_t first_named_child(const FlatAst *ast, uint32_t node) {
+  for (uint32_t c = flat_first_child(ast, node); c != FLAT_NONE; c = flat_next_sibling(ast, node, c))
+    if (flat_is_named(ast, c)) return c;
+  return FLAT_NONE;
+}
+
+// First identifier of the subtree in preorder: the subtree is the next
+// `size` entries of the array.
+static uint32_t first_identifier(const FlatAst *ast, uint32_t node) {
+  uint32_t end = node + ast->nodes[node].size;
+  for (uint32_t i=node; i<end; i++)
+    if (flat_kind(ast, i) == NK_IDENTIFIER) return i;
+  return FLAT_NONE;
+}
+
+static IrOp token_op(NodeKind k) {
+  switch (k) {
+    case NK_PIPE_PIPE: case NK_KW_OR: return IR_OP_OR;
+    case NK_AMP_AMP: case NK_KW_AND: return IR_OP_AND;
+    case NK_PIPE: return IR_OP_BIT_OR;
+    case NK_CARET: return IR_OP_BIT_XOR;
+    case NK_AMP: return IR_OP_BIT_AND;
+    case NK_EQ: return IR_OP_EQ;
+    case NK_BANG_EQ: return IR_OP_NE;
+    case NK_LT: return IR_OP_LT;
+    case NK_GT: return IR_OP_GT;
+    case NK_LT_EQ: return IR_OP_LE;
+    case NK_GT_EQ: return IR_OP_GE;
+    case NK_LT_LT: return IR_OP_SHL;
+    case NK_GT_GT: return IR_OP_SHR;
+    case NK_PLUS: return IR_OP_ADD;
+    case NK_MINUS: return IR_OP_SUB;
+    case NK_STAR: return IR_OP_MUL;
+    case NK_SLASH: return IR_OP_DIV;
+    case NK_PERCENT: return IR_OP_MOD;
+    default: return IR_OP_NONE;
+  }
+}
+
+static IrOp unary_op(NodeKind k) {
+  switch (k) {
+    case NK_MINUS: return IR_OP_NEG;
+    case NK_BANG: case NK_KW_NOT: return IR_OP_NOT;
+    case NK_TILDE: return IR_OP_BIT_NOT;
+    default: return IR_OP_NONE;
+  }
+}
+
+static int count_named(const FlatAst *ast, uint32_t node) {
+  int n = 0;
+  for (uint32_t c = flat_first_child(ast, node); c != FLAT_NONE; c = flat_next_sibling(ast, node, c))
+    if (flat_is_named(ast, c)) n++;
+  return n;
+}
+
+// Allocate e->args for the named children of list (an exprList, may be
+// FLAT_NONE) after `skip` leading slots, and queue them.
+static void queue_list(Arena *a, IrExpr *e, int skip, const FlatAst *ast, uint32_t list, TaskStack *st) {
+  int n = (list == FLAT_NONE) ? 0 : count_named(ast, list);
+  e->n_args = skip + n;
+  e->args = arena_alloc(a, sizeof(IrExpr*) * (e->n_args ? e->n_args : 1));
+  if (n == 0) return;
+  int i = skip;
+  for (uint32_t c = flat_first_child(ast, list); c != FLAT_NONE; c = flat_next_sibling(ast, list, c)) {
+    if (!flat_is_named(ast, c)) continue;
+    push_task(st, c, &e->args[i++]);
+  }
+}
+
+// precedence level of a binary operator, as in grammar.js PREC
+static int binary_level(IrOp op) {
+  switch (op) {
+    case IR_OP_OR: return 1;
+    case IR_OP_AND: return 2;
+    case IR_OP_BIT_OR: return 3;
+    case IR_OP_BIT_XOR: return 4;
+    case IR_OP_BIT_AND: return 5;
+    case IR_OP_EQ: case IR_OP_NE: return 6;
+    case IR_OP_LT: case IR_OP_GT: case IR_OP_LE: case IR_OP_GE: return 7;
+    case IR_OP_SHL: case IR_OP_SHR: return 8;
+    case IR_OP_ADD: case IR_OP_SUB: return 9;
+    case IR_OP_MUL: case IR_OP_DIV: case IR_OP_MOD: return 10;
+    default: return 0;
+  }
+}
+
+static IrBinaryGroup binary_group(IrOp op) {
+  switch (binary_level(op)) {
+    case 1: case 2: return IR_GROUP_LOGIC;
+    case 3: case 4: case 5: case 8: return IR_GROUP_BITWISE;
+    case 6: case 7: return IR_GROUP_COMPARE;
+    case 9: return IR_GROUP_ADD;
+    default: return IR_GROUP_MUL;
+  }
+}
+
+// left operand, operator and right operand of a binary_expression; an
+// operand lost to error recovery is FLAT_NONE
+static void binary_parts(const FlatAst *ast, uint32_t node, uint32_t *left, IrOp *op, uint32_t *right) {
+  *left = flat_field(ast, node, NF_LEFT);
+  *right = flat_field(ast, node, NF_RIGHT);
+  uint32_t tok = flat_field(ast, node, NF_OPERATOR);
+  *op = (tok == FLAT_NONE) ? IR_OP_NONE : token_op(flat_kind(ast, tok));
+}
+
+// A left-nested run of binary_expression nodes on one precedence level
+// (a + b - c) becomes one IR_BINARY with n operands, so the IR matches one
+// grammar rule per level.
+static IrExpr *build_binary(Arena *a, const FlatAst *ast, uint32_t node, TaskStack *st) {
+  uint32_t left, right;
+  IrOp op;
+  binary_parts(ast, node, &left, &op, &right);
+  int level = binary_level(op);
+  int operands = 2;
+  for (uint32_t cur = left; cur != FLAT_NONE && flat_kind(ast, cur) == NK_BINARY_EXPRESSION; ) {
+    uint32_t l, r;
+    IrOp o;
+    binary_parts(ast, cur, &l, &o, &r);
+    if (binary_level(o) != level) break;
+    operands++;
+    cur = l;
+  }
+  IrExpr *e = new_expr(a, IR_BINARY, ast, node);
+  e->group = (unsigned char)binary_group(op);
+  e->n_args = operands;
+  e->args = arena_alloc(a, sizeof(IrExpr*) * operands);
+  e->ops = arena_alloc(a, (size_t)operands - 1);
+  // fill from the right while walking down the left spine
+  for (int i=operands-1;i>0;i--) {
+    binary_parts(ast, node, &left, &op, &right);
+    e->ops[i-1] = (unsigned char)op;
+    push_task(st, right, &e->args[i]);
+    node = left;
+  }
+  push_task(st, node, &e->args[0]);
+  return e;
+}
+
+// One IR node for `node`. The expr and parenthesized_expression wrappers are
+// passed through; the operands of the node that is created are queued on st.
+static IrExpr *build_one(Arena *a, const SourceText *src, const FlatAst *ast, uint32_t node, TaskStack *st) {
+  for (;;) {
+    if (node == FLAT_NONE) return new_expr(a, IR_MISSING, ast, node);
+    switch (flat_kind(ast, node)) {
+    case NK_EXPR:
+      node = first_named_child(ast, node);
+      continue;
+    case NK_IDENTIFIER:
+      return leaf(a, IR_IDENT, src, ast, node);
+    case NK_LITERAL: case NK_BOOL: case NK_STR: case NK_CHAR:
+    case NK_HEX: case NK_BITS: case NK_DEC:
+      return leaf(a, IR_LITERAL, src, ast, node);
+    case NK_PARENTHESIZED_EXPRESSION: {
+      uint32_t child = first_named_child(ast, node);
+      if (child == FLAT_NONE) return leaf(a, IR_TEXT, src, ast, node);
+      node = child;
+      continue;
+    }
+    case NK_POSTFIX: {
+      uint32_t callee = flat_field(ast, node, NF_OPERAND);
+      uint32_t open = flat_field(ast, node, NF_OPEN);
+      uint32_t args = flat_field(ast, node, NF_ARGS);
+      if (callee == FLAT_NONE) return new_expr(a, IR_MISSING, ast, node);
+      NodeKind ok = (open == FLAT_NONE) ? NK_UNKNOWN : flat_kind(ast, open);
+      if (ok == NK_LPAREN) {
+        uint32_t name = first_identifier(ast, callee);
+        IrExpr *e;
+        if (name != FLAT_NONE) {
+          e = leaf(a, IR_CALL, src, ast, name);
+          e->start_byte = ast->nodes[node].start_byte;
+        } else {
+          e = summarized(a, src, ast, callee);
+          e->kind = IR_CALL;
+        }
+        queue_list(a, e, 0, ast, args, st);
+        return e;
+      }
+      if (ok == NK_LBRACK) {
+        IrExpr *e = new_expr(a, IR_INDEX, ast, node);
+        queue_list(a, e, 1, ast, args, st);
+        push_task(st, callee, &e->args[0]);
+        return e;
+      }
+      node = callee;
+      continue;
+    }
+    case NK_UNARY_EXPRESSION: {
+      uint32_t op = flat_field(ast, node, NF_OPERATOR);
+      if (op == FLAT_NONE) return new_expr(a, IR_MISSING, ast, node);
+      IrExpr *e = leaf(a, IR_UNARY, src, ast, op);
+      e->start_byte = ast->nodes[node].start_byte;
+      e->op = (unsigned char)unary_op(flat_kind(ast, op));
+      e->n_args = 1;
+      e->args = arena_alloc(a, sizeof(IrExpr*));
+      push_task(st, flat_field(ast, node, NF_OPERAND), &e->args[0]);
+      return e;
+    }
+    case NK_BINARY_EXPRESSION:
+      return build_binary(a, ast, node, st);
+    default:
+      return summarized(a, src, ast, node);
+    }
+  }
+}
+
+IrExpr *ir_build_expr(Arena *a, const SourceText *src, const FlatAst *ast, uint32_t node) {
+  IrExpr *result = NULL;
+  TaskStack st = {0};
+  push_task(&st, node, &result);
+  while (st.n > 0) {
+    BuildTask t = st.a[--st.n];
+    *t.slot = build_one(a, src, ast, t.node, &st);
+  }
+  free(st.a);
+  return result;
+}
+
+// ---- rendering ----
+
+// A pending piece of output: either text or an expression still to render.
+typedef struct RenderItem {
+  const IrExpr *e;
+  const char *s;
+  size_t len;
+} RenderItem;
+
+typedef struct RenderStack {
+  RenderItem *a;
+  int n;
+  int cap;
+  RenderItem local[64];
+} RenderStack;
+
+static void push_item(RenderStack *st, const IrExpr *e, const char *s, size_t len) {
+  if (st->n + 1 > st->cap) {
+    int cap = st->cap * 2;
+    if (st->a == st->local) {
+      st->a = malloc(sizeof(RenderItem) * cap);
+      memcpy(st->a, st->local, sizeof(st->local));
+    } else {
+      st->a = realloc(st->a, sizeof(RenderItem) * cap);
+    }
+    st->cap = cap;
+  }
+  st->a[st->n].e = e;
+  st->a[st->n].s = s;
+  st->a[st->n].len = len;
+  st->n++;
+}
+
+static void push_str(RenderStack *st, const char *s) { push_item(st, NULL, s, strlen(s)); }
+static void push_expr(RenderStack *st, const IrExpr *e) { push_item(st, e, NULL, 0); }
+
+static void put(FILE *f, const char *s, size_t len, IrEscape esc) {
+  if (esc == IR_ESC_NONE) { fwrite(s, 1, len, f); return; }
+  for (size_t i=0;i<len;i++) {
+    unsigned char ch = (unsigned char)s[i];
+    if (ch == '"' || ch == '\\') fprintf(f, "\\%c", ch);
+    else if (ch == '\n') fputs("\\n", f);
+    else if (ch == '\r') fputs("\\r", f);
+    else if (esc == IR_ESC_JSON && ch == '\t') fputs("\\t", f);
+    else if (esc == IR_ESC_JSON && ch < 0x20) fprintf(f, "\\u%04x", ch);
+    else fputc(ch, f);
+  }
+}
+
+static const char *group_open(IrBinaryGroup g) {
+  switch (g) {
+    case IR_GROUP_LOGIC: return "BinaryOp(LogicExpr) { ";
+    case IR_GROUP_BITWISE: return "BinaryOp(BitwiseExpr) { ";
+    case IR_GROUP_COMPARE: return "BinaryOp(CompareExpr) { ";
+    case IR_GROUP_ADD: return "BinaryOp(AddExpr) { ";
+    default: return "BinaryOp(MulExpr) { ";
+  }
+}
+
+// Queue the pieces of e in reverse so they pop in output order.
+static void expand(RenderStack *st, const IrExpr *e) {
+  switch (e->kind) {
+  case IR_MISSING:
+    push_str(st, "...");
+    return;
+  case IR_IDENT:
+    push_str(st, "]"); push_item(st, NULL, e->text, e->len); push_str(st, "Nop(Identifier) [var:");
+    return;
+  case IR_LITERAL:
+    push_str(st, "]"); push_item(st, NULL, e->text, e->len); push_str(st, "Nop(Literal) [const:");
+    return;
+  case IR_TEXT:
+    push_str(st, ")"); push_item(st, NULL, e->text, e->len); push_str(st, "Expr(");
+    return;
+  case IR_UNARY:
+    push_str(st, " }"); push_expr(st, e->args[0]);
+    push_str(st, ") { "); push_item(st, NULL, e->text, e->len); push_str(st, "UnaryOp(");
+    return;
+  case IR_BINARY: {
+    // left fold: BinaryOp(G) { BinaryOp(G) { a | b } | c }
+    for (int i=e->n_args-1;i>=1;i--) { push_str(st, " }"); push_expr(st, e->args[i]); push_str(st, " | "); }
+    push_expr(st, e->args[0]);
+    const char *open = group_open(e->group);
+    for (int i=1;i<e->n_args;i++) push_str(st, open);
+    return;
+  }
+  case IR_CALL:
+    if (e->n_args == 0) {
+      push_str(st, ") { }");
+    } else {
+      push_str(st, " }");
+      for (int i=e->n_args-1;i>=1;i--) { push_expr(st, e->args[i]); push_str(st, " | "); }
+      push_expr(st, e->args[0]);
+      push_str(st, ") { ");
+    }
+    push_item(st, NULL, e->text, e->len); push_str(st, "Call(");
+    return;
+  case IR_INDEX:
+    push_str(st, " }");
+    if (e->n_args == 1) push_str(st, "...");
+    else if (e->n_args == 2) push_expr(st, e->args[1]);
+    else {
+      push_str(st, " }");
+      for (int i=e->n_args-1;i>=2;i--) { push_expr(st, e->args[i]); push_str(st, " | "); }
+      push_expr(st, e->args[1]);
+      push_str(st, "Tuple { ");
+    }
+    push_str(st, " | "); push_expr(st, e->args[0]); push_str(st, "BinaryOp(IndexExpr) { ");
+    return;
+  }
+}
+
+static void write_expr(FILE *f, const IrExpr *root, IrEscape esc) {
+  RenderStack st;
+  st.a = st.local; st.n = 0; st.cap = (int)(sizeof(st.local) / sizeof(st.local[0]));
+  if (!root) { put(f, "...", 3, esc); return; }
+  push_expr(&st, root);
+  while (st.n > 0) {
+    RenderItem it = st.a[--st.n];
+    if (it.e) expand(&st, it.e);
+    else put(f, it.s, it.len, esc);
+  }
+  if (st.a != st.local) free(st.a);
+}
+
+static void write_str(FILE *f, const char *s, IrEscape esc) { put(f, s, strlen(s), esc); }
+
+void ir_write_stmt(FILE *f, const IrStmt *s, IrEscape esc) {
+  switch (s->kind) {
+  case IRS_TEXT:
+    put(f, s->text, s->text_len, esc);
+    return;
+  case IRS_ASSIGN:
+    write_str(f, "Assign(=)\n  lhs: ", esc);
+    write_expr(f, s->target, esc);
+    write_str(f, "\n  rhs: ", esc);
+    break;
+  case IRS_EXPR:
+    write_str(f, "ExprStmt\n  expr: ", esc);
+    break;
+  case IRS_IF_COND:
+    write_str(f, "IfCond\n  expr: ", esc);
+    break;
+  case IRS_WHILE_COND:
+    write_str(f, "WhileCond\n  expr: ", esc);
+    break;
+  case IRS_REPEAT_COND:
+    write_str(f, "RepeatCond(", esc);
+    put(f, s->text, s->text_len, esc);
+    write_str(f, ")\n  expr: ", esc);
+    break;
+  case IRS_VAR_DECL:
+    write_str(f, "VarDecl(", esc);
+    put(f, s->text, s->text_len, esc);
+    write_str(f, ")\n  var: ", esc);
+    put(f, s->name, s->name_len, esc);
+    return;
+  default:
+    return;
+  }
+  write_expr(f, s->expr, esc);
+}
+
+void ir_for_each_call(const IrStmt *s, void (*cb)(const IrExpr *call, void *userdata), void *userdata) {
+  const IrExpr *local[64];
+  const IrExpr **stack = local;
+  int n = 0, cap = 64;
+  if (s->expr) stack[n++] = s->expr;
+  if (s->target) stack[n++] = s->target; /* popped first: lhs precedes rhs */
+  while (n > 0) {
+    const IrExpr *e = stack[--n];
+    if (e->kind == IR_CALL) cb(e, userdata);
+    if (n + e->n_args > cap) {
+      while (n + e->n_args > cap) cap *= 2;
+      if (stack == local) { stack = malloc(sizeof(*stack) * cap); memcpy(stack, local, sizeof(local)); }
+      else stack = realloc(stack, sizeof(*stack) * cap);
+    }
+    for (int i=e->n_args-1;i>=0;i--) stack[n++] = e->args[i];
+  }
+  if (stack != local) free(stack);
+}
+
+static void relocate(const char **p, const char *from, size_t len, const char *to) {
+  uintptr_t v = (uintptr_t)*p, lo = (uintptr_t)from;
+  if (v >= lo && v - lo <= len) *p = to + (v - lo);
+}
+
+void ir_relocate_stmt(IrStmt *s, const char *from, size_t len, const char *to) {
+  relocate(&s->text, from, len, to);
+  relocate(&s->name, from, len, to);
+  IrExpr *local[64];
+  IrExpr **stack = local;
+  int n = 0, cap = 64;
+  if (s->expr) stack[n++] = s->expr;
+  if (s->target) stack[n++] = s->target;
+  while (n > 0) {
+    IrExpr *e = stack[--n];
+    relocate(&e->text, from, len, to);
+    if (n + e->n_args > cap) {
+      while (n + e->n_args > cap) cap *= 2;
+      if (stack == local) { stack = malloc(sizeof(*stack) * cap); memcpy(stack, local, sizeof(local)); }
+      else stack = realloc(stack, sizeof(*stack) * cap);
+    }
+    for (int i=0;i<e->n_args;i++) stack[n++] = e->args[i];
+  }
+  if (stack != local) free(stack);
+}
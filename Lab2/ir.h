@@ -0,0 +1,101 @@
+#ifndef LAB2_IR_H
+#define LAB2_IR_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "arena.h"
+#include "flat_ast.h"
+#include "source_map.h"
+
+// Typed operation trees attached to CFG blocks. Text slices (names, literals,
+// operator tokens) point into the SourceText the IR was built from, which
+// must outlive the IR.
+// Nothing is formatted while the CFG is built; ir_write_stmt() renders the
+// "Assign(=) ... BinaryOp(AddExpr) { ... }" text when DOT is written.
+
+typedef enum IrExprKind {
+  IR_MISSING,  /* absent operand, rendered "..." */
+  IR_IDENT,    /* text = identifier */
+  IR_LITERAL,  /* text = literal as written */
+  IR_TEXT,     /* anything else: text = (summarized) source text */
+  IR_UNARY,    /* op, text = operator token, args[0] = operand */
+  IR_BINARY,   /* group, args[0] op[0] args[1] op[1] ... args[n-1] */
+  IR_CALL,     /* text = callee name, args = call arguments */
+  IR_INDEX     /* args[0] = indexed value, args[1..] = indices */
+} IrExprKind;
+
+// precedence level of a binary chain; rendered as LogicExpr, AddExpr, ...
+typedef enum IrBinaryGroup {
+  IR_GROUP_LOGIC,
+  IR_GROUP_BITWISE,
+  IR_GROUP_COMPARE,
+  IR_GROUP_ADD,
+  IR_GROUP_MUL
+} IrBinaryGroup;
+
+typedef enum IrOp {
+  IR_OP_NONE,
+  IR_OP_OR, IR_OP_AND,
+  IR_OP_BIT_OR, IR_OP_BIT_XOR, IR_OP_BIT_AND,
+  IR_OP_EQ, IR_OP_NE, IR_OP_LT, IR_OP_GT, IR_OP_LE, IR_OP_GE,
+  IR_OP_SHL, IR_OP_SHR,
+  IR_OP_ADD, IR_OP_SUB, IR_OP_MUL, IR_OP_DIV, IR_OP_MOD,
+  IR_OP_NEG, IR_OP_NOT, IR_OP_BIT_NOT
+} IrOp;
+
+typedef struct IrExpr {
+  unsigned char kind;   /* IrExprKind */
+  unsigned char group;  /* IrBinaryGroup, IR_BINARY only */
+  unsigned char op;     /* IrOp, IR_UNARY only */
+  int n_args;
+  const char *text;
+  uint32_t len;
+  uint32_t start_byte;  /* where the expression starts in the source */
+  struct IrExpr **args;
+  unsigned char *ops;   /* IR_BINARY: n_args-1 IrOp values */
+} IrExpr;
+
+typedef enum IrStmtKind {
+  IRS_TEXT,        /* fixed text: "empty", "join", "Nop(exit)", ... */
+  IRS_ASSIGN,      /* target := expr */
+  IRS_EXPR,        /* expression statement */
+  IRS_IF_COND,
+  IRS_WHILE_COND,
+  IRS_REPEAT_COND, /* text = "while" / "until" */
+  IRS_VAR_DECL     /* text = type, name = variable */
+} IrStmtKind;
+
+typedef struct IrStmt {
+  unsigned char kind;   /* IrStmtKind */
+  const char *text;
+  uint32_t text_len;
+  const char *name;
+  uint32_t name_len;
+  IrExpr *target;
+  IrExpr *expr;
+} IrStmt;
+
+// Build the operation tree of the expression subtree at `node` of ast (expr,
+// postfix, binary_expression, ...; FLAT_NONE gives IR_MISSING). Iterative,
+// so nesting depth is bounded by memory only.
+IrExpr *ir_build_expr(Arena *a, const SourceText *src, const FlatAst *ast, uint32_t node);
+
+// how rendered text is escaped
+typedef enum IrEscape {
+  IR_ESC_NONE,
+  IR_ESC_DOT,  /* quotes, backslashes and newlines, for a quoted DOT string */
+  IR_ESC_JSON  /* as DOT, plus every other control character, for a JSON string */
+} IrEscape;
+
+// Render s in the DOT label text format.
+void ir_write_stmt(FILE *f, const IrStmt *s, IrEscape esc);
+
+// Visit every call in s in source order.
+void ir_for_each_call(const IrStmt *s, void (*cb)(const IrExpr *call, void *userdata), void *userdata);
+
+// Point every text slice of s that lies in from[0..len] at the same offset of
+// to instead, e.g. after copying a function's source text out of a buffer
+// that is about to change. Fixed strings ("auto", "expr", ...) are left alone.
+void ir_relocate_stmt(IrStmt *s, const char *from, size_t len, const char *to);
+
+#endif
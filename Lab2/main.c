@@ -1,355 +1,1240 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
 #include <sys/stat.h>
 #include <libgen.h>
-#include <ctype.h>
 #include <tree_sitter/api.h>
 #include "flow.h"
+#include "node_kind.h"
+#include "source_map.h"
+#include "arena.h"
+#include "callgraph.h"
+#include "cfg_cache.h"
+#include "cfgbin.h"
+#include "ndjson.h"
+#include "worksteal.h"
+#include "chunk_parse.h"
+#include "query.h"
+#include "flat_ast.h"
 
-static void dot_escape(FILE *out, const char *s) {
-  for (; *s; ++s) {
-    unsigned char ch = (unsigned char)*s;
-    if (ch == '"' || ch == '\\') fprintf(out, "\\%c", ch);
-    else if (ch == '\n') fputs("\\n", out);
-    else if (ch == '\r') fputs("\\r", out);
-    else fputc(ch, out);
+// объявление функции языка из Lab1 grammar
+const TSLanguage *tree_sitter_v2lang_test(void);
+
+static void print_text(const SourceText *source, uint32_t s, uint32_t e, char *out, size_t out_len) {
+  size_t len = (e > s) ? (e - s) : 0;
+  if (len >= out_len) len = out_len - 1;
+  if (len > 0) memcpy(out, source_text_at(source, s), len);
+  out[len] = '\0';
+}
+
+// Output produced for one input file. Workers render everything into memory;
+// commit_file_result() then writes the files and "Wrote ..." lines in input order.
+typedef struct Artifact {
+  char *path;
+  char *data;
+  size_t len;
+  int written;  /* --stream: already on disk, only the "Wrote" line is pending */
+} Artifact;
+
+typedef struct FileResult {
+  Artifact *arts;
+  int n_arts;
+  int cap_arts;
+  char *diag;      // buffered stderr text
+  size_t diag_len;
+  FILE *diag_f;
+  // --global-callgraph: this file's calls with callee names left unresolved;
+  // names [0, n_call_defs) are the functions defined in the file
+  CallGraph *calls;
+  int n_call_defs;
+  unsigned long cache_hits;
+  unsigned long cache_misses;
+  // --emit-bin: this file's records, appended to the artifact on commit
+  const char *path;
+  CfgBinPart *bin;
+} FileResult;
+
+static void file_result_init(FileResult *r) {
+  memset(r, 0, sizeof(*r));
+  r->diag_f = open_memstream(&r->diag, &r->diag_len);
+}
+
+static Artifact *artifact_push(FileResult *r, const char *path) {
+  if (r->n_arts + 1 > r->cap_arts) {
+    r->cap_arts = (r->cap_arts == 0) ? 4 : r->cap_arts * 2;
+    r->arts = realloc(r->arts, sizeof(Artifact) * r->cap_arts);
   }
+  Artifact *a = &r->arts[r->n_arts++];
+  a->path = strdup(path);
+  a->data = NULL;
+  a->len = 0;
+  a->written = 0;
+  return a;
 }
 
-// объявление функции языка из Lab1 grammar
-const TSLanguage *tree_sitter_v2lang_test(void);
+static FILE *artifact_begin(FileResult *r, const char *path) {
+  Artifact *a = artifact_push(r, path);
+  return open_memstream(&a->data, &a->len);
+}
 
-static char *read_file(const char *path, size_t *out_len) {
-  FILE *f = fopen(path, "rb");
-  if (!f) return NULL;
-  if (fseek(f, 0, SEEK_END) != 0) { fclose(f); return NULL; }
-  long n = ftell(f);
-  if (n < 0) { fclose(f); return NULL; }
-  if (fseek(f, 0, SEEK_SET) != 0) { fclose(f); return NULL; }
-  char *buf = malloc((size_t)n + 1);
-  if (!buf) { fclose(f); return NULL; }
-  size_t r = fread(buf,1,(size_t)n,f);
-  fclose(f);
-  buf[r] = '\0';
-  if (out_len) *out_len = r;
-  return buf;
+// write to path directly; the "Wrote" line still waits for the commit
+static FILE *artifact_stream(FileResult *r, const char *path) {
+  FILE *f = fopen(path, "w");
+  if (f) artifact_push(r, path)->written = 1;
+  return f;
 }
 
+// Call graph writers. nodes == NULL lists every name; with `defined` set only
+// edges whose callee is marked are written.
+static void write_callgraph_dot(FILE *f, const CallGraph *g, const int *nodes, int n_nodes, const unsigned char *defined) {
+  fprintf(f, "digraph CallGraph {\n");
+  if (nodes) for (int k=0;k<n_nodes;k++) fprintf(f, "  \"%s\";\n", g->names[nodes[k]]);
+  else for (int k=0;k<g->n_names;k++) fprintf(f, "  \"%s\";\n", g->names[k]);
+  for (int p=0;p<g->n_edges;p++) {
+    const CallEdge *e = &g->edges[p];
+    if (defined && !defined[e->callee]) continue;
+    fprintf(f, "  \"%s\" -> \"%s\" [label=\"%d\"];\n", g->names[e->caller], g->names[e->callee], e->count);
+  }
+  fprintf(f, "}\n");
+}
 
+static void write_callgraph_csv(FILE *f, const CallGraph *g, const unsigned char *defined) {
+  fprintf(f, "caller,callee,count\n");
+  for (int p=0;p<g->n_edges;p++) {
+    const CallEdge *e = &g->edges[p];
+    if (defined && !defined[e->callee]) continue;
+    fprintf(f, "%s,%s,%d\n", g->names[e->caller], g->names[e->callee], e->count);
+  }
+}
 
-static void print_node_text(const char *source, TSNode node, char *out, size_t out_len) {
-  uint32_t s = ts_node_start_byte(node);
-  uint32_t e = ts_node_end_byte(node);
-  size_t len = (e > s) ? (e - s) : 0;
-  if (len >= out_len) len = out_len - 1;
-  if (len > 0) memcpy(out, source + s, len);
-  out[len] = '\0';
+// --global-callgraph: one symbol table for the functions of every input.
+// Callee names are interned as files are committed; a call becomes an edge in
+// the output only if some input defines the callee, so calls into a module
+// that comes later on the command line resolve as well. Functions are keyed
+// by name, like in the per-file graphs.
+typedef struct GlobalCallGraph {
+  CallGraph g;
+  unsigned char *defined; /* per name id */
+  int cap_defined;
+  int *defs;              /* defined name ids, in definition order */
+  int n_defs;
+  int cap_defs;
+} GlobalCallGraph;
+
+static void global_callgraph_merge(GlobalCallGraph *gg, const CallGraph *local, int n_local_defs) {
+  int *map = malloc(sizeof(int) * (local->n_names ? local->n_names : 1));
+  for (int id=0; id<local->n_names; id++) {
+    int gid = callgraph_intern(&gg->g, local->names[id], local->name_len[id]);
+    map[id] = gid;
+    if (gg->g.n_names > gg->cap_defined) {
+      int cap = (gg->cap_defined == 0) ? 64 : gg->cap_defined;
+      while (cap < gg->g.n_names) cap *= 2;
+      gg->defined = realloc(gg->defined, (size_t)cap);
+      memset(gg->defined + gg->cap_defined, 0, (size_t)(cap - gg->cap_defined));
+      gg->cap_defined = cap;
+    }
+    if (id < n_local_defs && !gg->defined[gid]) {
+      gg->defined[gid] = 1;
+      if (gg->n_defs + 1 > gg->cap_defs) { gg->cap_defs = (gg->cap_defs==0)?64:gg->cap_defs*2; gg->defs = realloc(gg->defs, sizeof(int)*gg->cap_defs); }
+      gg->defs[gg->n_defs++] = gid;
+    }
+  }
+  for (int e=0; e<local->n_edges; e++) {
+    const CallEdge *ce = &local->edges[e];
+    callgraph_add_call(&gg->g, map[ce->caller], map[ce->callee], ce->count);
+  }
+  free(map);
+}
+
+static void global_callgraph_write(const GlobalCallGraph *gg, const char *outdir) {
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/callgraph.dot", outdir);
+  FILE *cf = fopen(path, "w");
+  if (!cf) { fprintf(stderr, "Cannot write callgraph %s\n", path); return; }
+  write_callgraph_dot(cf, &gg->g, gg->defs, gg->n_defs, gg->defined);
+  fclose(cf);
+  printf("Wrote %s\n", path);
+
+  snprintf(path, sizeof(path), "%s/callgraph.csv", outdir);
+  FILE *csv = fopen(path, "w");
+  if (!csv) { fprintf(stderr, "Cannot write %s\n", path); return; }
+  write_callgraph_csv(csv, &gg->g, gg->defined);
+  fclose(csv);
+  printf("Wrote %s\n", path);
+}
+
+static void global_callgraph_free(GlobalCallGraph *gg) {
+  callgraph_free(&gg->g);
+  free(gg->defined);
+  free(gg->defs);
+}
+
+// --function NAME / --range START:END: only functions with one of the names,
+// or whose text overlaps one of the byte ranges, are parsed and analysed.
+typedef struct FuncFilter {
+  const char **names;
+  int n_names;
+  uint32_t *range_start;  /* [start, end) pairs */
+  uint32_t *range_end;
+  int n_ranges;
+} FuncFilter;
+
+// Command line settings shared by all files of a run.
+typedef struct RunOptions {
+  const char *outdir;
+  int global_calls;  /* --global-callgraph */
+  CfgCache *cache;   /* --cache-dir, or NULL */
+  CfgBinWriter *bin; /* --emit-bin, or NULL; used by the committing thread only */
+  FILE *ndjson;      /* --format ndjson: records go here instead of DOT files */
+  int stream;        /* --stream: DOT files are written by the workers */
+  int func_jobs;     /* --function-jobs: threads building the CFGs of one file */
+  int parse_jobs;    /* --parse-jobs: chunks one large file is parsed in */
+  const FuncFilter *filter;  /* --function / --range, or NULL */
+} RunOptions;
+
+// gg is NULL unless --global-callgraph is on
+static void commit_file_result(FileResult *r, const RunOptions *opt, GlobalCallGraph *gg) {
+  if (r->diag_f) { fclose(r->diag_f); r->diag_f = NULL; }
+  if (r->diag_len > 0) fwrite(r->diag, 1, r->diag_len, stderr);
+  for (int i=0;i<r->n_arts;i++) {
+    Artifact *a = &r->arts[i];
+    FILE *f = a->written ? NULL : fopen(a->path, "w");
+    if (a->written) printf("Wrote %s\n", a->path);
+    else if (!f) fprintf(stderr, "Cannot write %s\n", a->path);
+    else {
+      if (a->len > 0) fwrite(a->data, 1, a->len, f);
+      fclose(f);
+      printf("Wrote %s\n", a->path);
+    }
+    free(a->path);
+    free(a->data);
+  }
+  free(r->arts);
+  free(r->diag);
+  if (opt->cache) {
+    opt->cache->hits += r->cache_hits;
+    opt->cache->misses += r->cache_misses;
+  }
+  if (r->bin) {
+    cfgbin_writer_add_file(opt->bin, r->path, r->bin);
+    if (r->calls && !gg) cfgbin_writer_add_calls(opt->bin, r->calls, NULL, (uint32_t)opt->bin->count[CFGBIN_FILES] - 1);
+    cfgbin_part_free(r->bin);
+    free(r->bin);
+  }
+  if (r->calls) {
+    if (gg) global_callgraph_merge(gg, r->calls, r->n_call_defs);
+    callgraph_free(r->calls);
+    free(r->calls);
+  }
+  fflush(stdout);
+  memset(r, 0, sizeof(*r));
+}
+
+// Add the call sites of one function (name id caller) to cg. Callees that
+// are not functions of the file are dropped, unless they may resolve to
+// another input (global_calls). With a filter only some functions are in cg;
+// defs then holds every function name of the file.
+static void add_function_calls(CallGraph *cg, int caller, const FrozenCFG *cfg, int global_calls, const CallGraph *defs) {
+  for (int k=0; k<cfg->n_calls; k++) {
+    const CallSite *cs = &cfg->calls[k];
+    int callee;
+    if (global_calls) callee = callgraph_intern(cg, cs->callee, cs->callee_len);
+    else if (defs) callee = (callgraph_find(defs, cs->callee, cs->callee_len) >= 0) ? callgraph_intern(cg, cs->callee, cs->callee_len) : -1;
+    else callee = callgraph_find(cg, cs->callee, cs->callee_len);
+    if (callee >= 0) callgraph_add_call(cg, caller, callee, 1);
+  }
+}
+
+// one subgraph of the per-file DOT, nodes prefixed <prefix>_f<fi>_n<id>
+// DOT node prefix of an input: "file_" and the base name with every
+// character other than a letter or digit replaced by '_'
+static void file_prefix(const char *base, char *prefix, size_t len) {
+  char sbase[256]; size_t si = 0;
+  for (size_t ii=0; ii<strlen(base) && si+1<sizeof(sbase); ii++) {
+    char ch = base[ii];
+    if ((ch >= 'a' && ch <= 'z') || (ch >='A' && ch<='Z') || (ch>='0' && ch<='9')) sbase[si++] = ch;
+    else sbase[si++] = '_';
+  }
+  sbase[si] = '\0';
+  snprintf(prefix, len, "file_%s", sbase);
+}
+
+static void write_function_dot(FILE *of, const char *prefix, int fi, const char *name, const FrozenCFG *cfg) {
+  fprintf(of, "  subgraph cluster_f%d {\n", fi);
+  fprintf(of, "    label=\"function %s\";\n", name);
+  for (int n=0;n<cfg->n_nodes;n++) {
+    fprintf(of, "    %s_f%d_n%d [shape=box,label=\"B%d (%s)", prefix, fi, n, n, cfg_role_name(cfg->role[n]));
+    for (int op=cfg->ops_start[n]; op<cfg->ops_start[n+1]; op++) {
+      fputs("\\n", of);
+      ir_write_stmt(of, &cfg->ops[op], IR_ESC_DOT);
+    }
+    fputs("\"];\n", of);
+  }
+  for (int n=0;n<cfg->n_nodes;n++) {
+    for (int j=cfg->succ_start[n]; j<cfg->succ_start[n+1]; j++) {
+      int to = cfg->succ[j];
+      const char *lab = cfg_edge_label(cfg->succ_kind[j]);
+      if (lab) fprintf(of, "    %s_f%d_n%d -> %s_f%d_n%d [label=\"%s\"];\n", prefix, fi, n, prefix, fi, to, lab);
+      else fprintf(of, "    %s_f%d_n%d -> %s_f%d_n%d;\n", prefix, fi, n, prefix, fi, to);
+    }
+  }
+  fprintf(of, "  }\n");
+}
+
+static void delete_trees(TSTree **trees, int n) {
+  for (int i=0;i<n;i++) ts_tree_delete(trees[i]);
+  free(trees);
 }
 
-// Найти идентификатор имени функции внутри funcSignature
-static void get_func_name(const char *source, TSNode func_node, char *out, size_t out_len) {
-  uint32_t child_count = ts_node_child_count(func_node);
-  for (uint32_t i=0;i<child_count;i++){
-    TSNode c = ts_node_child(func_node, i);
-    const char *type = ts_node_type(c);
-    if (strcmp(type, "funcSignature") == 0) {
-      // найти ребёнка identifier
-      uint32_t cc = ts_node_child_count(c);
-      for (uint32_t j=0;j<cc;j++){
-        TSNode g = ts_node_child(c,j);
-        if (strcmp(ts_node_type(g), "identifier") == 0) {
-          print_node_text(source, g, out, out_len);
-          return;
+static int filter_overlaps(const FuncFilter *f, uint32_t start, uint32_t end) {
+  for (int i=0;i<f->n_ranges;i++) {
+    if (start < f->range_end[i] && f->range_start[i] < end) return 1;
+  }
+  return 0;
+}
+
+static int filter_has_name(const FuncFilter *f, const char *name) {
+  for (int i=0;i<f->n_names;i++) if (strcmp(f->names[i], name) == 0) return 1;
+  return 0;
+}
+
+// Pre-scan state for a filter: a function's text runs up to the next
+// function start, so it is decided on when that start is seen.
+typedef struct FilterScan {
+  const FuncFilter *filter;
+  CallGraph *defs;     /* every function name of the file */
+  TSRange *ranges;     /* selected text, adjacent functions merged */
+  int n_ranges;
+  int cap_ranges;
+  int have_prev;
+  ChunkFunc prev;
+} FilterScan;
+
+static void filter_decide(FilterScan *fs, uint32_t end, TSPoint end_point) {
+  if (!fs->have_prev) return;
+  if (!filter_has_name(fs->filter, fs->prev.name) && !filter_overlaps(fs->filter, fs->prev.byte, end)) return;
+  if (fs->n_ranges > 0 && fs->ranges[fs->n_ranges-1].end_byte == fs->prev.byte) {
+    fs->ranges[fs->n_ranges-1].end_byte = end;
+    fs->ranges[fs->n_ranges-1].end_point = end_point;
+    return;
+  }
+  if (fs->n_ranges + 1 > fs->cap_ranges) { fs->cap_ranges = (fs->cap_ranges==0)?8:fs->cap_ranges*2; fs->ranges = realloc(fs->ranges, sizeof(TSRange)*fs->cap_ranges); }
+  TSRange *rg = &fs->ranges[fs->n_ranges++];
+  rg->start_byte = fs->prev.byte;
+  rg->start_point = fs->prev.point;
+  rg->end_byte = end;
+  rg->end_point = end_point;
+}
+
+static int filter_function(void *ctx, const ChunkFunc *f) {
+  FilterScan *fs = ctx;
+  filter_decide(fs, f->byte, f->point);
+  fs->prev = *f;
+  fs->have_prev = 1;
+  callgraph_intern(fs->defs, f->name, strlen(f->name));
+  // keep going past the last --range: a selected function may call one
+  // defined further down, and that call needs its name in defs
+  return 0;
+}
+
+// Parse only the functions the filter selects: the pre-scan finds their
+// text, and the parser is restricted to it with included ranges. defs gets
+// every function name of the file. Returns the number of trees (0 if nothing
+// matched), -1 on failure.
+static int parse_filtered(TSParser *parser, SourceReader *rd, const FuncFilter *filter, CallGraph *defs, TSTree ***out) {
+  FilterScan fs;
+  memset(&fs, 0, sizeof(fs));
+  fs.filter = filter;
+  fs.defs = defs;
+  if (chunk_scan(rd, filter_function, &fs) != 0) { free(fs.ranges); return -1; }
+  filter_decide(&fs, UINT32_MAX, (TSPoint){ UINT32_MAX, UINT32_MAX });
+  *out = NULL;
+  if (fs.n_ranges == 0) return 0;
+  TSTree *tree = NULL;
+  if (ts_parser_set_included_ranges(parser, fs.ranges, (uint32_t)fs.n_ranges)) {
+    tree = ts_parser_parse(parser, NULL, source_reader_input(rd));
+    // back to the whole input for the next file
+    ts_parser_set_included_ranges(parser, NULL, 0);
+  }
+  free(fs.ranges);
+  if (tree && rd->error) { ts_tree_delete(tree); tree = NULL; }
+  if (!tree) return -1;
+  *out = malloc(sizeof(TSTree*));
+  (*out)[0] = tree;
+  return 1;
+}
+
+// Parse rd into one tree, or with --parse-jobs into one tree per chunk
+// (chunk_parse.h) when the input is large enough and the chunks parse
+// cleanly. Returns the number of trees, -1 if the input could not be parsed.
+static int parse_input(TSParser *parser, SourceReader *rd, const RunOptions *opt, TSTree ***out) {
+  int max_chunks = opt->parse_jobs;
+  if ((uint32_t)max_chunks > rd->size / CHUNK_PARSE_MIN) max_chunks = (int)(rd->size / CHUNK_PARSE_MIN);
+  if (max_chunks > 1) {
+    TSRange *ranges = malloc(sizeof(TSRange) * max_chunks);
+    int n = chunk_find_ranges(rd, max_chunks, ranges);
+    TSTree **trees = malloc(sizeof(TSTree*) * n);
+    int ok = n > 1 && !rd->error && chunk_parse(rd, tree_sitter_v2lang_test(), ranges, n, trees) == 0;
+    free(ranges);
+    if (ok) { *out = trees; return n; }
+    free(trees);
+  }
+  TSTree *tree = ts_parser_parse(parser, NULL, source_reader_input(rd));
+  if (tree && rd->error) { ts_tree_delete(tree); tree = NULL; }
+  if (!tree) return -1;
+  *out = malloc(sizeof(TSTree*));
+  (*out)[0] = tree;
+  return 1;
+}
+
+// funcDef node, its signature and name (null if missing) and its name id in
+// the file's call graph
+// A funcDef of the input: its node in the parse tree, or its index in a
+// --flat snapshot, and the byte ranges the outputs read.
+typedef struct FuncRecord {
+  TSNode node;
+  uint32_t flat;                  /* FLAT_NONE when parsed */
+  uint32_t start, end;
+  uint32_t sig_start, sig_end;    /* empty: no signature */
+  uint32_t name_start, name_end;  /* empty: no name */
+  int name;
+} FuncRecord;
+
+// Find the funcDef nodes of the input, given as one tree or as the trees of
+// its chunks in source order, with the QP_FUNCTION pattern of lab2_query.
+// The cursor does not start matches below QUERY_FUNCTION_DEPTH, so function
+// bodies are skipped. Returns the count, the array in *out.
+static int collect_functions(TSTree *const *trees, int n_trees, FuncRecord **out) {
+  FuncRecord *funcs = NULL; int func_cap = 0; int func_n = 0;
+  TSQueryCursor *qc = ts_query_cursor_new();
+  ts_query_cursor_set_max_start_depth(qc, QUERY_FUNCTION_DEPTH);
+  for (int t=0; t<n_trees; t++) {
+    ts_query_cursor_exec(qc, lab2_query, ts_tree_root_node(trees[t]));
+    TSQueryMatch m;
+    while (ts_query_cursor_next_match(qc, &m)) {
+      if (m.pattern_index != QP_FUNCTION) continue;
+      if (func_n + 1 > func_cap) { func_cap = (func_cap==0)?8:func_cap*2; funcs = realloc(funcs, sizeof(FuncRecord)*func_cap); }
+      FuncRecord *f = &funcs[func_n++];
+      memset(f, 0, sizeof(*f));
+      f->flat = FLAT_NONE;
+      f->name = -1;
+      for (int c=0; c<m.capture_count; c++) {
+        TSNode n = m.captures[c].node;
+        switch (query_capture(m.captures[c].index)) {
+          case QC_FUNCTION: f->node = n; f->start = ts_node_start_byte(n); f->end = ts_node_end_byte(n); break;
+          case QC_SIGNATURE: f->sig_start = ts_node_start_byte(n); f->sig_end = ts_node_end_byte(n); break;
+          case QC_NAME: f->name_start = ts_node_start_byte(n); f->name_end = ts_node_end_byte(n); break;
+          default: break;
         }
       }
     }
   }
-  // fallback: empty
-  out[0] = '\0';
+  ts_query_cursor_delete(qc);
+  // the old explicit stack popped the last child first, so functions were
+  // numbered from the end of the file; keep that order for the outputs
+  for (int lo=0, hi=func_n-1; lo<hi; lo++, hi--) {
+    FuncRecord tmp = funcs[lo]; funcs[lo] = funcs[hi]; funcs[hi] = tmp;
+  }
+  *out = funcs;
+  return func_n;
 }
 
-static void get_func_signature_text(const char *source, TSNode func_node, char *out, size_t out_len) {
-  out[0] = '\0';
-  uint32_t child_count = ts_node_child_count(func_node);
-  for (uint32_t i=0;i<child_count;i++){
-    TSNode c = ts_node_child(func_node, i);
-    if (strcmp(ts_node_type(c), "funcSignature") == 0) {
-      print_node_text(source, c, out, out_len);
-      return;
+typedef struct FlatFuncs { FuncRecord *v; int n, cap; } FlatFuncs;
+
+static void collect_flat_at(const FlatAst *a, uint32_t i, int depth, FlatFuncs *fs) {
+  if (flat_kind(a, i) == NK_FUNC_DEF) {
+    if (fs->n + 1 > fs->cap) { fs->cap = (fs->cap==0)?8:fs->cap*2; fs->v = realloc(fs->v, sizeof(FuncRecord)*fs->cap); }
+    FuncRecord *f = &fs->v[fs->n++];
+    memset(f, 0, sizeof(*f));
+    f->flat = i;
+    f->name = -1;
+    f->start = a->nodes[i].start_byte; f->end = a->nodes[i].end_byte;
+    uint32_t sig = flat_field(a, i, NF_SIGNATURE);
+    if (sig != FLAT_NONE && flat_kind(a, sig) == NK_FUNC_SIGNATURE) {
+      f->sig_start = a->nodes[sig].start_byte; f->sig_end = a->nodes[sig].end_byte;
+      uint32_t name = flat_field(a, sig, NF_NAME);
+      if (name != FLAT_NONE && flat_kind(a, name) == NK_IDENTIFIER) {
+        f->name_start = a->nodes[name].start_byte; f->name_end = a->nodes[name].end_byte;
+      }
     }
+    return;
   }
+  if (depth == QUERY_FUNCTION_DEPTH) return;
+  for (uint32_t c = flat_first_child(a, i); c != FLAT_NONE; c = flat_next_sibling(a, i, c))
+    collect_flat_at(a, c, depth + 1, fs);
 }
 
-typedef struct Pair {
-  char *caller;
-  char *callee;
-  int count;
-} Pair;
+// collect_functions() over a flat snapshot of the whole input: the same
+// funcDef nodes (down to QUERY_FUNCTION_DEPTH, not inside bodies) in the
+// same order
+static int collect_flat_functions(const FlatAst *a, FuncRecord **out) {
+  FlatFuncs fs = { NULL, 0, 0 };
+  if (a->n > 0) collect_flat_at(a, 0, 0, &fs);
+  for (int lo=0, hi=fs.n-1; lo<hi; lo++, hi--) {
+    FuncRecord tmp = fs.v[lo]; fs.v[lo] = fs.v[hi]; fs.v[hi] = tmp;
+  }
+  *out = fs.v;
+  return fs.n;
+}
 
-static int name_in_list(char **list, int count, const char *name) {
-  for (int i=0;i<count;i++) if (strcmp(list[i], name) == 0) return 1;
-  return 0;
+// CFG of function fi, from the cache or built (and then stored) from its
+// tree node or, with flat set, its node in the snapshot. The CFG's text
+// slices point into fn.
+static FrozenCFG *function_cfg(Arena *arena, const SourceText *fn, const FlatAst *flat, const FuncRecord *f, int fi, const char *prefix, const RunOptions *opt, unsigned long *hits, unsigned long *misses) {
+  FrozenCFG *cfg = NULL;
+  if (opt->cache) {
+    cfg = cfg_cache_load(opt->cache, arena, fn);
+    if (cfg) (*hits)++;
+    else (*misses)++;
+  }
+  if (!cfg) {
+    CFG *built = NULL; char out_fname[256]; out_fname[0]='\0';
+    char fnprefix[360]; snprintf(fnprefix, sizeof(fnprefix), "%s_f%d", prefix, fi);
+    if (flat) build_cfg_flat(arena, fn, flat, f->flat, &built, out_fname, sizeof(out_fname));
+    else build_cfg_for_function(arena, fn, f->node, &built, out_fname, sizeof(out_fname), fnprefix);
+    cfg = cfg_freeze(built);
+    if (opt->cache) cfg_cache_store(opt->cache, fn, cfg);
+  }
+  return cfg;
+}
+
+// Where the functions of one file go, in function order.
+typedef struct FileEmit {
+  FileResult *r;
+  const RunOptions *opt;
+  const char *path;
+  const char *prefix;
+  FILE *of;      /* per-file DOT, or NULL */
+  CallGraph *cg;
+  const CallGraph *defs;  /* with a filter: every function name of the file */
+} FileEmit;
+
+// fn is only read for --emit-bin and --format ndjson and may be NULL otherwise
+static void emit_function(FileEmit *e, int fi, const FuncRecord *f, const SourceText *fn, const FrozenCFG *cfg) {
+  const char *name = e->cg->names[f->name];
+  if (e->r->bin) cfgbin_part_add_function(e->r->bin, name, cfg, fn);
+  if (e->opt->ndjson) {
+    char sig_buf[512];
+    sig_buf[0] = '\0';
+    if (f->sig_end > f->sig_start) print_text(fn, f->sig_start, f->sig_end, sig_buf, sizeof(sig_buf));
+    ndjson_write_function(e->opt->ndjson, e->path, name, (sig_buf[0] != '\0') ? sig_buf : name,
+                          f->start, f->end, cfg);
+  }
+  if (e->of) write_function_dot(e->of, e->prefix, fi, name, cfg);
+  add_function_calls(e->cg, f->name, cfg, e->opt->global_calls, e->defs);
 }
 
-static void scan_line_for_calls(const char *line, void (*cb)(const char*, void*), void *userdata) {
-  if (!line || !cb) return;
-  const char *p = line;
-  while ((p = strstr(p, "Call(")) != NULL) {
-    p += 5;
-    while (*p && isspace((unsigned char)*p)) p++;
-    const char *start = p;
-    while (*p && (isalnum((unsigned char)*p) || *p == '_')) p++;
-    size_t len = (size_t)(p - start);
-    if (len > 0) {
-      char buf[128];
-      if (len >= sizeof(buf)) len = sizeof(buf) - 1;
-      memcpy(buf, start, len);
-      buf[len] = '\0';
-      cb(buf, userdata);
+// --function-jobs N: the CFGs of one file are built by N threads while the
+// file's thread emits them in function order, so the output does not change.
+// Functions are released in batches of FUNC_BATCH per thread and scheduled
+// with work stealing within a batch. Each thread builds into one of two
+// arenas by batch parity, so batch k+1 is built while batch k is emitted, and
+// an arena is reset only once the batch before last has been emitted.
+#define FUNC_BATCH 64
+// below this many functions a file is built on its own thread
+#define FUNC_PARALLEL_MIN 64
+
+typedef struct FuncBuild {
+  pthread_mutex_t mu;
+  pthread_cond_t cv;
+  WorkSteal ws;
+  const SourceReader *rd;
+  const RunOptions *opt;
+  const char *prefix;
+  int n_trees;
+  int n;
+  int batch;       /* functions per batch */
+  int n_batches;
+  FrozenCFG **cfg; /* per function, valid once done[i] is set */
+  char *done;
+  int *built;      /* finished functions per batch */
+  int released;    /* batches handed to ws */
+  int consumed;    /* functions emitted */
+} FuncBuild;
+
+typedef struct FuncWorker {
+  FuncBuild *b;
+  int id;
+  TSTree **trees;  /* own copies: trees are not shared between threads */
+  /* batch k's CFGs live in arenas[k % 2]; freed after the join, since the
+     file thread may still be emitting them when the worker runs out of work */
+  Arena arenas[2];
+  unsigned long cache_hits;
+  unsigned long cache_misses;
+} FuncWorker;
+
+static int batch_size(const FuncBuild *b, int k) {
+  int hi = (k + 1) * b->batch;
+  return ((hi < b->n) ? hi : b->n) - k * b->batch;
+}
+
+// Release batch k once batch k-1 is built and batch k-2, whose arenas it
+// reuses, has been emitted. mu must be held.
+static void release_batches_locked(FuncBuild *b) {
+  while (b->released < b->n_batches) {
+    int k = b->released;
+    if (k > 0 && b->built[k-1] < batch_size(b, k-1)) break;
+    if (k > 1 && b->consumed < (k-1) * b->batch) break;
+    b->released++;
+    worksteal_push(&b->ws, k * b->batch, k * b->batch + batch_size(b, k));
+    if (b->released == b->n_batches) worksteal_close(&b->ws);
+  }
+}
+
+static void *func_worker(void *arg) {
+  FuncWorker *w = arg;
+  FuncBuild *b = w->b;
+  // the same funcDef nodes, found in this thread's copy of the tree
+  FuncRecord *funcs = NULL;
+  int n = collect_functions(w->trees, b->n_trees, &funcs);
+  SourceReader rd;
+  int have_rd = source_reader_clone(b->rd, &rd) == 0;
+  int arena_batch[2] = { -1, -1 };
+  int idx;
+  while ((idx = worksteal_next(&b->ws, w->id)) >= 0) {
+    int k = idx / b->batch;
+    Arena *a = &w->arenas[k % 2];
+    if (arena_batch[k % 2] != k) { arena_reset(a); arena_batch[k % 2] = k; }
+    FrozenCFG *cfg = NULL;
+    SourceText fn;
+    if (have_rd && idx < n &&
+        source_reader_text(&rd, funcs[idx].start, funcs[idx].end, &fn) == 0) {
+      // the CFG outlives the reader's window, so build it over a copy
+      SourceText own = { arena_strndup(a, fn.data, fn.len), fn.base, fn.len };
+      cfg = function_cfg(a, &own, NULL, &funcs[idx], idx, b->prefix, b->opt, &w->cache_hits, &w->cache_misses);
     }
+    pthread_mutex_lock(&b->mu);
+    b->cfg[idx] = cfg;
+    b->done[idx] = 1;
+    b->built[k]++;
+    release_batches_locked(b);
+    pthread_cond_broadcast(&b->cv);
+    pthread_mutex_unlock(&b->mu);
   }
+  if (have_rd) source_reader_close(&rd);
+  free(funcs);
+  return NULL;
 }
 
-static int find_call_edge(Pair *pairs, int pair_n, const char *caller, const char *callee) {
-  for (int i=0;i<pair_n;i++) {
-    if (strcmp(pairs[i].caller, caller)==0 && strcmp(pairs[i].callee, callee)==0) return i;
+// 0 on success; -1 if no thread could be started and nothing was emitted
+static int build_functions_parallel(FileEmit *e, TSTree *const *trees, int n_trees, SourceReader *rd, const FuncRecord *funcs, int func_n) {
+  int workers = e->opt->func_jobs;
+  FuncBuild b;
+  memset(&b, 0, sizeof(b));
+  pthread_mutex_init(&b.mu, NULL);
+  pthread_cond_init(&b.cv, NULL);
+  worksteal_init(&b.ws, workers);
+  b.rd = rd;
+  b.opt = e->opt;
+  b.prefix = e->prefix;
+  b.n_trees = n_trees;
+  b.n = func_n;
+  b.batch = FUNC_BATCH * workers;
+  b.n_batches = (func_n + b.batch - 1) / b.batch;
+  b.cfg = calloc((size_t)func_n, sizeof(FrozenCFG*));
+  b.done = calloc((size_t)func_n, 1);
+  b.built = calloc((size_t)b.n_batches, sizeof(int));
+
+  FuncWorker *w = calloc((size_t)workers, sizeof(FuncWorker));
+  pthread_t *threads = malloc(sizeof(pthread_t) * workers);
+  int started = 0;
+  for (int t=0;t<workers;t++) {
+    w[started].b = &b;
+    w[started].id = started;
+    w[started].trees = malloc(sizeof(TSTree*) * n_trees);
+    for (int k=0;k<n_trees;k++) w[started].trees[k] = ts_tree_copy(trees[k]);
+    arena_init(&w[started].arenas[0]); arena_init(&w[started].arenas[1]);
+    if (pthread_create(&threads[started], NULL, func_worker, &w[started]) == 0) started++;
+    else {
+      delete_trees(w[started].trees, n_trees);
+      arena_free(&w[started].arenas[0]);
+      arena_free(&w[started].arenas[1]);
+    }
+  }
+  // ranges of workers that did not start are stolen by the others
+  pthread_mutex_lock(&b.mu);
+  if (started > 0) release_batches_locked(&b);
+  else worksteal_close(&b.ws);
+  pthread_mutex_unlock(&b.mu);
+
+  for (int fi=0; started>0 && fi<func_n; fi++) {
+    pthread_mutex_lock(&b.mu);
+    while (!b.done[fi]) pthread_cond_wait(&b.cv, &b.mu);
+    FrozenCFG *cfg = b.cfg[fi];
+    pthread_mutex_unlock(&b.mu);
+    if (cfg) {
+      SourceText fn;
+      int need_text = e->r->bin || e->opt->ndjson;
+      if (need_text && source_reader_text(rd, funcs[fi].start, funcs[fi].end, &fn) != 0)
+        fprintf(e->r->diag_f, "Cannot read %s: %s\n", e->path, strerror(rd->error ? rd->error : EIO));
+      else emit_function(e, fi, &funcs[fi], need_text ? &fn : NULL, cfg);
+    }
+    pthread_mutex_lock(&b.mu);
+    b.consumed = fi + 1;
+    release_batches_locked(&b);
+    pthread_mutex_unlock(&b.mu);
+  }
+
+  for (int t=0;t<started;t++) {
+    pthread_join(threads[t], NULL);
+    delete_trees(w[t].trees, n_trees);
+    arena_free(&w[t].arenas[0]);
+    arena_free(&w[t].arenas[1]);
+    e->r->cache_hits += w[t].cache_hits;
+    e->r->cache_misses += w[t].cache_misses;
+  }
+  free(threads);
+  free(w);
+  free(b.cfg);
+  free(b.done);
+  free(b.built);
+  worksteal_destroy(&b.ws);
+  pthread_cond_destroy(&b.cv);
+  pthread_mutex_destroy(&b.mu);
+  return (started > 0) ? 0 : -1;
+}
+
+// Render the functions of one input into r: DOT subgraphs (or records) in
+// function order, then the call graph. trees are the parse of the input and
+// allow --function-jobs; with flat (--flat) they are NULL and each function
+// is built from its node in the snapshot. defs: see FileEmit.
+static void emit_file(Arena *arena, const char *path, SourceReader *rd, FuncRecord *funcs, int func_n,
+                      TSTree *const *trees, int n_trees, const FlatAst *flat, const CallGraph *defs,
+                      const RunOptions *opt, FileResult *r) {
+  const char *outdir = opt->outdir;
+  int global_calls = opt->global_calls;
+  FILE *err = r->diag_f;
+  r->path = path;
+  if (opt->bin) { r->bin = malloc(sizeof(CfgBinPart)); cfgbin_part_init(r->bin); }
+
+  // function names are interned up front so call sites can be resolved by
+  // hash lookup
+  CallGraph cg;
+  callgraph_init(&cg);
+  for (int fi=0; fi<func_n; fi++) {
+    char name_buf[256];
+    name_buf[0] = '\0';
+    // only the name itself is read
+    const FuncRecord *f = &funcs[fi];
+    SourceText st;
+    if (f->name_end > f->name_start && source_reader_text(rd, f->name_start, f->name_end, &st) == 0)
+      print_text(&st, f->name_start, f->name_end, name_buf, sizeof(name_buf));
+    if (name_buf[0]=='\0') snprintf(name_buf, sizeof(name_buf), "<anon>");
+    funcs[fi].name = callgraph_intern(&cg, name_buf, strlen(name_buf));
   }
-  return -1;
+  int n_defs = cg.n_names;
+
+  // prepare per-file prefix (used to produce stable expr IDs and node prefixes)
+  char *pathdup = strdup(path);
+  char *base = basename(pathdup);
+  char prefix[320]; file_prefix(base, prefix, sizeof(prefix));
+
+  // prepare per-file DOT
+  FILE *of = NULL;
+  if (!opt->ndjson) {
+    char outfile[1024]; snprintf(outfile, sizeof(outfile), "%s/%s.dot", outdir, base);
+    of = opt->stream ? artifact_stream(r, outfile) : artifact_begin(r, outfile);
+    if (!of) fprintf(err, "Cannot write %s\n", outfile);
+    else fprintf(of, "digraph G {\n");
+  }
+
+  FileEmit emit = { r, opt, path, prefix, of, &cg, defs };
+  int parallel = trees && opt->func_jobs > 1 && func_n >= FUNC_PARALLEL_MIN &&
+                 build_functions_parallel(&emit, trees, n_trees, rd, funcs, func_n) == 0;
+  for (int fi=0; !parallel && fi<func_n; fi++) {
+    ArenaMark mark = arena_mark(arena);
+    // build CFG, or load it from the cache when the function text is known
+    SourceText fn;
+    if (source_reader_text(rd, funcs[fi].start, funcs[fi].end, &fn) != 0) {
+      fprintf(err, "Cannot read %s: %s\n", path, strerror(rd->error ? rd->error : EIO));
+      arena_rewind(arena, mark);
+      continue;
+    }
+    FrozenCFG *cfg = function_cfg(arena, &fn, flat, &funcs[fi], fi, prefix, opt, &r->cache_hits, &r->cache_misses);
+    if (cfg) emit_function(&emit, fi, &funcs[fi], &fn, cfg);
+    arena_rewind(arena, mark);
+  }
+  if (of) { fprintf(of, "}\n"); fclose(of); }
+
+  if (!global_calls && opt->ndjson) {
+    for (int p=0;p<cg.n_edges;p++) {
+      const CallEdge *e = &cg.edges[p];
+      ndjson_write_call(opt->ndjson, path, cg.names[e->caller], cg.names[e->callee], e->count);
+    }
+  } else if (!global_calls) {
+    char callgraph_dot[1024];
+    char callgraph_csv[1024];
+    snprintf(callgraph_dot, sizeof(callgraph_dot), "%s/%s.callgraph.dot", outdir, base);
+    snprintf(callgraph_csv, sizeof(callgraph_csv), "%s/%s.callgraph.csv", outdir, base);
+    FILE *cf = artifact_begin(r, callgraph_dot);
+    if (cf) {
+      write_callgraph_dot(cf, &cg, NULL, 0, NULL);
+      fclose(cf);
+      FILE *csv = artifact_begin(r, callgraph_csv);
+      if (csv) { write_callgraph_csv(csv, &cg, NULL); fclose(csv); }
+      else fprintf(err, "Cannot write %s\n", callgraph_csv);
+    } else fprintf(err, "Cannot write callgraph %s\n", callgraph_dot);
+  }
+  if (global_calls || r->bin) {
+    r->calls = malloc(sizeof(CallGraph));
+    *r->calls = cg;
+    r->n_call_defs = n_defs;
+  } else {
+    callgraph_free(&cg);
+  }
+
+  arena_reset(arena);
+  free(pathdup);
 }
 
-static void add_call_edge(Pair **pairs, int *pair_n, int *pair_cap, const char *caller, const char *callee) {
-  int idx = find_call_edge(*pairs, *pair_n, caller, callee);
-  if (idx >= 0) {
-    (*pairs)[idx].count++;
+// Parse one input and render its CFG DOT and call graph into r. Functions are
+// built, written and released one at a time (arena_mark/arena_rewind): what
+// outlives a function is its name and call-graph edges, so memory does not
+// grow with the number of functions in the file. With --stream the DOT goes
+// straight to disk instead of being buffered for the commit.
+//
+// With global_calls the call graph is not written but handed over in r->calls
+// for merging; with --emit-bin it is handed over as well, next to the records
+// in r->bin. With --format ndjson each function's record is written instead
+// of its DOT subgraph. With --function-jobs a large file's CFGs are built in
+// parallel (build_functions_parallel) and emitted in the same order.
+static void process_file(TSParser *parser, Arena *arena, const char *path, const RunOptions *opt, FileResult *r) {
+  FILE *err = r->diag_f;
+  // the parser pulls the file through a bounded window; function text is
+  // fetched again per function by emit_file
+  SourceReader rd;
+  if (source_reader_open(&rd, path) != 0) {
+    if (errno == EFBIG) fprintf(err, "Cannot parse %s: larger than 4 GiB\n", path);
+    else fprintf(err, "Cannot read %s\n", path);
     return;
   }
-  if (*pair_n + 1 > *pair_cap) {
-    *pair_cap = (*pair_cap==0)?16:(*pair_cap*2);
-    *pairs = realloc(*pairs, sizeof(Pair) * (*pair_cap));
+
+  // with a filter only the selected functions are parsed
+  CallGraph defs;
+  if (opt->filter) callgraph_init(&defs);
+  TSTree **trees = NULL;
+  int n_trees = opt->filter ? parse_filtered(parser, &rd, opt->filter, &defs, &trees)
+                            : parse_input(parser, &rd, opt, &trees);
+  if (n_trees < 0) {
+    if (rd.error) fprintf(err, "Cannot read %s: %s\n", path, strerror(rd.error));
+    else fprintf(err, "Parse failed for %s\n", path);
+    if (opt->filter) callgraph_free(&defs);
+    source_reader_close(&rd);
+    return;
+  }
+
+  FuncRecord *funcs = NULL;
+  int func_n = collect_functions(trees, n_trees, &funcs);
+  emit_file(arena, path, &rd, funcs, func_n, trees, n_trees, NULL, opt->filter ? &defs : NULL, opt, r);
+
+  // cleanup
+  free(funcs);
+  delete_trees(trees, n_trees);
+  if (opt->filter) callgraph_free(&defs);
+  source_reader_close(&rd);
+}
+
+// --flat: the same outputs from a snapshot saved by ast_dump --save-flat,
+// without parsing path. The snapshot must be of this grammar and of this
+// exact input (length and flat_ast_source_hash). -1 if it cannot be used.
+static int process_flat(Arena *arena, const char *path, const char *flat_path, const RunOptions *opt, FileResult *r) {
+  FILE *err = r->diag_f;
+  SourceReader rd;
+  if (source_reader_open(&rd, path) != 0) {
+    if (errno == EFBIG) fprintf(err, "Cannot parse %s: larger than 4 GiB\n", path);
+    else fprintf(err, "Cannot read %s\n", path);
+    return -1;
+  }
+  FlatAst ast = {0};
+  if (flat_ast_open(&ast, flat_path, tree_sitter_v2lang_test()) != 0) {
+    if (errno) fprintf(err, "Cannot read %s: %s\n", flat_path, strerror(errno));
+    else fprintf(err, "Cannot use %s: not a flat AST of this grammar\n", flat_path);
+    source_reader_close(&rd);
+    return -1;
+  }
+  int rc = -1;
+  uint64_t hash = 0;
+  if (flat_ast_source_hash(&rd, &hash) != 0) {
+    fprintf(err, "Cannot read %s: %s\n", path, strerror(rd.error ? rd.error : EIO));
+  } else if (ast.source_len != rd.size || ast.source_hash != hash) {
+    fprintf(err, "Cannot use %s: made from another version of %s\n", flat_path, path);
+  } else {
+    FuncRecord *funcs = NULL;
+    int func_n = collect_flat_functions(&ast, &funcs);
+    emit_file(arena, path, &rd, funcs, func_n, NULL, 0, &ast, NULL, opt, r);
+    free(funcs);
+    rc = 0;
+  }
+  flat_ast_free(&ast);
+  source_reader_close(&rd);
+  return rc;
+}
+
+static TSParser *new_v2lang_parser(void) {
+  TSParser *parser = ts_parser_new();
+  if (!ts_parser_set_language(parser, tree_sitter_v2lang_test())) {
+    ts_parser_delete(parser);
+    return NULL;
+  }
+  return parser;
+}
+
+// --jobs N: a pool of workers, each with its own TSParser, processes whole
+// files. Workers may run at most `window` files ahead of the in-order commit
+// so buffered results stay bounded.
+typedef struct JobPool {
+  pthread_mutex_t mu;
+  pthread_cond_t cv;
+  char **files;
+  int file_count;
+  const RunOptions *opt;
+  FileResult *results;
+  char *done;
+  int next;
+  int committed;
+  int window;
+} JobPool;
+
+static void *job_worker(void *arg) {
+  JobPool *pool = arg;
+  TSParser *parser = new_v2lang_parser();
+  Arena arena; arena_init(&arena);
+  for (;;) {
+    pthread_mutex_lock(&pool->mu);
+    while (pool->next < pool->file_count && pool->next >= pool->committed + pool->window)
+      pthread_cond_wait(&pool->cv, &pool->mu);
+    if (pool->next >= pool->file_count) { pthread_mutex_unlock(&pool->mu); break; }
+    int idx = pool->next++;
+    pthread_mutex_unlock(&pool->mu);
+
+    FileResult *r = &pool->results[idx];
+    file_result_init(r);
+    if (parser) process_file(parser, &arena, pool->files[idx], pool->opt, r);
+    else fprintf(r->diag_f, "Failed to set language\n");
+
+    pthread_mutex_lock(&pool->mu);
+    pool->done[idx] = 1;
+    pthread_cond_broadcast(&pool->cv);
+    pthread_mutex_unlock(&pool->mu);
+  }
+  if (parser) ts_parser_delete(parser);
+  arena_free(&arena);
+  return NULL;
+}
+
+static void run_jobs(char **files, int file_count, const RunOptions *opt, int jobs, GlobalCallGraph *gg) {
+  JobPool pool;
+  memset(&pool, 0, sizeof(pool));
+  pthread_mutex_init(&pool.mu, NULL);
+  pthread_cond_init(&pool.cv, NULL);
+  pool.files = files;
+  pool.file_count = file_count;
+  pool.opt = opt;
+  pool.results = calloc((size_t)file_count, sizeof(FileResult));
+  pool.done = calloc((size_t)file_count, 1);
+  pool.window = jobs * 2;
+
+  pthread_t *threads = malloc(sizeof(pthread_t) * jobs);
+  int started = 0;
+  for (int t=0;t<jobs;t++) {
+    if (pthread_create(&threads[started], NULL, job_worker, &pool) == 0) started++;
   }
-  (*pairs)[*pair_n].caller = strdup(caller);
-  (*pairs)[*pair_n].callee = strdup(callee);
-  (*pairs)[*pair_n].count = 1;
-  (*pair_n)++;
+  if (started == 0) {
+    // no threads available: fall back to the caller's thread
+    pool.window = file_count;
+    job_worker(&pool);
+  }
+
+  for (int i=0;i<file_count;i++) {
+    pthread_mutex_lock(&pool.mu);
+    while (!pool.done[i]) pthread_cond_wait(&pool.cv, &pool.mu);
+    pthread_mutex_unlock(&pool.mu);
+    commit_file_result(&pool.results[i], opt, gg);
+    pthread_mutex_lock(&pool.mu);
+    pool.committed++;
+    pthread_cond_broadcast(&pool.cv);
+    pthread_mutex_unlock(&pool.mu);
+  }
+
+  for (int t=0;t<started;t++) pthread_join(threads[t], NULL);
+  free(threads);
+  free(pool.results);
+  free(pool.done);
+  pthread_cond_destroy(&pool.cv);
+  pthread_mutex_destroy(&pool.mu);
 }
 
-typedef struct CallCollectorCtx {
-  Pair **pairs;
-  int *pair_n;
-  int *pair_cap;
-  const char *caller;
-  char **known_names;
-  int known_count;
-} CallCollectorCtx;
+// --index-only: one symbol record per function from the pre-scan alone;
+// bodies are skipped and nothing is parsed
+typedef struct IndexFile {
+  FILE *out;
+  const char *path;
+  ChunkArg *args;
+  int cap_args;
+} IndexFile;
+
+static int index_function(void *ctx, const ChunkFunc *f) {
+  IndexFile *ix = ctx;
+  const char *ret = NULL;
+  uint32_t ret_len = 0;
+  int n = chunk_split_signature(f->sig, f->sig_len, ix->args, ix->cap_args, &ret, &ret_len);
+  if (n > ix->cap_args) {
+    ix->cap_args = n;
+    ix->args = realloc(ix->args, sizeof(ChunkArg) * (size_t)ix->cap_args);
+    n = chunk_split_signature(f->sig, f->sig_len, ix->args, ix->cap_args, &ret, &ret_len);
+  }
+  ndjson_write_symbol(ix->out, ix->path, f, ix->args, n, ret, ret_len);
+  return 0;
+}
 
-static void collect_call_if_known(const char *callee, void *userdata) {
-  CallCollectorCtx *ctx = userdata;
-  if (!name_in_list(ctx->known_names, ctx->known_count, callee)) return;
-  add_call_edge(ctx->pairs, ctx->pair_n, ctx->pair_cap, ctx->caller, callee);
+static void index_files(char **files, int file_count, FILE *out) {
+  IndexFile ix = { out, NULL, NULL, 0 };
+  for (int i=0;i<file_count;i++) {
+    SourceReader rd;
+    if (source_reader_open(&rd, files[i]) != 0) {
+      if (errno == EFBIG) fprintf(stderr, "Cannot index %s: larger than 4 GiB\n", files[i]);
+      else fprintf(stderr, "Cannot read %s\n", files[i]);
+      continue;
+    }
+    ix.path = files[i];
+    if (chunk_index(&rd, index_function, &ix) != 0) fprintf(stderr, "Cannot read %s: %s\n", files[i], strerror(rd.error));
+    source_reader_close(&rd);
+  }
+  free(ix.args);
+}
+
+// --read-bin FILE: write the per-file DOT of every input recorded in an
+// --emit-bin artifact, from its records alone. Clusters are numbered in
+// record order, which is function order unless a filter left functions out.
+static int read_bin(const char *bin_path, const char *outdir, FILE *status) {
+  CfgBin b;
+  if (cfgbin_open(&b, bin_path) != 0) {
+    fprintf(stderr, "Cannot read %s: not a CFG artifact\n", bin_path);
+    return 1;
+  }
+  int bad = 0;
+  Arena arena; arena_init(&arena);
+  for (uint32_t i=0; i<b.n_files && !bad; i++) {
+    const CfgBinFile *file = &b.files[i];
+    uint32_t len;
+    const char *s = cfgbin_string(&b, file->path, &len);
+    char path[1024]; snprintf(path, sizeof(path), "%.*s", (int)len, s);
+    char *base = basename(path);
+    char prefix[320]; file_prefix(base, prefix, sizeof(prefix));
+    char outfile[1024]; snprintf(outfile, sizeof(outfile), "%s/%s.dot", outdir, base);
+    FILE *of = fopen(outfile, "w");
+    if (!of) { fprintf(stderr, "Cannot write %s\n", outfile); bad = 1; break; }
+    fprintf(of, "digraph G {\n");
+    for (uint32_t k=0; k<file->n_funcs; k++) {
+      CfgBinFuncView v = cfgbin_function(&b, file->first_func + k);
+      FrozenCFG *cfg = cfgbin_thaw_function(&arena, &v, v.text, v.f->start_byte);
+      if (!cfg) { fprintf(stderr, "%s: bad records for function %u of %s\n", bin_path, k, base); bad = 1; break; }
+      s = cfgbin_string(&b, v.f->name, &len);
+      char name[256]; snprintf(name, sizeof(name), "%.*s", (int)len, s);
+      write_function_dot(of, prefix, (int)k, name, cfg);
+      arena_reset(&arena);
+    }
+    fprintf(of, "}\n");
+    if (fclose(of) != 0) bad = 1;
+    if (!bad) fprintf(status, "Wrote %s\n", outfile);
+  }
+  arena_free(&arena);
+  cfgbin_close(&b);
+  return bad;
 }
 
 int main(int argc, char **argv) {
   if (argc < 2) {
-    fprintf(stderr, "Usage: %s <input1.v2> [input2.v2 ...] [--outdir DIR]\n", argv[0]);
+    fprintf(stderr, "Usage: %s <input1.v2> [input2.v2 ...] [--outdir DIR] [--jobs N] [--global-callgraph] [--cache-dir DIR] [--emit-bin FILE] [--format dot|ndjson] [--output FILE] [--stream] [--function-jobs N] [--parse-jobs N] [--function NAME] [--range START:END] [--index-only] [--read-bin FILE] [--flat FILE]\n", argv[0]);
     return 1;
   }
 
   const char *outdir = NULL;
+  int jobs = 1;
+  int global_calls = 0;
+  const char *cache_dir = NULL;
+  const char *bin_path = NULL;
+  const char *format = "dot";
+  const char *output = NULL;
+  int stream = 0;
+  int func_jobs = 1;
+  int parse_jobs = 1;
+  int index_only = 0;
+  const char *read_bin_path = NULL;
+  const char *flat_path = NULL;
+  FuncFilter filter;
+  memset(&filter, 0, sizeof(filter));
+  filter.names = malloc(sizeof(char*) * argc);
+  filter.range_start = malloc(sizeof(uint32_t) * argc);
+  filter.range_end = malloc(sizeof(uint32_t) * argc);
   // collect files
-  int first_files = 1;
   char **files = malloc(sizeof(char*) * (argc+1));
   int file_count = 0;
   for (int i=1;i<argc;i++){
     if (strcmp(argv[i], "--outdir") == 0 && i+1<argc) { outdir = argv[i+1]; i++; continue; }
+    if ((strcmp(argv[i], "--jobs") == 0 || strcmp(argv[i], "-j") == 0) && i+1<argc) {
+      jobs = atoi(argv[i+1]); i++;
+      // 0 means one worker per online CPU
+      if (jobs <= 0) { long ncpu = sysconf(_SC_NPROCESSORS_ONLN); jobs = (ncpu > 0) ? (int)ncpu : 1; }
+      continue;
+    }
+    if (strcmp(argv[i], "--global-callgraph") == 0) { global_calls = 1; continue; }
+    if (strcmp(argv[i], "--cache-dir") == 0 && i+1<argc) { cache_dir = argv[i+1]; i++; continue; }
+    if (strcmp(argv[i], "--emit-bin") == 0 && i+1<argc) { bin_path = argv[i+1]; i++; continue; }
+    if (strcmp(argv[i], "--format") == 0 && i+1<argc) { format = argv[i+1]; i++; continue; }
+    if (strcmp(argv[i], "--output") == 0 && i+1<argc) { output = argv[i+1]; i++; continue; }
+    if (strcmp(argv[i], "--stream") == 0) { stream = 1; continue; }
+    if (strcmp(argv[i], "--index-only") == 0) { index_only = 1; continue; }
+    if (strcmp(argv[i], "--read-bin") == 0 && i+1<argc) { read_bin_path = argv[i+1]; i++; continue; }
+    if (strcmp(argv[i], "--flat") == 0 && i+1<argc) { flat_path = argv[i+1]; i++; continue; }
+    if (strcmp(argv[i], "--function-jobs") == 0 && i+1<argc) {
+      func_jobs = atoi(argv[i+1]); i++;
+      if (func_jobs <= 0) { long ncpu = sysconf(_SC_NPROCESSORS_ONLN); func_jobs = (ncpu > 0) ? (int)ncpu : 1; }
+      continue;
+    }
+    if (strcmp(argv[i], "--function") == 0 && i+1<argc) { filter.names[filter.n_names++] = argv[i+1]; i++; continue; }
+    if (strcmp(argv[i], "--range") == 0 && i+1<argc) {
+      char *colon = NULL;
+      unsigned long start = strtoul(argv[i+1], &colon, 10), end = 0;
+      char *rest = NULL;
+      if (colon && *colon == ':') end = strtoul(colon + 1, &rest, 10);
+      if (!rest || *rest != '\0' || end <= start || end > UINT32_MAX) {
+        fprintf(stderr, "Bad range %s (expected START:END byte offsets, START < END)\n", argv[i+1]);
+        return 1;
+      }
+      filter.range_start[filter.n_ranges] = (uint32_t)start;
+      filter.range_end[filter.n_ranges++] = (uint32_t)end;
+      i++;
+      continue;
+    }
+    if (strcmp(argv[i], "--parse-jobs") == 0 && i+1<argc) {
+      parse_jobs = atoi(argv[i+1]); i++;
+      if (parse_jobs <= 0) { long ncpu = sysconf(_SC_NPROCESSORS_ONLN); parse_jobs = (ncpu > 0) ? (int)ncpu : 1; }
+      continue;
+    }
     files[file_count++] = argv[i];
   }
   if (!outdir) outdir = ".";
+  if (strcmp(format, "dot") != 0 && strcmp(format, "ndjson") != 0) {
+    fprintf(stderr, "Unknown format %s (expected dot or ndjson)\n", format);
+    return 1;
+  }
+  if (jobs > file_count) jobs = file_count;
+  // a snapshot is of one whole input
+  if (flat_path && (file_count != 1 || filter.n_names > 0 || filter.n_ranges > 0)) {
+    fprintf(stderr, "--flat takes exactly one input and no --function or --range\n");
+    free(filter.names);
+    free(filter.range_start);
+    free(filter.range_end);
+    free(files);
+    return 1;
+  }
 
-  // ensure outdir exists
-  struct stat st = {0};
-  if (stat(outdir, &st) == -1) mkdir(outdir, 0755);
+  // the index is always NDJSON and needs neither the parser nor outdir
+  if (index_only) {
+    FILE *out = output ? fopen(output, "w") : stdout;
+    if (!out) { fprintf(stderr, "Cannot write %s\n", output); return 1; }
+    index_files(files, file_count, out);
+    if (out != stdout) fclose(out);
+    free(filter.names);
+    free(filter.range_start);
+    free(filter.range_end);
+    free(files);
+    return 0;
+  }
 
-  // init parser
-  TSParser *parser = ts_parser_new();
-  if (!ts_parser_set_language(parser, tree_sitter_v2lang_test())) {
-    fprintf(stderr, "Failed to set language\n");
-    return 2;
+  // an artifact is read back without the parser
+  if (read_bin_path) {
+    struct stat st = {0};
+    if (stat(outdir, &st) == -1) mkdir(outdir, 0755);
+    int r = read_bin(read_bin_path, outdir, stdout);
+    free(filter.names);
+    free(filter.range_start);
+    free(filter.range_end);
+    free(files);
+    return r;
   }
 
-  for (int i=0;i<file_count;i++) {
-    const char *path = files[i];
-    size_t len = 0; char *source = read_file(path, &len);
-    if (!source) { fprintf(stderr, "Cannot read %s\n", path); continue; }
-
-    TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)len);
-    if (!tree) { fprintf(stderr, "Parse failed for %s\n", path); free(source); continue; }
-
-    TSNode root = ts_tree_root_node(tree);
-    // traverse to find funcDef nodes and collect them
-    TSNode *stack = malloc(sizeof(TSNode) * 16384);
-    int sp = 0;
-    stack[sp++] = root;
-
-    // dynamic arrays for functions
-    typedef struct FuncRecord { ProgramFunction meta; TSNode node; } FuncRecord;
-    FuncRecord *funcs = NULL; int func_cap = 0; int func_n = 0;
-
-    while (sp>0) {
-      TSNode node = stack[--sp];
-      const char *type = ts_node_type(node);
-      if (strcmp(type, "funcDef") == 0) {
-        if (func_n + 1 > func_cap) { func_cap = (func_cap==0)?8:func_cap*2; funcs = realloc(funcs, sizeof(FuncRecord)*func_cap); }
-        FuncRecord *fi = &funcs[func_n++];
-        char name_buf[256];
-        get_func_name(source, node, name_buf, sizeof(name_buf));
-        if (name_buf[0]=='\0') snprintf(name_buf, sizeof(name_buf), "<anon>");
-        char sig_buf[512];
-        get_func_signature_text(source, node, sig_buf, sizeof(sig_buf));
-        fi->meta.name = strdup(name_buf);
-        fi->meta.signature = (sig_buf[0] != '\0') ? strdup(sig_buf) : strdup(name_buf);
-        fi->meta.source_file = strdup(path);
-        fi->meta.cfg = NULL;
-        fi->node = node;
-      }
-      uint32_t cc = ts_node_child_count(node);
-      for (uint32_t k=0;k<cc;k++) {
-        stack[sp++] = ts_node_child(node,k);
-        if (sp >= 16384) { fprintf(stderr, "Node stack overflow\n"); break; }
-      }
-    }
+  // resolve grammar symbol ids once, before any worker starts
+  if (node_kinds_init(tree_sitter_v2lang_test()) != 0) return 1;
+  if (queries_init(tree_sitter_v2lang_test()) != 0) {
+    fprintf(stderr, "Failed to compile the function query; Lab1/src/parser.c does not match the grammar Lab2 was written for.\n");
+    return 1;
+  }
 
-    // build per-function CFGs and collect call relations
-    // simple arrays for call edges: caller index -> list of callee names
-    char **all_func_names = NULL; int all_fn_cap=0; int all_fn_n=0;
-
-    // prepare per-file prefix (used to produce stable expr IDs and node prefixes)
-    char *pathdup = strdup(path);
-    char *base = basename(pathdup);
-    char sbase[256]; size_t si = 0;
-    for (size_t ii=0; ii<strlen(base) && si+1<sizeof(sbase); ii++) {
-      char ch = base[ii];
-      if ((ch >= 'a' && ch <= 'z') || (ch >='A' && ch<='Z') || (ch>='0' && ch<='9')) sbase[si++] = ch;
-      else sbase[si++] = '_';
-    }
-    sbase[si] = '\0';
-    char prefix[320]; snprintf(prefix, sizeof(prefix), "file_%s", sbase);
-
-    for (int fi=0; fi<func_n; fi++) {
-      // unique function name list
-      char *name = funcs[fi].meta.name;
-      int found = 0;
-      for (int k=0;k<all_fn_n;k++) if (strcmp(all_func_names[k], name)==0) { found=1; break; }
-      if (!found) {
-        if (all_fn_n+1>all_fn_cap) { all_fn_cap = (all_fn_cap==0)?16:all_fn_cap*2; all_func_names = realloc(all_func_names, sizeof(char*)*all_fn_cap); }
-        all_func_names[all_fn_n++] = strdup(name);
-      }
-      // build CFG
-      CFG *cfg = NULL; char out_fname[256]; out_fname[0]='\0';
-      char fnprefix[360]; snprintf(fnprefix, sizeof(fnprefix), "%s_f%d", prefix, fi);
-      build_cfg_for_function(source, funcs[fi].node, &cfg, out_fname, sizeof(out_fname), fnprefix);
-      funcs[fi].meta.cfg = cfg;
-    }
+  // ensure outdir exists
+  struct stat st = {0};
+  if (stat(outdir, &st) == -1) mkdir(outdir, 0755);
 
+  CfgCache cache;
+  RunOptions opt = { outdir, global_calls, NULL, NULL, NULL, stream, func_jobs, parse_jobs, NULL };
+  if (filter.n_names > 0 || filter.n_ranges > 0) opt.filter = &filter;
+  // status lines must not end up in a record stream on stdout
+  FILE *status = stdout;
+  if (strcmp(format, "ndjson") == 0) {
+    opt.ndjson = output ? fopen(output, "w") : stdout;
+    if (!opt.ndjson) { fprintf(stderr, "Cannot write %s\n", output); return 1; }
+    if (!output) status = stderr;
+  }
+  if (cache_dir) {
+    if (cfg_cache_open(&cache, cache_dir, tree_sitter_v2lang_test()) == 0) opt.cache = &cache;
+    else fprintf(stderr, "Cannot use cache directory %s, building every CFG\n", cache_dir);
+  }
+  CfgBinWriter bin;
+  if (bin_path) {
+    if (cfgbin_writer_open(&bin) == 0) opt.bin = &bin;
+    else { fprintf(stderr, "Cannot write %s\n", bin_path); cfgbin_writer_finish(&bin, bin_path); }
+  }
 
+  GlobalCallGraph gg;
+  memset(&gg, 0, sizeof(gg));
+  if (global_calls) callgraph_init(&gg.g);
+  GlobalCallGraph *ggp = global_calls ? &gg : NULL;
+  int failed = 0;  /* --flat snapshot refused */
 
-    // prepare per-file DOT
-    char outfile[1024]; snprintf(outfile, sizeof(outfile), "%s/%s.dot", outdir, base);
-    FILE *of = fopen(outfile, "w");
-    if (!of) { fprintf(stderr, "Cannot write %s\n", outfile); }
-    else {
-      fprintf(of, "digraph G {\n");
-      // for each function, print subgraph with prefixed node names
-      for (int fi=0; fi<func_n; fi++) {
-        ProgramFunction *pf = &funcs[fi].meta;
-        CFG *cfg = pf->cfg;
-        if (!cfg) continue;
-        fprintf(of, "  subgraph cluster_f%d {\n", fi);
-        fprintf(of, "    label=\"function %s\";\n", pf->name);
-        // print nodes with prefix f<fi>_n<id>
-        for (int n=0;n<cfg->n_nodes;n++) {
-          fprintf(of, "    %s_f%d_n%d [shape=box,label=\"", prefix, fi, cfg->nodes[n].id);
-          dot_escape(of, cfg->nodes[n].label);
-          for (int ln=0; ln<cfg->nodes[n].ops.n_lines; ln++) {
-            fputs("\\n", of);
-            dot_escape(of, cfg->nodes[n].ops.lines[ln]);
-          }
-          fputs("\"];\n", of);
-        }
-        // print edges
-        for (int n=0;n<cfg->n_nodes;n++) {
-          for (int j=0;j<cfg->nodes[n].succ.n;j++) {
-            int to = cfg->nodes[n].succ.a[j];
-            char *lab = NULL;
-            if (cfg->nodes[n].succ_labels) lab = cfg->nodes[n].succ_labels[j];
-            if (lab) fprintf(of, "    %s_f%d_n%d -> %s_f%d_n%d [label=\"%s\"];\n", prefix, fi, n, prefix, fi, to, lab);
-            else fprintf(of, "    %s_f%d_n%d -> %s_f%d_n%d;\n", prefix, fi, n, prefix, fi, to);
-          }
-        }
-        fprintf(of, "  }\n");
-      }
-      fprintf(of, "}\n");
-      fclose(of);
-      printf("Wrote %s\n", outfile);
+  if (jobs > 1) {
+    run_jobs(files, file_count, &opt, jobs, ggp);
+  } else {
+    TSParser *parser = new_v2lang_parser();
+    if (!parser) {
+      fprintf(stderr, "Failed to set language\n");
+      return 2;
     }
-
-    // build call-graph based on Call(...) occurrences inside CFG nodes
-    Pair *pairs = NULL; int pair_cap=0, pair_n=0;
-    for (int fi=0; fi<func_n; fi++) {
-      ProgramFunction *pf = &funcs[fi].meta;
-      CFG *cfg = pf->cfg;
-      if (!cfg) continue;
-      CallCollectorCtx ctx = { &pairs, &pair_n, &pair_cap, pf->name, all_func_names, all_fn_n };
-      for (int n=0;n<cfg->n_nodes;n++) {
-        for (int ln=0; ln<cfg->nodes[n].ops.n_lines; ln++) {
-          scan_line_for_calls(cfg->nodes[n].ops.lines[ln], collect_call_if_known, &ctx);
-        }
-      }
+    Arena arena; arena_init(&arena);
+    for (int i=0;i<file_count;i++) {
+      FileResult r;
+      file_result_init(&r);
+      if (!flat_path) process_file(parser, &arena, files[i], &opt, &r);
+      else if (process_flat(&arena, files[i], flat_path, &opt, &r) != 0) failed = 1;
+      commit_file_result(&r, &opt, ggp);
     }
+    arena_free(&arena);
+    ts_parser_delete(parser);
+  }
 
-    // write callgraph
-    char callgraph_dot[1024];
-    char callgraph_csv[1024];
-    snprintf(callgraph_dot, sizeof(callgraph_dot), "%s/%s.callgraph.dot", outdir, base);
-    snprintf(callgraph_csv, sizeof(callgraph_csv), "%s/%s.callgraph.csv", outdir, base);
-    FILE *cf = fopen(callgraph_dot, "w");
-    if (cf) {
-      fprintf(cf, "digraph CallGraph {\n");
-      // unique nodes
-      for (int k=0;k<all_fn_n;k++) fprintf(cf, "  \"%s\";\n", all_func_names[k]);
-      for (int p=0;p<pair_n;p++) fprintf(cf, "  \"%s\" -> \"%s\" [label=\"%d\"];\n", pairs[p].caller, pairs[p].callee, pairs[p].count);
-      fprintf(cf, "}\n"); fclose(cf); printf("Wrote %s\n", callgraph_dot);
-
-      // write CSV
-      FILE *csv = fopen(callgraph_csv, "w");
-      if (csv) {
-        fprintf(csv, "caller,callee,count\n");
-        for (int p=0;p<pair_n;p++) fprintf(csv, "%s,%s,%d\n", pairs[p].caller, pairs[p].callee, pairs[p].count);
-        fclose(csv);
-        printf("Wrote %s\n", callgraph_csv);
-      } else fprintf(stderr, "Cannot write %s\n", callgraph_csv);
-    } else fprintf(stderr, "Cannot write callgraph %s\n", callgraph_dot);
-
-    // free pairs
-    for (int p=0;p<pair_n;p++) { free(pairs[p].caller); free(pairs[p].callee); }
-    free(pairs);
-    for (int k=0;k<all_fn_n;k++) free(all_func_names[k]); free(all_func_names);
-
-    // cleanup
-    for (int fi=0; fi<func_n; fi++) {
-      if (funcs[fi].meta.cfg) cfg_free(funcs[fi].meta.cfg);
-      free(funcs[fi].meta.name);
-      free(funcs[fi].meta.signature);
-      free(funcs[fi].meta.source_file);
+  if (ggp && opt.ndjson) {
+    for (int p=0;p<gg.g.n_edges;p++) {
+      const CallEdge *e = &gg.g.edges[p];
+      if (gg.defined[e->callee]) ndjson_write_call(opt.ndjson, NULL, gg.g.names[e->caller], gg.g.names[e->callee], e->count);
     }
-    free(funcs);
-    free(stack);
-    ts_tree_delete(tree);
-    free(source);
-    free(pathdup);
+  } else if (ggp) global_callgraph_write(ggp, outdir);
+  if (opt.bin) {
+    if (ggp) cfgbin_writer_add_calls(&bin, &gg.g, gg.defined, CFGBIN_NO_TEXT);
+    if (cfgbin_writer_finish(&bin, bin_path) == 0) fprintf(status, "Wrote %s\n", bin_path);
+    else fprintf(stderr, "Cannot write %s\n", bin_path);
   }
-
-  ts_parser_delete(parser);
+  if (ggp) global_callgraph_free(ggp);
+  if (opt.cache) {
+    fprintf(status, "CFG cache: %lu hits, %lu misses\n", cache.hits, cache.misses);
+    cfg_cache_close(&cache);
+  }
+  if (opt.ndjson && opt.ndjson != stdout) fclose(opt.ndjson);
+  free(filter.names);
+  free(filter.range_start);
+  free(filter.range_end);
   free(files);
-  return 0;
+  return failed ? 1 : 0;
 }
@@ -0,0 +1,103 @@
+#include "ndjson.h"
+#include <stdlib.h>
+#include <string.h>
+
+void ndjson_write_string(FILE *f, const char *s, size_t len) {
+  fputc('"', f);
+  for (size_t i=0;i<len;i++) {
+    unsigned char ch = (unsigned char)s[i];
+    if (ch == '"' || ch == '\\') fprintf(f, "\\%c", ch);
+    else if (ch == '\n') fputs("\\n", f);
+    else if (ch == '\r') fputs("\\r", f);
+    else if (ch == '\t') fputs("\\t", f);
+    else if (ch < 0x20) fprintf(f, "\\u%04x", ch);
+    else fputc(ch, f);
+  }
+  fputc('"', f);
+}
+
+static void write_cstr(FILE *f, const char *s) { ndjson_write_string(f, s, strlen(s)); }
+
+// finish the record being written to rec (a memstream over buf/len) and
+// write it to out in one call
+static void emit(FILE *out, FILE *rec, char **buf, size_t *len) {
+  fputc('\n', rec);
+  fclose(rec);
+  fwrite(*buf, 1, *len, out);
+  free(*buf);
+}
+
+void ndjson_write_function(FILE *out, const char *file, const char *name, const char *signature, uint32_t start_byte, uint32_t end_byte, const FrozenCFG *cfg) {
+  char *buf = NULL;
+  size_t len = 0;
+  FILE *f = open_memstream(&buf, &len);
+  fputs("{\"type\":\"function\",\"file\":", f);
+  write_cstr(f, file);
+  fputs(",\"name\":", f);
+  write_cstr(f, name);
+  fputs(",\"signature\":", f);
+  write_cstr(f, signature);
+  fprintf(f, ",\"start_byte\":%u,\"end_byte\":%u,\"nodes\":[", start_byte, end_byte);
+  for (int n=0;n<cfg->n_nodes;n++) {
+    fprintf(f, "%s{\"id\":%d,\"role\":\"%s\",\"ops\":[", n ? "," : "", n, cfg_role_name(cfg->role[n]));
+    for (int op=cfg->ops_start[n]; op<cfg->ops_start[n+1]; op++) {
+      if (op > cfg->ops_start[n]) fputc(',', f);
+      fputc('"', f);
+      ir_write_stmt(f, &cfg->ops[op], IR_ESC_JSON);
+      fputc('"', f);
+    }
+    fputs("]}", f);
+  }
+  fputs("],\"edges\":[", f);
+  int first = 1;
+  for (int n=0;n<cfg->n_nodes;n++) {
+    for (int j=cfg->succ_start[n]; j<cfg->succ_start[n+1]; j++) {
+      fprintf(f, "%s{\"from\":%d,\"to\":%d,\"kind\":\"%s\"}", first ? "" : ",", n, cfg->succ[j], cfg_edge_kind_name(cfg->succ_kind[j]));
+      first = 0;
+    }
+  }
+  fputs("]}", f);
+  emit(out, f, &buf, &len);
+}
+
+void ndjson_write_symbol(FILE *out, const char *file, const ChunkFunc *f, const ChunkArg *args, int n_args, const char *ret, uint32_t ret_len) {
+  char *buf = NULL;
+  size_t len = 0;
+  FILE *r = open_memstream(&buf, &len);
+  fputs("{\"type\":\"symbol\",\"file\":", r);
+  write_cstr(r, file);
+  fputs(",\"name\":", r);
+  write_cstr(r, f->name);
+  fputs(",\"signature\":", r);
+  // like the function records: the name when there is no signature text
+  if (f->sig_len > 0) ndjson_write_string(r, f->sig, f->sig_len);
+  else write_cstr(r, f->name);
+  fprintf(r, ",\"start_byte\":%u,\"end_byte\":%u,\"line\":%u,\"args\":[", f->byte, f->end_byte, f->point.row + 1);
+  for (int i=0;i<n_args;i++) {
+    fputs(i ? ",{\"name\":" : "{\"name\":", r);
+    ndjson_write_string(r, args[i].name, args[i].name_len);
+    fputs(",\"type\":", r);
+    if (args[i].type) ndjson_write_string(r, args[i].type, args[i].type_len);
+    else fputs("null", r);
+    fputc('}', r);
+  }
+  fputs("],\"returns\":", r);
+  if (ret) ndjson_write_string(r, ret, ret_len);
+  else fputs("null", r);
+  fprintf(r, ",\"complete\":%s}", f->complete ? "true" : "false");
+  emit(out, r, &buf, &len);
+}
+
+void ndjson_write_call(FILE *out, const char *file, const char *caller, const char *callee, int count) {
+  char *buf = NULL;
+  size_t len = 0;
+  FILE *f = open_memstream(&buf, &len);
+  fputs("{\"type\":\"call\"", f);
+  if (file) { fputs(",\"file\":", f); write_cstr(f, file); }
+  fputs(",\"caller\":", f);
+  write_cstr(f, caller);
+  fputs(",\"callee\":", f);
+  write_cstr(f, callee);
+  fprintf(f, ",\"count\":%d}", count);
+  emit(out, f, &buf, &len);
+}
@@ -0,0 +1,34 @@
+#ifndef LAB2_NDJSON_H
+#define LAB2_NDJSON_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "flow.h"
+#include "chunk_parse.h"
+
+// --format ndjson: one JSON object per line, written while files are
+// processed. Each record is rendered into memory and written with a single
+// fwrite(), so records from concurrent workers never interleave mid-line.
+//
+//   {"type":"function","file":...,"name":...,"signature":...,
+//    "start_byte":N,"end_byte":N,
+//    "nodes":[{"id":0,"role":"entry","ops":["...",...]},...],
+//    "edges":[{"from":0,"to":1,"kind":"true"},...]}
+//   {"type":"call","file":...,"caller":...,"callee":...,"count":N}
+//   {"type":"symbol","file":...,"name":...,"signature":...,
+//    "start_byte":N,"end_byte":N,"line":N,
+//    "args":[{"name":...,"type":...|null},...],"returns":...|null,
+//    "complete":true}
+//
+// "file" is left out of call records of the --global-callgraph graph.
+
+// JSON string literal for s[0..len)
+void ndjson_write_string(FILE *f, const char *s, size_t len);
+
+void ndjson_write_function(FILE *out, const char *file, const char *name, const char *signature, uint32_t start_byte, uint32_t end_byte, const FrozenCFG *cfg);
+// --index-only record of f, found by chunk_index()
+void ndjson_write_symbol(FILE *out, const char *file, const ChunkFunc *f, const ChunkArg *args, int n_args, const char *ret, uint32_t ret_len);
+// file may be NULL
+void ndjson_write_call(FILE *out, const char *file, const char *caller, const char *callee, int count);
+
+#endif
@@ -0,0 +1,55 @@
+#include "node_kind.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+_Static_assert(NK_COUNT <= 256, "NodeKind must fit the uint8_t symbol table");
+
+const uint8_t *node_kind_table = NULL;
+uint32_t node_kind_table_len = 0;
+TSFieldId node_field_ids[NF_COUNT];
+
+typedef struct NodeKindName {
+  NodeKind kind;
+  const char *type;
+  int named;
+} NodeKindName;
+
+static const NodeKindName kind_names[] = {
+#define NODE_KIND_ENTRY(kind, type, named) { kind, type, named },
+  NODE_KIND_LIST(NODE_KIND_ENTRY)
+#undef NODE_KIND_ENTRY
+};
+
+static const char *const field_names[NF_COUNT] = {
+#define NODE_FIELD_ENTRY(field, name) [field] = name,
+  NODE_FIELD_LIST(NODE_FIELD_ENTRY)
+#undef NODE_FIELD_ENTRY
+};
+
+int node_kinds_init(const TSLanguage *lang) {
+  if (node_kind_table) return 0;
+  uint32_t n = ts_language_symbol_count(lang);
+  uint8_t *table = calloc(n ? n : 1, sizeof(uint8_t));
+  int missing = 0;
+  for (size_t i=0;i<sizeof(kind_names)/sizeof(kind_names[0]);i++) {
+    const NodeKindName *k = &kind_names[i];
+    TSSymbol sym = ts_language_symbol_for_name(lang, k->type, (uint32_t)strlen(k->type), k->named != 0);
+    if (sym != 0 && sym < n) table[sym] = (uint8_t)k->kind;
+    else fprintf(stderr, "%snode kind %s", missing++ ? ", " : "Parser lacks ", k->type);
+  }
+  for (int f=NF_NONE+1;f<NF_COUNT;f++) {
+    node_field_ids[f] = ts_language_field_id_for_name(lang, field_names[f], (uint32_t)strlen(field_names[f]));
+    if (node_field_ids[f] == 0) fprintf(stderr, "%sfield %s", missing++ ? ", " : "Parser lacks ", field_names[f]);
+  }
+  if (missing) {
+    // without them every kind or field lookup quietly misses and CFGs collapse
+    fprintf(stderr, "\nLab1/src/parser.c is older than node_kinds.h; regenerate it (npx tree-sitter generate in Lab1)\n");
+    free(table);
+    memset(node_field_ids, 0, sizeof(node_field_ids));
+    return -1;
+  }
+  node_kind_table_len = n;
+  node_kind_table = table;
+  return 0;
+}
@@ -0,0 +1,47 @@
+#ifndef LAB2_NODE_KIND_H
+#define LAB2_NODE_KIND_H
+
+#include <stdint.h>
+#include <tree_sitter/api.h>
+#include "node_kinds.h"
+#include "flat_ast.h"
+
+// TSSymbol -> NodeKind, filled by node_kinds_init()
+extern const uint8_t *node_kind_table;
+extern uint32_t node_kind_table_len;
+
+// NodeField -> TSFieldId, filled by node_kinds_init(); 0 for a field the
+// language does not have
+extern TSFieldId node_field_ids[NF_COUNT];
+
+// Resolve the symbol id of every NodeKind with ts_language_symbol_for_name
+// and the id of every NodeField with ts_language_field_id_for_name.
+// Call once at startup, before any thread uses node_kind() or node_field().
+// 0 on success; -1, with the missing names on stderr, if lang lacks any of
+// them (a parser.c generated from an older grammar.js).
+int node_kinds_init(const TSLanguage *lang);
+
+static inline NodeKind node_kind(TSNode node) {
+  TSSymbol sym = ts_node_symbol(node);
+  return (sym < node_kind_table_len) ? (NodeKind)node_kind_table[sym] : NK_UNKNOWN;
+}
+
+// child of node stored under field f; a null node if there is none
+static inline TSNode node_field(TSNode node, NodeField f) {
+  TSFieldId id = node_field_ids[f];
+  return id ? ts_node_child_by_field_id(node, id) : (TSNode){0};
+}
+
+// the same for a node of a FlatAst built with the language of node_kinds_init()
+static inline NodeKind flat_kind(const FlatAst *a, uint32_t i) {
+  TSSymbol sym = a->nodes[i].symbol;
+  return (sym < node_kind_table_len) ? (NodeKind)node_kind_table[sym] : NK_UNKNOWN;
+}
+
+// child of node i stored under field f; FLAT_NONE if there is none (or i is
+// FLAT_NONE)
+static inline uint32_t flat_field(const FlatAst *a, uint32_t i, NodeField f) {
+  return flat_child_by_field_id(a, i, node_field_ids[f]);
+}
+
+#endif
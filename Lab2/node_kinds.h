@@ -0,0 +1,235 @@
+/* Generated by Lab2/gen_node_kinds.js from Lab1/src/node-types.json. Do not edit. */
+#ifndef LAB2_NODE_KINDS_H
+#define LAB2_NODE_KINDS_H
+
+typedef enum NodeKind {
+  NK_UNKNOWN = 0,
+  NK_ARG_DEF,
+  NK_ARG_LIST,
+  NK_ASSIGNMENT,
+  NK_BINARY_EXPRESSION,
+  NK_BLOCK,
+  NK_BODY,
+  NK_BOOL,
+  NK_BREAK_STATEMENT,
+  NK_DO_STATEMENT,
+  NK_EXPR,
+  NK_EXPR_LIST,
+  NK_EXPR_STMT,
+  NK_FUNC_DEF,
+  NK_FUNC_SIGNATURE,
+  NK_ID_LIST,
+  NK_IF_STATEMENT,
+  NK_LITERAL,
+  NK_PARENTHESIZED_EXPRESSION,
+  NK_POSTFIX,
+  NK_SOURCE_ITEM,
+  NK_SOURCE_FILE,
+  NK_STATEMENT,
+  NK_TYPE_REF,
+  NK_UNARY_EXPRESSION,
+  NK_VAR_DECL,
+  NK_WHILE_STATEMENT,
+  NK_BANG,
+  NK_BANG_EQ,
+  NK_PERCENT,
+  NK_AMP,
+  NK_AMP_AMP,
+  NK_LPAREN,
+  NK_RPAREN,
+  NK_STAR,
+  NK_PLUS,
+  NK_COMMA,
+  NK_MINUS,
+  NK_SLASH,
+  NK_COLON,
+  NK_COLON_EQ,
+  NK_SEMI,
+  NK_LT,
+  NK_LT_LT,
+  NK_LT_EQ,
+  NK_EQ,
+  NK_GT,
+  NK_GT_EQ,
+  NK_GT_GT,
+  NK_LBRACK,
+  NK_RBRACK,
+  NK_CARET,
+  NK_KW_AND,
+  NK_KW_ARRAY,
+  NK_KW_BEGIN,
+  NK_BITS,
+  NK_KW_BOOL,
+  NK_KW_BREAK,
+  NK_KW_BYTE,
+  NK_KW_CHAR,
+  NK_CHAR,
+  NK_COMMENT,
+  NK_DEC,
+  NK_KW_DO,
+  NK_KW_ELSE,
+  NK_KW_END,
+  NK_KW_FALSE,
+  NK_HEX,
+  NK_IDENTIFIER,
+  NK_KW_IF,
+  NK_KW_INT,
+  NK_KW_LONG,
+  NK_KW_METHOD,
+  NK_KW_NOT,
+  NK_KW_OF,
+  NK_KW_OR,
+  NK_KW_REPEAT,
+  NK_STR,
+  NK_KW_STRING,
+  NK_KW_THEN,
+  NK_KW_TRUE,
+  NK_KW_UINT,
+  NK_KW_ULONG,
+  NK_KW_UNTIL,
+  NK_KW_VAR,
+  NK_KW_WHILE,
+  NK_PIPE,
+  NK_PIPE_PIPE,
+  NK_TILDE,
+  NK_COUNT
+} NodeKind;
+
+/* X(kind, type name, is_named) */
+#define NODE_KIND_LIST(X) \
+  X(NK_ARG_DEF,                  "argDef", 1) \
+  X(NK_ARG_LIST,                 "argList", 1) \
+  X(NK_ASSIGNMENT,               "assignment", 1) \
+  X(NK_BINARY_EXPRESSION,        "binary_expression", 1) \
+  X(NK_BLOCK,                    "block", 1) \
+  X(NK_BODY,                     "body", 1) \
+  X(NK_BOOL,                     "bool", 1) \
+  X(NK_BREAK_STATEMENT,          "break_statement", 1) \
+  X(NK_DO_STATEMENT,             "do_statement", 1) \
+  X(NK_EXPR,                     "expr", 1) \
+  X(NK_EXPR_LIST,                "exprList", 1) \
+  X(NK_EXPR_STMT,                "expr_stmt", 1) \
+  X(NK_FUNC_DEF,                 "funcDef", 1) \
+  X(NK_FUNC_SIGNATURE,           "funcSignature", 1) \
+  X(NK_ID_LIST,                  "idList", 1) \
+  X(NK_IF_STATEMENT,             "if_statement", 1) \
+  X(NK_LITERAL,                  "literal", 1) \
+  X(NK_PARENTHESIZED_EXPRESSION, "parenthesized_expression", 1) \
+  X(NK_POSTFIX,                  "postfix", 1) \
+  X(NK_SOURCE_ITEM,              "sourceItem", 1) \
+  X(NK_SOURCE_FILE,              "source_file", 1) \
+  X(NK_STATEMENT,                "statement", 1) \
+  X(NK_TYPE_REF,                 "typeRef", 1) \
+  X(NK_UNARY_EXPRESSION,         "unary_expression", 1) \
+  X(NK_VAR_DECL,                 "varDecl", 1) \
+  X(NK_WHILE_STATEMENT,          "while_statement", 1) \
+  X(NK_BANG,                     "!", 0) \
+  X(NK_BANG_EQ,                  "!=", 0) \
+  X(NK_PERCENT,                  "%", 0) \
+  X(NK_AMP,                      "&", 0) \
+  X(NK_AMP_AMP,                  "&&", 0) \
+  X(NK_LPAREN,                   "(", 0) \
+  X(NK_RPAREN,                   ")", 0) \
+  X(NK_STAR,                     "*", 0) \
+  X(NK_PLUS,                     "+", 0) \
+  X(NK_COMMA,                    ",", 0) \
+  X(NK_MINUS,                    "-", 0) \
+  X(NK_SLASH,                    "/", 0) \
+  X(NK_COLON,                    ":", 0) \
+  X(NK_COLON_EQ,                 ":=", 0) \
+  X(NK_SEMI,                     ";", 0) \
+  X(NK_LT,                       "<", 0) \
+  X(NK_LT_LT,                    "<<", 0) \
+  X(NK_LT_EQ,                    "<=", 0) \
+  X(NK_EQ,                       "=", 0) \
+  X(NK_GT,                       ">", 0) \
+  X(NK_GT_EQ,                    ">=", 0) \
+  X(NK_GT_GT,                    ">>", 0) \
+  X(NK_LBRACK,                   "[", 0) \
+  X(NK_RBRACK,                   "]", 0) \
+  X(NK_CARET,                    "^", 0) \
+  X(NK_KW_AND,                   "and", 0) \
+  X(NK_KW_ARRAY,                 "array", 0) \
+  X(NK_KW_BEGIN,                 "begin", 0) \
+  X(NK_BITS,                     "bits", 1) \
+  X(NK_KW_BOOL,                  "bool", 0) \
+  X(NK_KW_BREAK,                 "break", 0) \
+  X(NK_KW_BYTE,                  "byte", 0) \
+  X(NK_KW_CHAR,                  "char", 0) \
+  X(NK_CHAR,                     "char", 1) \
+  X(NK_COMMENT,                  "comment", 1) \
+  X(NK_DEC,                      "dec", 1) \
+  X(NK_KW_DO,                    "do", 0) \
+  X(NK_KW_ELSE,                  "else", 0) \
+  X(NK_KW_END,                   "end", 0) \
+  X(NK_KW_FALSE,                 "false", 0) \
+  X(NK_HEX,                      "hex", 1) \
+  X(NK_IDENTIFIER,               "identifier", 1) \
+  X(NK_KW_IF,                    "if", 0) \
+  X(NK_KW_INT,                   "int", 0) \
+  X(NK_KW_LONG,                  "long", 0) \
+  X(NK_KW_METHOD,                "method", 0) \
+  X(NK_KW_NOT,                   "not", 0) \
+  X(NK_KW_OF,                    "of", 0) \
+  X(NK_KW_OR,                    "or", 0) \
+  X(NK_KW_REPEAT,                "repeat", 0) \
+  X(NK_STR,                      "str", 1) \
+  X(NK_KW_STRING,                "string", 0) \
+  X(NK_KW_THEN,                  "then", 0) \
+  X(NK_KW_TRUE,                  "true", 0) \
+  X(NK_KW_UINT,                  "uint", 0) \
+  X(NK_KW_ULONG,                 "ulong", 0) \
+  X(NK_KW_UNTIL,                 "until", 0) \
+  X(NK_KW_VAR,                   "var", 0) \
+  X(NK_KW_WHILE,                 "while", 0) \
+  X(NK_PIPE,                     "|", 0) \
+  X(NK_PIPE_PIPE,                "||", 0) \
+  X(NK_TILDE,                    "~", 0)
+
+typedef enum NodeField {
+  NF_NONE = 0,
+  NF_ALTERNATIVE,
+  NF_ARGS,
+  NF_BLOCK,
+  NF_BODY,
+  NF_CONDITION,
+  NF_CONSEQUENCE,
+  NF_KIND,
+  NF_LEFT,
+  NF_NAME,
+  NF_NAMES,
+  NF_OPEN,
+  NF_OPERAND,
+  NF_OPERATOR,
+  NF_RETURNS,
+  NF_RIGHT,
+  NF_SIGNATURE,
+  NF_TARGET,
+  NF_TYPE,
+  NF_VALUE,
+  NF_COUNT
+} NodeField;
+
+/* X(field, field name) */
+#define NODE_FIELD_LIST(X) \
+  X(NF_ALTERNATIVE, "alternative") \
+  X(NF_ARGS,        "args") \
+  X(NF_BLOCK,       "block") \
+  X(NF_BODY,        "body") \
+  X(NF_CONDITION,   "condition") \
+  X(NF_CONSEQUENCE, "consequence") \
+  X(NF_KIND,        "kind") \
+  X(NF_LEFT,        "left") \
+  X(NF_NAME,        "name") \
+  X(NF_NAMES,       "names") \
+  X(NF_OPEN,        "open") \
+  X(NF_OPERAND,     "operand") \
+  X(NF_OPERATOR,    "operator") \
+  X(NF_RETURNS,     "returns") \
+  X(NF_RIGHT,       "right") \
+  X(NF_SIGNATURE,   "signature") \
+  X(NF_TARGET,      "target") \
+  X(NF_TYPE,        "type") \
+  X(NF_VALUE,       "value")
+
+#endif
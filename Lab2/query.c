@@ -0,0 +1,66 @@
+#include "query.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+TSQuery *lab2_query = NULL;
+
+// capture id -> QueryCapture; the query has fewer captures than QC_COUNT
+static uint8_t capture_table[QC_COUNT];
+static uint32_t capture_table_len = 0;
+
+// patterns in QueryPattern order
+static const char query_source[] =
+  "(funcDef"
+  " signature: (funcSignature name: (identifier)? @name)? @signature"
+  " body: (body)? @body) @function\n";
+
+static const char *const capture_names[QC_COUNT] = {
+  [QC_FUNCTION] = "function",
+  [QC_NAME] = "name",
+  [QC_SIGNATURE] = "signature",
+  [QC_BODY] = "body",
+};
+
+static const char *query_error_name(TSQueryError e) {
+  switch (e) {
+    case TSQueryErrorSyntax: return "syntax error";
+    case TSQueryErrorNodeType: return "unknown node type";
+    case TSQueryErrorField: return "unknown field";
+    case TSQueryErrorCapture: return "unknown capture";
+    case TSQueryErrorStructure: return "impossible pattern";
+    case TSQueryErrorLanguage: return "incompatible language";
+    default: return "error";
+  }
+}
+
+int queries_init(const TSLanguage *lang) {
+  if (lab2_query) return 0;
+  uint32_t err_offset = 0;
+  TSQueryError err = TSQueryErrorNone;
+  TSQuery *q = ts_query_new(lang, query_source, (uint32_t)strlen(query_source), &err_offset, &err);
+  if (!q) {
+    // the name the grammar lacks, or where the syntax broke
+    uint32_t len = 0;
+    while (err_offset + len < sizeof(query_source) - 1 && (isalnum((unsigned char)query_source[err_offset + len]) || query_source[err_offset + len] == '_')) len++;
+    fprintf(stderr, "Query: %s at offset %u (%.*s)\n", query_error_name(err), err_offset, (int)(len ? len : 1), query_source + err_offset);
+    return -1;
+  }
+  uint32_t n = ts_query_capture_count(q);
+  if (n > QC_COUNT) n = QC_COUNT;
+  for (uint32_t i=0;i<n;i++) {
+    uint32_t len = 0;
+    const char *name = ts_query_capture_name_for_id(q, i, &len);
+    capture_table[i] = QC_NONE;
+    for (int c=QC_NONE+1;c<QC_COUNT;c++) {
+      if (strlen(capture_names[c]) == len && memcmp(capture_names[c], name, len) == 0) { capture_table[i] = (uint8_t)c; break; }
+    }
+  }
+  capture_table_len = n;
+  lab2_query = q;
+  return 0;
+}
+
+QueryCapture query_capture(uint32_t id) {
+  return (id < capture_table_len) ? (QueryCapture)capture_table[id] : QC_NONE;
+}
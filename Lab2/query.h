@@ -0,0 +1,48 @@
+#ifndef LAB2_QUERY_H
+#define LAB2_QUERY_H
+
+#include <stdint.h>
+#include <tree_sitter/api.h>
+
+// One tree-sitter query with the patterns the extractors look for, compiled
+// once per process by queries_init(). A TSQuery is read-only after
+// ts_query_new, so every thread shares it; each thread runs it with its own
+// TSQueryCursor.
+//
+// Patterns (pattern_index of a TSQueryMatch):
+//   QP_FUNCTION  (funcDef signature: (funcSignature name: @name) @signature
+//                         body: @body) @function; name, signature and body
+//                may be missing
+// Call sites come from the IR of each CFG (ir_for_each_call), not from here.
+typedef enum QueryPattern {
+  QP_FUNCTION,
+  QP_COUNT
+} QueryPattern;
+
+typedef enum QueryCapture {
+  QC_NONE,
+  QC_FUNCTION,
+  QC_NAME,
+  QC_SIGNATURE,
+  QC_BODY,
+  QC_COUNT
+} QueryCapture;
+
+// funcDef is two levels below source_file (source_file > sourceItem >
+// funcDef); error recovery can put an ERROR node or two in between. Run the
+// query with this max start depth to find functions without entering bodies.
+#define QUERY_FUNCTION_DEPTH 4
+
+// the compiled query, set by queries_init()
+extern TSQuery *lab2_query;
+
+// Compile the query for lang and map its capture ids to QueryCapture.
+// Call once at startup, next to node_kinds_init(). 0 on success; -1 (with the
+// offset and kind of the error on stderr) if the query does not fit the
+// grammar.
+int queries_init(const TSLanguage *lang);
+
+// QueryCapture of capture id `id` of lab2_query
+QueryCapture query_capture(uint32_t id);
+
+#endif
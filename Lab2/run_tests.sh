@@ -4,9 +4,13 @@ set -euo pipefail
 ROOT=$(cd "$(dirname "$0")/.." && pwd)
 cd "$ROOT"
 
-# Build and run generator
-clang -o Lab2/lab2_cfg Lab2/main.c Lab2/flow.c Lab1/src/parser.c vendor/tree-sitter/lib/src/lib.c \
-  -I Lab1/src -I Lab2 -I vendor/tree-sitter/lib/include -I vendor/tree-sitter/lib/src -lm
+# Regenerate the parser so parser.c matches grammar.js, then the node kind
+# tables (the generator refuses a parser.c that lacks a kind or field)
+(cd Lab1 && npx tree-sitter generate)
+node Lab2/gen_node_kinds.js
+LAB2_SRC=(Lab2/main.c Lab2/flow.c Lab2/ir.c Lab2/callgraph.c Lab2/session.c Lab2/cfg_cache.c Lab2/cfgbin.c Lab2/ndjson.c Lab2/worksteal.c Lab2/chunk_parse.c Lab2/hash.c Lab2/node_kind.c Lab2/flat_ast.c Lab2/query.c Lab2/source_map.c Lab2/arena.c Lab1/src/parser.c Lab1/src/scanner.c vendor/tree-sitter/lib/src/lib.c)
+LAB2_FLAGS=(-I Lab1/src -I Lab2 -I vendor/tree-sitter/lib/include -I vendor/tree-sitter/lib/src -lm -pthread)
+clang -o Lab2/lab2_cfg $LAB2_SRC $LAB2_FLAGS
 
 ./Lab2/generate_cfgs.sh
 
@@ -19,4 +23,176 @@ fi
 [ -f "$OUT/callgraph.dot" ] || { echo "callgraph.dot missing"; exit 3 }
 [ -f "$OUT/all_functions.dot" ] || { echo "all_functions.dot missing"; exit 4 }
 
+# --jobs must produce the same files and the same "Wrote" order as a serial run
+JOBS_OUT=$(mktemp -d)
+SERIAL_OUT=$(mktemp -d)
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$SERIAL_OUT" | sed "s#$SERIAL_OUT#OUT#" > "$SERIAL_OUT.log"
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$JOBS_OUT" --jobs 4 | sed "s#$JOBS_OUT#OUT#" > "$JOBS_OUT.log"
+diff -r "$SERIAL_OUT" "$JOBS_OUT" || { echo "--jobs output differs from serial run"; exit 5 }
+diff "$SERIAL_OUT.log" "$JOBS_OUT.log" || { echo "--jobs output order differs from serial run"; exit 6 }
+rm -rf "$SERIAL_OUT" "$JOBS_OUT" "$SERIAL_OUT.log" "$JOBS_OUT.log"
+
+# --stream writes the DOT files from the workers; files and "Wrote" lines
+# must not change
+STREAM_OUT=$(mktemp -d)
+BUFFERED_OUT=$(mktemp -d)
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$BUFFERED_OUT" --jobs 4 | sed "s#$BUFFERED_OUT#OUT#" > "$BUFFERED_OUT.log"
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$STREAM_OUT" --jobs 4 --stream | sed "s#$STREAM_OUT#OUT#" > "$STREAM_OUT.log"
+diff -r "$BUFFERED_OUT" "$STREAM_OUT" || { echo "--stream output differs"; exit 12 }
+diff "$BUFFERED_OUT.log" "$STREAM_OUT.log" || { echo "--stream output order differs"; exit 12 }
+rm -rf "$STREAM_OUT" "$BUFFERED_OUT" "$STREAM_OUT.log" "$BUFFERED_OUT.log"
+
+# --function-jobs builds one file's CFGs on several threads; the output must
+# match a single-threaded run
+FJ=$(mktemp -d)
+awk 'BEGIN { for (i = 0; i < 500; i++) { print "method f" i "()"; print "begin"; print "  if x then f" (i + 1) "(); else y = y + " i ";"; print "end;" } }' > "$FJ/many.txt"
+./Lab2/lab2_cfg "$FJ/many.txt" --outdir "$FJ/serial" --format ndjson --output "$FJ/serial.ndjson" > /dev/null
+./Lab2/lab2_cfg "$FJ/many.txt" --outdir "$FJ/serial" > /dev/null
+./Lab2/lab2_cfg "$FJ/many.txt" --outdir "$FJ/par" --function-jobs 4 --format ndjson --output "$FJ/par.ndjson" > /dev/null
+./Lab2/lab2_cfg "$FJ/many.txt" --outdir "$FJ/par" --function-jobs 4 > /dev/null
+diff -r "$FJ/serial" "$FJ/par" || { echo "--function-jobs output differs from serial run"; exit 14 }
+cmp -s "$FJ/serial.ndjson" "$FJ/par.ndjson" || { echo "--function-jobs ndjson differs from serial run"; exit 14 }
+# the same run under AddressSanitizer and ThreadSanitizer: the file thread
+# emits CFGs out of the workers' arenas, also after a worker has run out of
+# work
+for SAN in address thread; do
+  clang -g -O1 -fsanitize=$SAN -o "$FJ/lab2_cfg_$SAN" $LAB2_SRC $LAB2_FLAGS
+  "$FJ/lab2_cfg_$SAN" "$FJ/many.txt" --outdir "$FJ/$SAN" --function-jobs 4 > /dev/null || { echo "--function-jobs: $SAN sanitizer run failed"; exit 14 }
+  diff -r "$FJ/serial" "$FJ/$SAN" || { echo "--function-jobs: $SAN sanitizer run differs from serial run"; exit 14 }
+done
+rm -rf "$FJ"
+
+# --parse-jobs cuts a large file at function starts and parses the chunks in
+# parallel; `method` inside comments and strings must not be taken for a cut
+PJ=$(mktemp -d)
+awk 'BEGIN { for (i = 0; i < 20000; i++) { print "// method fake" i "("; print "method f" i "()"; print "begin"; print "  s := \"method g(\";"; print "  f" (i + 1) "();"; print "end;" } }' > "$PJ/big.txt"
+./Lab2/lab2_cfg "$PJ/big.txt" --outdir "$PJ/serial" > /dev/null
+./Lab2/lab2_cfg "$PJ/big.txt" --outdir "$PJ/chunks" --parse-jobs 4 > /dev/null
+diff -r "$PJ/serial" "$PJ/chunks" || { echo "--parse-jobs output differs from serial run"; exit 15 }
+rm -rf "$PJ"
+
+# --function and --range parse and analyse only the selected functions. The
+# pre-scan still reads every signature to the end of the file, so calls from
+# a selected function into one defined before or after it stay in the graph
+SEL=$(mktemp -d)
+printf 'method f()\nbegin\n  g();\nend;\nmethod g()\nbegin\n  h();\nend;\nmethod h()\nbegin\nend;\n' > "$SEL/a.txt"
+./Lab2/lab2_cfg "$SEL/a.txt" --outdir "$SEL" --function g > /dev/null
+[ "$(grep -c 'label="function' "$SEL/a.txt.dot")" -eq 1 ] && grep -q 'label="function g"' "$SEL/a.txt.dot" || { echo "--function: expected only g"; exit 16 }
+grep -qx 'g,h,1' "$SEL/a.txt.callgraph.csv" || { echo "--function: call g -> h missing"; exit 16 }
+H=$(grep -bo 'method h' "$SEL/a.txt" | cut -d: -f1)
+./Lab2/lab2_cfg "$SEL/a.txt" --outdir "$SEL" --range "$H:$((H + 1))" > /dev/null
+[ "$(grep -c 'label="function' "$SEL/a.txt.dot")" -eq 1 ] && grep -q 'label="function h"' "$SEL/a.txt.dot" || { echo "--range: expected only h"; exit 16 }
+# g calls k, which is defined two functions further down
+printf 'method g()\nbegin\n  k();\nend;\nmethod h()\nbegin\nend;\nmethod k()\nbegin\nend;\n' > "$SEL/b.txt"
+./Lab2/lab2_cfg "$SEL/b.txt" --outdir "$SEL" --range 0:1 > /dev/null
+[ "$(grep -c 'label="function' "$SEL/b.txt.dot")" -eq 1 ] && grep -q 'label="function g"' "$SEL/b.txt.dot" || { echo "--range: expected only g"; exit 16 }
+grep -qx 'g,k,1' "$SEL/b.txt.callgraph.csv" || { echo "--range: call g -> k (defined after g) missing"; exit 16 }
+rm -rf "$SEL"
+
+# --index-only finds functions without parsing; names, signatures and byte
+# ranges must match the parsed functions (type_correct.txt has syntax errors,
+# where recovery decides the extents)
+IDX=$(mktemp -d)
+printf '// method fake(\nmethod f(a: int, b: array [,] of int): string\nvar x: int;\nbegin\n  s := "end; method g(";\n  begin { end } x := 1; end;\nend;\nmethod decl(c);\nmethod g { c } (x)\nbegin\n  if x then begin f(); end; else y = y + 1;\nend;\n' > "$IDX/a.txt"
+./Lab2/lab2_cfg "$IDX/a.txt" Lab1/examples/{all_structures_and_expr,functions,my_test,type_errors}.txt --outdir "$IDX" --format ndjson | sed -n 's/^{"type":"function",\(.*"end_byte":[0-9]*\),"nodes".*/\1/p' | sort > "$IDX/parsed"
+./Lab2/lab2_cfg "$IDX/a.txt" Lab1/examples/{all_structures_and_expr,functions,my_test,type_errors}.txt --index-only | sed -n 's/^{"type":"symbol",\(.*"end_byte":[0-9]*\),"line".*/\1/p' | sort > "$IDX/index"
+[ -s "$IDX/index" ] && diff "$IDX/parsed" "$IDX/index" || { echo "--index-only differs from the parse"; exit 17 }
+./Lab2/lab2_cfg "$IDX/a.txt" --index-only | grep -F '"name":"f",' | grep -qF '"line":2,"args":[{"name":"a","type":"int"},{"name":"b","type":"array [,] of int"}],"returns":"string"' || { echo "--index-only: arguments of f"; exit 17 }
+rm -rf "$IDX"
+
+# --global-callgraph resolves calls into functions defined in another input
+GLOBAL=$(mktemp -d)
+printf 'method f()\nbegin\n  g();\n  g();\nend;\n' > "$GLOBAL/a.txt"
+printf 'method g()\nbegin\nend;\n' > "$GLOBAL/b.txt"
+./Lab2/lab2_cfg "$GLOBAL/a.txt" "$GLOBAL/b.txt" --outdir "$GLOBAL" --global-callgraph > /dev/null
+grep -qx 'f,g,2' "$GLOBAL/callgraph.csv" || { echo "--global-callgraph: cross-file edge f -> g missing"; exit 8 }
+rm -rf "$GLOBAL"
+
+# a second run over unchanged inputs takes every CFG from --cache-dir and
+# writes the same files
+CACHE=$(mktemp -d)
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$CACHE/cold" --cache-dir "$CACHE/cfg" > /dev/null
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$CACHE/warm" --cache-dir "$CACHE/cfg" > "$CACHE/warm.log"
+grep -q 'CFG cache: [0-9]* hits, 0 misses' "$CACHE/warm.log" || { echo "--cache-dir: rerun missed the cache"; exit 9 }
+diff -r "$CACHE/cold" "$CACHE/warm" || { echo "--cache-dir: cached output differs"; exit 9 }
+rm -rf "$CACHE"
+
+# --emit-bin writes one artifact for the run, and it does not depend on --jobs
+BIN=$(mktemp -d)
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$BIN/serial" --emit-bin "$BIN/serial.cfgbin" > /dev/null
+./Lab2/lab2_cfg Lab1/examples/*.txt --outdir "$BIN/jobs" --jobs 4 --emit-bin "$BIN/jobs.cfgbin" > /dev/null
+[ "$(head -c 8 "$BIN/serial.cfgbin")" = "V2CFGBIN" ] || { echo "--emit-bin: bad magic"; exit 10 }
+cmp -s "$BIN/serial.cfgbin" "$BIN/jobs.cfgbin" || { echo "--emit-bin: artifact depends on --jobs"; exit 10 }
+# reading the artifact back gives the DOT files of the run
+./Lab2/lab2_cfg --read-bin "$BIN/serial.cfgbin" --outdir "$BIN/read" > /dev/null || { echo "--read-bin: artifact rejected"; exit 10 }
+for f in "$BIN"/serial/*.txt.dot; do
+  cmp -s "$f" "$BIN/read/$(basename "$f")" || { echo "--read-bin: $(basename "$f") differs from the run"; exit 10 }
+done
+rm -rf "$BIN"
+
+# --format ndjson streams one record per function and call edge to stdout,
+# with nothing else mixed in
+ND=$(mktemp -d)
+printf 'method f()\nbegin\n  g();\n  g();\nend;\nmethod g()\nbegin\nend;\n' > "$ND/a.txt"
+./Lab2/lab2_cfg "$ND/a.txt" --outdir "$ND" --format ndjson > "$ND/a.ndjson"
+[ "$(grep -c '^{"type":"function",' "$ND/a.ndjson")" -eq 2 ] || { echo "--format ndjson: expected 2 function records"; exit 11 }
+grep -q '^{"type":"call","file":"[^"]*","caller":"f","callee":"g","count":2}$' "$ND/a.ndjson" || { echo "--format ndjson: call record f -> g missing"; exit 11 }
+[ "$(wc -l < "$ND/a.ndjson")" -eq 3 ] || { echo "--format ndjson: unexpected lines on stdout"; exit 11 }
+[ ! -e "$ND/a.txt.dot" ] || { echo "--format ndjson: DOT written as well"; exit 11 }
+rm -rf "$ND"
+
+# input is read through a TSInput window rather than loaded whole; a pipe
+# must give the same CFGs as the file it streams
+PIPE=$(mktemp -d)
+printf 'method f()\nbegin\n  if x then g(); else h();\nend;\nmethod g()\nbegin\nend;\n' > "$PIPE/a.txt"
+./Lab2/lab2_cfg "$PIPE/a.txt" --outdir "$PIPE" > /dev/null
+cat "$PIPE/a.txt" | ./Lab2/lab2_cfg /dev/stdin --outdir "$PIPE" > /dev/null
+sed 's/file_stdin/file_a_txt/g' "$PIPE/stdin.dot" | diff - "$PIPE/a.txt.dot" || { echo "piped input: CFGs differ from file input"; exit 13 }
+rm -rf "$PIPE"
+
+# ast_dump from a saved flat AST (--save-flat, then --flat without parsing)
+# must give the same DOT as from the parse; a snapshot of another source is
+# refused
+FLAT=$(mktemp -d)
+clang -o "$FLAT/ast_dump" ast_dump.c Lab2/source_map.c Lab2/flat_ast.c Lab2/hash.c Lab2/arena.c Lab1/src/parser.c Lab1/src/scanner.c vendor/tree-sitter/lib/src/lib.c \
+  -I Lab2 -I vendor/tree-sitter/lib/include -I vendor/tree-sitter/lib/src
+"$FLAT/ast_dump" Lab1/examples/all_structures_and_expr.txt "$FLAT/parsed.dot" --save-flat "$FLAT/a.flat"
+"$FLAT/ast_dump" Lab1/examples/all_structures_and_expr.txt "$FLAT/mapped.dot" --flat "$FLAT/a.flat"
+diff "$FLAT/parsed.dot" "$FLAT/mapped.dot" || { echo "ast_dump --flat differs from the parse"; exit 18 }
+! "$FLAT/ast_dump" Lab1/examples/functions.txt "$FLAT/other.dot" --flat "$FLAT/a.flat" 2> /dev/null || { echo "ast_dump --flat: snapshot of another file accepted"; exit 18 }
+# same size, one byte changed: caught by the content hash
+{ printf 'X'; tail -c +2 Lab1/examples/all_structures_and_expr.txt } > "$FLAT/same_size.txt"
+! "$FLAT/ast_dump" "$FLAT/same_size.txt" "$FLAT/other.dot" --flat "$FLAT/a.flat" 2> /dev/null || { echo "ast_dump --flat: snapshot of an edited file accepted"; exit 18 }
+# lab2_cfg --flat builds the CFGs from the snapshot: same outputs as from the
+# parse, and the same refusals
+./Lab2/lab2_cfg Lab1/examples/all_structures_and_expr.txt --outdir "$FLAT/cfg_parsed" > /dev/null
+./Lab2/lab2_cfg Lab1/examples/all_structures_and_expr.txt --flat "$FLAT/a.flat" --outdir "$FLAT/cfg_mapped" > /dev/null || { echo "lab2_cfg --flat: snapshot rejected"; exit 18 }
+diff -r "$FLAT/cfg_parsed" "$FLAT/cfg_mapped" || { echo "lab2_cfg --flat differs from the parse"; exit 18 }
+! ./Lab2/lab2_cfg "$FLAT/same_size.txt" --flat "$FLAT/a.flat" --outdir "$FLAT/cfg_other" > /dev/null 2>&1 || { echo "lab2_cfg --flat: snapshot of an edited file accepted"; exit 18 }
+[ ! -e "$FLAT/cfg_other/same_size.txt.dot" ] || { echo "lab2_cfg --flat: output written from a refused snapshot"; exit 18 }
+rm -rf "$FLAT"
+
+# session_edit rebuilds only the functions an edit touches and keeps the
+# call graph in step
+SESS=$(mktemp -d)
+clang -o "$SESS/session_test" Lab2/session_test.c Lab2/session.c Lab2/flow.c Lab2/ir.c Lab2/callgraph.c Lab2/hash.c Lab2/node_kind.c Lab2/flat_ast.c Lab2/query.c Lab2/source_map.c Lab2/arena.c Lab1/src/parser.c Lab1/src/scanner.c vendor/tree-sitter/lib/src/lib.c \
+  -I Lab1/src -I Lab2 -I vendor/tree-sitter/lib/include -I vendor/tree-sitter/lib/src -lm
+"$SESS/session_test" || { echo "session: incremental rebuild check failed"; exit 19 }
+rm -rf "$SESS"
+
+# 10k nested loops must build without overflowing any stack and keep every loop
+DEEP=$(mktemp -d)
+{
+  echo "method deep()"
+  echo "begin"
+  awk 'BEGIN { for (i = 0; i < 10000; i++) print "while x do begin" }'
+  echo "break;"
+  awk 'BEGIN { for (i = 0; i < 10000; i++) print "end;" }'
+  echo "end;"
+} > "$DEEP/deep.txt"
+./Lab2/lab2_cfg "$DEEP/deep.txt" --outdir "$DEEP" > /dev/null
+LOOPS=$(grep -c 'while.cond' "$DEEP/deep.txt.dot" || true)
+[ "$LOOPS" -eq 10000 ] || { echo "deep nesting: expected 10000 loops, got $LOOPS"; exit 7 }
+rm -rf "$DEEP"
+
 echo "Sanity checks passed: DOT files generated in $OUT"
@@ -0,0 +1,311 @@
+#include "session.h"
+#include "query.h"
+#include <stdlib.h>
+#include <string.h>
+
+// functions are small; 64KB chunks per function would dominate memory
+#define SESSION_CHUNK_SIZE 4096
+// names are compacted once this many (and at least half of them) may be dead
+#define SESSION_COMPACT_MIN 64
+
+static TSPoint advance_point(TSPoint p, const char *s, uint32_t len) {
+  const char *end = s + len;
+  for (;;) {
+    const char *nl = memchr(s, '\n', (size_t)(end - s));
+    if (!nl) break;
+    p.row++;
+    p.column = 0;
+    s = nl + 1;
+  }
+  p.column += (uint32_t)(end - s);
+  return p;
+}
+
+// Point of byte `at` of the current text. Edits come close to each other, so
+// the walk starts at the point of the last edit (text before it did not
+// change) rather than at byte 0; an edit before it walks back to the mark and
+// then to the start of its line.
+static TSPoint point_at(const Session *s, uint32_t at) {
+  if (at >= s->mark_byte) return advance_point(s->mark_point, s->text + s->mark_byte, at - s->mark_byte);
+  TSPoint p = s->mark_point;
+  uint32_t i = s->mark_byte;
+  while (i > at) if (s->text[--i] == '\n') p.row--;
+  if (p.row == s->mark_point.row) {
+    p.column -= s->mark_byte - at;
+    return p;
+  }
+  uint32_t line = at;
+  while (line > 0 && s->text[line - 1] != '\n') line--;
+  p.column = at - line;
+  return p;
+}
+
+static void ensure_defs(Session *s) {
+  if (s->calls.n_names <= s->cap_defs) return;
+  int cap = (s->cap_defs == 0) ? 64 : s->cap_defs;
+  while (cap < s->calls.n_names) cap *= 2;
+  s->defs = realloc(s->defs, sizeof(int) * cap);
+  memset(s->defs + s->cap_defs, 0, sizeof(int) * (cap - s->cap_defs));
+  s->cap_defs = cap;
+}
+
+// add (sign = 1) or take back (sign = -1) a function's definition and calls.
+// Taking back drops edges left without calls; a name that loses its last
+// definition or an edge to it may be dead, and is counted in s->released.
+static void account_function(Session *s, const SessionFunction *f, int sign) {
+  s->defs[f->name_id] += sign;
+  if (s->defs[f->name_id] == 0) s->released++;
+  const FrozenCFG *cfg = f->cfg;
+  for (int k=0; k<cfg->n_calls; k++) {
+    if (sign > 0) {
+      int callee = callgraph_intern(&s->calls, cfg->calls[k].callee, cfg->calls[k].callee_len);
+      ensure_defs(s);
+      callgraph_add_call(&s->calls, f->name_id, callee, 1);
+    } else {
+      int callee = callgraph_find(&s->calls, cfg->calls[k].callee, cfg->calls[k].callee_len);
+      if (callee >= 0 && callgraph_drop_call(&s->calls, f->name_id, callee, 1)) s->released++;
+    }
+  }
+}
+
+// Drop the names that are neither defined nor called any more and renumber
+// the rest (SessionFunction.name_id, defs). Run once s->released passes
+// SESSION_COMPACT_MIN and half the names, so the cost, linear in names and
+// edges, is spread over the edits that released them.
+static void compact_names(Session *s) {
+  int n = s->calls.n_names;
+  unsigned char *keep = calloc((size_t)(n ? n : 1), 1);
+  int *remap = malloc(sizeof(int) * (n ? n : 1));
+  for (int id=0; id<n; id++) keep[id] = s->defs[id] > 0;
+  for (int p=0; p<s->calls.n_edges; p++) {
+    keep[s->calls.edges[p].caller] = 1;
+    keep[s->calls.edges[p].callee] = 1;
+  }
+  callgraph_compact(&s->calls, keep, remap);
+  // new ids are never above old ones, so defs moves down in place
+  for (int id=0; id<n; id++) if (remap[id] >= 0) s->defs[remap[id]] = s->defs[id];
+  memset(s->defs + s->calls.n_names, 0, sizeof(int) * (s->cap_defs - s->calls.n_names));
+  for (int i=0; i<s->n_funcs; i++) s->funcs[i].name_id = remap[s->funcs[i].name_id];
+  free(keep);
+  free(remap);
+  s->released = 0;
+}
+
+static void relocate(const char **p, const char *from, size_t len, const char *to) {
+  uintptr_t v = (uintptr_t)*p, lo = (uintptr_t)from;
+  if (v >= lo && v - lo <= len) *p = to + (v - lo);
+}
+
+// 0 on success; -1 if the CFG could not be built, with f released
+static int build_function(Session *s, TSNode node, SessionFunction *f) {
+  memset(f, 0, sizeof(*f));
+  arena_init_chunked(&f->arena, SESSION_CHUNK_SIZE);
+  f->start_byte = ts_node_start_byte(node);
+  f->end_byte = ts_node_end_byte(node);
+  char name[256];
+  CFG *cfg = NULL;
+  SourceText whole = { s->text, 0, s->len };
+  if (build_cfg_for_function(&f->arena, &whole, node, &cfg, name, sizeof(name), NULL) != 0 || !cfg) {
+    arena_free(&f->arena);
+    return -1;
+  }
+  f->cfg = cfg_freeze(cfg);
+  f->name = arena_strdup(&f->arena, name);
+
+  // move the CFG's text slices over to a private copy of the function
+  size_t len = f->end_byte - f->start_byte;
+  const char *from = s->text + f->start_byte;
+  char *copy = arena_strndup(&f->arena, from, len);
+  for (int i=0; i<f->cfg->ops_start[f->cfg->n_nodes]; i++) ir_relocate_stmt(&f->cfg->ops[i], from, len, copy);
+  for (int k=0; k<f->cfg->n_calls; k++) relocate(&f->cfg->calls[k].callee, from, len, copy);
+
+  f->name_id = callgraph_intern(&s->calls, f->name, strlen(f->name));
+  ensure_defs(s);
+  account_function(s, f, 1);
+  s->last_rebuilt++;
+  return 0;
+}
+
+static int overlaps(const TSRange *ranges, uint32_t n_ranges, uint32_t edit_start, uint32_t edit_end, uint32_t fs, uint32_t fe) {
+  // closed intervals: text inserted right at a function's edge counts as a change
+  if (edit_start <= fe && edit_end >= fs) return 1;
+  for (uint32_t i=0; i<n_ranges; i++) {
+    if (ranges[i].start_byte <= fe && ranges[i].end_byte >= fs) return 1;
+  }
+  return 0;
+}
+
+// index of the old function starting at `start` with length len, or -1
+static int find_old(const SessionFunction *old, int n_old, uint32_t start, uint32_t len) {
+  int lo = 0, hi = n_old - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (old[mid].start_byte < start) lo = mid + 1;
+    else if (old[mid].start_byte > start) hi = mid - 1;
+    else return (old[mid].end_byte - old[mid].start_byte == len) ? mid : -1;
+  }
+  return -1;
+}
+
+static void reserve_funcs(Session *s, int n) {
+  if (n <= s->cap_funcs) return;
+  int cap = (s->cap_funcs == 0) ? 16 : s->cap_funcs;
+  while (cap < n) cap *= 2;
+  s->funcs = realloc(s->funcs, sizeof(SessionFunction) * cap);
+  s->cap_funcs = cap;
+}
+
+// Bring the function list in line with the current tree. The edit replaced
+// [edit_start, edit_start + delta_old) by [edit_start, edit_end) and shifted
+// everything after it by delta. Only the window spanning the edit and the
+// changed ranges is queried: old functions wholly before it stay where they
+// are, those wholly after it only move by delta. Inside the window an
+// unchanged funcDef takes over the old function with the same text (found by
+// its pre-edit offset), the others are built.
+static void sync_functions(Session *s, const TSRange *ranges, uint32_t n_ranges, uint32_t edit_start, uint32_t edit_end, int64_t delta) {
+  s->last_rebuilt = 0;
+  uint32_t lo = edit_start, hi = edit_end;
+  for (uint32_t i=0; i<n_ranges; i++) {
+    if (ranges[i].start_byte < lo) lo = ranges[i].start_byte;
+    if (ranges[i].end_byte > hi) hi = ranges[i].end_byte;
+  }
+  // old[p, q) touch the window (closed intervals, as in overlaps())
+  int p = 0;
+  while (p < s->n_funcs && s->funcs[p].end_byte < lo) p++;
+  int q = p;
+  while (q < s->n_funcs && (int64_t)s->funcs[q].start_byte + delta <= (int64_t)hi) q++;
+  SessionFunction *old = s->funcs + p;
+  int n_old = q - p;
+  char *kept = calloc((size_t)(n_old ? n_old : 1), 1);
+  SessionFunction *mid = NULL;
+  int n_mid = 0, cap_mid = 0;
+
+  TSQueryCursor *qc = ts_query_cursor_new();
+  ts_query_cursor_set_max_start_depth(qc, QUERY_FUNCTION_DEPTH);
+  // a node matches when end > start and start < end of the byte range, so
+  // widen by one byte on both sides to also get funcDefs touching the window
+  ts_query_cursor_set_byte_range(qc, lo > 0 ? lo - 1 : 0, hi + 1);
+  ts_query_cursor_exec(qc, lab2_query, ts_tree_root_node(s->tree));
+  TSQueryMatch m;
+  while (ts_query_cursor_next_match(qc, &m)) {
+    if (m.pattern_index != QP_FUNCTION) continue;
+    TSNode node = (TSNode){0};
+    for (int c=0; c<m.capture_count; c++)
+      if (query_capture(m.captures[c].index) == QC_FUNCTION) node = m.captures[c].node;
+    if (n_mid + 1 > cap_mid) {
+      cap_mid = (cap_mid == 0) ? 4 : cap_mid * 2;
+      mid = realloc(mid, sizeof(SessionFunction) * cap_mid);
+    }
+    SessionFunction *f = &mid[n_mid];
+    uint32_t fs = ts_node_start_byte(node), fe = ts_node_end_byte(node);
+    int reuse = -1;
+    uint32_t old_fs = fs;
+    if (!overlaps(ranges, n_ranges, edit_start, edit_end, fs, fe)) {
+      if (fs >= edit_end) old_fs = (uint32_t)((int64_t)fs - delta);
+      reuse = find_old(old, n_old, old_fs, fe - fs);
+      if (reuse >= 0 && kept[reuse]) reuse = -1;
+    }
+    if (reuse >= 0) {
+      *f = old[reuse];
+      kept[reuse] = 1;
+      f->shift += (int64_t)fs - old_fs;
+      f->start_byte = fs;
+      f->end_byte = fe;
+      n_mid++;
+    } else if (build_function(s, node, f) == 0) {
+      n_mid++;
+    }
+  }
+  ts_query_cursor_delete(qc);
+
+  for (int i=0; i<n_old; i++) {
+    if (kept[i]) continue;
+    account_function(s, &old[i], -1);
+    arena_free(&old[i].arena);
+  }
+  free(kept);
+
+  // splice: old[p, q) becomes mid, the tail moves by delta
+  int n_tail = s->n_funcs - q;
+  reserve_funcs(s, p + n_mid + n_tail);
+  memmove(s->funcs + p + n_mid, s->funcs + q, sizeof(SessionFunction) * n_tail);
+  if (n_mid > 0) memcpy(s->funcs + p, mid, sizeof(SessionFunction) * n_mid);
+  s->n_funcs = p + n_mid + n_tail;
+  for (int i=p + n_mid; i<s->n_funcs; i++) {
+    SessionFunction *f = &s->funcs[i];
+    f->start_byte = (uint32_t)((int64_t)f->start_byte + delta);
+    f->end_byte = (uint32_t)((int64_t)f->end_byte + delta);
+    f->shift += delta;
+  }
+  free(mid);
+  if (s->released > SESSION_COMPACT_MIN && s->released * 2 > s->calls.n_names) compact_names(s);
+}
+
+static void reserve_text(Session *s, uint32_t len) {
+  if (len + 1 <= s->cap) return;
+  uint32_t cap = (s->cap == 0) ? 4096 : s->cap;
+  while (cap < len + 1) cap *= 2;
+  s->text = realloc(s->text, cap);
+  s->cap = cap;
+}
+
+int session_open(Session *s, const TSLanguage *lang, const char *text, uint32_t len) {
+  memset(s, 0, sizeof(*s));
+  callgraph_init(&s->calls);
+  s->parser = ts_parser_new();
+  if (!ts_parser_set_language(s->parser, lang)) return -1;
+  reserve_text(s, len);
+  memcpy(s->text, text, len);
+  s->text[len] = '\0';
+  s->len = len;
+  s->tree = ts_parser_parse_string(s->parser, NULL, s->text, s->len);
+  if (!s->tree) return -1;
+  sync_functions(s, NULL, 0, 0, s->len, 0);
+  return 0;
+}
+
+int session_edit(Session *s, uint32_t start, uint32_t old_end, const char *new_text, uint32_t new_len) {
+  if (!s->tree || start > old_end || old_end > s->len) return -1;
+  TSInputEdit edit;
+  edit.start_byte = start;
+  edit.old_end_byte = old_end;
+  edit.new_end_byte = start + new_len;
+  edit.start_point = point_at(s, start);
+  edit.old_end_point = advance_point(edit.start_point, s->text + start, old_end - start);
+  edit.new_end_point = advance_point(edit.start_point, new_text, new_len);
+
+  uint32_t len = s->len - (old_end - start) + new_len;
+  reserve_text(s, len);
+  memmove(s->text + start + new_len, s->text + old_end, s->len - old_end);
+  memcpy(s->text + start, new_text, new_len);
+  s->len = len;
+  s->text[len] = '\0';
+  s->mark_byte = start;
+  s->mark_point = edit.start_point;
+
+  ts_tree_edit(s->tree, &edit);
+  TSTree *tree = ts_parser_parse_string(s->parser, s->tree, s->text, s->len);
+  if (!tree) return -1;
+  uint32_t n_ranges = 0;
+  TSRange *ranges = ts_tree_get_changed_ranges(s->tree, tree, &n_ranges);
+  ts_tree_delete(s->tree);
+  s->tree = tree;
+  sync_functions(s, ranges, n_ranges, start, start + new_len, (int64_t)new_len - (int64_t)(old_end - start));
+  free(ranges);
+  return 0;
+}
+
+int session_edge_live(const Session *s, const CallEdge *e) {
+  return s->defs[e->callee] > 0;
+}
+
+void session_close(Session *s) {
+  for (int i=0; i<s->n_funcs; i++) arena_free(&s->funcs[i].arena);
+  free(s->funcs);
+  free(s->defs);
+  free(s->text);
+  callgraph_free(&s->calls);
+  if (s->tree) ts_tree_delete(s->tree);
+  if (s->parser) ts_parser_delete(s->parser);
+  memset(s, 0, sizeof(*s));
+}
@@ -0,0 +1,69 @@
+#ifndef LAB2_SESSION_H
+#define LAB2_SESSION_H
+
+#include <stdint.h>
+#include <tree_sitter/api.h>
+#include "arena.h"
+#include "flow.h"
+#include "callgraph.h"
+
+// Incremental analysis of one source text, for editor tooling. A session
+// keeps the last TSTree, one CFG per funcDef and the call graph. An edit is
+// applied with ts_tree_edit, the text is re-parsed against the old tree, and
+// only the functions that overlap the edit or a range reported by
+// ts_tree_get_changed_ranges are rebuilt; the others are kept as they are.
+// Only the part of the tree between the first and last changed byte is
+// queried for functions. A funcDef whose CFG cannot be built is left out.
+//
+// Each function owns a small arena holding its CFG and a private copy of its
+// source text, so kept functions never point into a buffer that has since
+// changed. Byte offsets inside the CFG (IrExpr.start_byte, CallSite.byte)
+// are those of the text the function was built from: add `shift` to get
+// offsets in the current text.
+//
+// node_kinds_init() and queries_init() must have been called for lang before
+// session_open().
+typedef struct SessionFunction {
+  char *name;           /* in arena */
+  int name_id;          /* id in Session.calls */
+  uint32_t start_byte;  /* funcDef range in the current text */
+  uint32_t end_byte;
+  int64_t shift;
+  Arena arena;
+  FrozenCFG *cfg;
+} SessionFunction;
+
+typedef struct Session {
+  TSParser *parser;
+  TSTree *tree;
+  char *text;
+  uint32_t len;
+  uint32_t cap;
+  SessionFunction *funcs; /* in source order */
+  int n_funcs;
+  int cap_funcs;
+  // calls of every function, by name. Callees are interned whether or not
+  // they are defined: use session_edge_live() to filter. An edge whose count
+  // drops to 0 is removed (edge order is not kept), and names that are
+  // neither defined nor called are dropped now and then, which renumbers
+  // the name ids: look names up again after an edit.
+  CallGraph calls;
+  int *defs;            /* per name id: number of functions with that name */
+  int cap_defs;
+  int released;         /* names that may have died since the last compaction */
+  int last_rebuilt;     /* functions built by the last open/edit */
+  uint32_t mark_byte;   /* start of the last edit and its point: */
+  TSPoint mark_point;   /* positions of later edits are found from here */
+} Session;
+
+// parse text and build every function; 0 on success, -1 on failure. Call
+// session_close() in either case.
+int session_open(Session *s, const TSLanguage *lang, const char *text, uint32_t len);
+// replace bytes [start, old_end) of the text with new_text[0..new_len);
+// 0 on success, -1 on a bad range or a failed parse
+int session_edit(Session *s, uint32_t start, uint32_t old_end, const char *new_text, uint32_t new_len);
+// 1 if the callee of e is a function of the text
+int session_edge_live(const Session *s, const CallEdge *e);
+void session_close(Session *s);
+
+#endif
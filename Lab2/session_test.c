@@ -0,0 +1,108 @@
+// Checks of the incremental session API (session.h), run by run_tests.sh:
+// an edit rebuilds only the functions it touches, keeps the others (moved
+// when text before them changed) and updates the call edges; dead edges and
+// names do not pile up.
+#include "session.h"
+#include "node_kind.h"
+#include "query.h"
+#include <stdio.h>
+#include <string.h>
+
+const TSLanguage *tree_sitter_v2lang_test(void);
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { fprintf(stderr, "session_test:%d: %s\n", __LINE__, #cond); failures++; } } while (0)
+
+static const SessionFunction *find_function(const Session *s, const char *name) {
+  for (int i=0; i<s->n_funcs; i++) if (strcmp(s->funcs[i].name, name) == 0) return &s->funcs[i];
+  return NULL;
+}
+
+// calls from caller to callee that are still made, or -1 without an edge
+static int calls(const Session *s, const char *caller, const char *callee) {
+  int a = callgraph_find(&s->calls, caller, strlen(caller));
+  int b = callgraph_find(&s->calls, callee, strlen(callee));
+  for (int p=0; a >= 0 && b >= 0 && p<s->calls.n_edges; p++) {
+    const CallEdge *e = &s->calls.edges[p];
+    if (e->caller == a && e->callee == b) return e->count;
+  }
+  return -1;
+}
+
+static uint32_t offset_of(const Session *s, const char *needle) {
+  const char *p = strstr(s->text, needle);
+  return p ? (uint32_t)(p - s->text) : 0;
+}
+
+int main(void) {
+  if (node_kinds_init(tree_sitter_v2lang_test()) != 0) return 1;
+  if (queries_init(tree_sitter_v2lang_test()) != 0) return 1;
+
+  const char *text =
+    "method f()\nbegin\n  g();\nend;\n"
+    "method g()\nbegin\n  h();\nend;\n\n"
+    "method h()\nbegin\nend;\n";
+  Session s;
+  CHECK(session_open(&s, tree_sitter_v2lang_test(), text, (uint32_t)strlen(text)) == 0);
+  CHECK(s.n_funcs == 3 && s.last_rebuilt == 3);
+  CHECK(calls(&s, "f", "g") == 1 && calls(&s, "g", "h") == 1);
+  const FrozenCFG *f_cfg = find_function(&s, "f")->cfg;
+  const FrozenCFG *g_cfg = find_function(&s, "g")->cfg;
+  const FrozenCFG *h_cfg = find_function(&s, "h")->cfg;
+
+  // g now calls f instead of h: only g is rebuilt
+  uint32_t at = offset_of(&s, "h();");
+  CHECK(session_edit(&s, at, at + 1, "f", 1) == 0);
+  CHECK(s.n_funcs == 3 && s.last_rebuilt == 1);
+  CHECK(find_function(&s, "f")->cfg == f_cfg);
+  CHECK(find_function(&s, "g")->cfg != g_cfg);
+  CHECK(find_function(&s, "h")->cfg == h_cfg);
+  // the edge g -> h lost its last call and is gone
+  CHECK(calls(&s, "g", "h") == -1 && calls(&s, "g", "f") == 1);
+
+  // a blank line between g and h moves h without rebuilding anything
+  uint32_t h_start = find_function(&s, "h")->start_byte;
+  at = offset_of(&s, "\n\nmethod h") + 1;
+  CHECK(session_edit(&s, at, at, "\n", 1) == 0);
+  CHECK(s.n_funcs == 3 && s.last_rebuilt == 0);
+  const SessionFunction *h = find_function(&s, "h");
+  CHECK(h->cfg == h_cfg && h->start_byte == h_start + 1 && h->shift == 1);
+
+  // renaming f drops its definition; the call from g is no longer live
+  at = offset_of(&s, "method f") + 7;
+  CHECK(session_edit(&s, at, at + 1, "k", 1) == 0);
+  CHECK(s.n_funcs == 3 && s.last_rebuilt == 1);
+  CHECK(find_function(&s, "f") == NULL && find_function(&s, "k") != NULL);
+  int gf = -1;
+  for (int p=0; p<s.calls.n_edges; p++) {
+    const CallEdge *e = &s.calls.edges[p];
+    if (strcmp(s.calls.names[e->caller], "g") == 0 && strcmp(s.calls.names[e->callee], "f") == 0) gf = p;
+  }
+  CHECK(gf >= 0 && !session_edge_live(&s, &s.calls.edges[gf]));
+  CHECK(calls(&s, "k", "g") == 1);
+
+  // renaming h again and again leaves dead names behind; they are compacted
+  // away, and the ids of the live ones still match their functions
+  char cur[16] = "h", next[16];
+  for (int i=0; i<300; i++) {
+    at = find_function(&s, cur)->start_byte + 7;
+    snprintf(next, sizeof(next), "h%d", i);
+    CHECK(session_edit(&s, at, at + (uint32_t)strlen(cur), next, (uint32_t)strlen(next)) == 0);
+    strcpy(cur, next);
+  }
+  CHECK(s.n_funcs == 3 && find_function(&s, cur) != NULL);
+  CHECK(s.calls.n_names < 100);
+  for (int i=0; i<s.n_funcs; i++) CHECK(strcmp(s.calls.names[s.funcs[i].name_id], s.funcs[i].name) == 0);
+  CHECK(calls(&s, "k", "g") == 1 && calls(&s, "g", "f") == 1);
+  gf = -1;
+  for (int p=0; p<s.calls.n_edges; p++) {
+    const CallEdge *e = &s.calls.edges[p];
+    if (strcmp(s.calls.names[e->caller], "g") == 0 && strcmp(s.calls.names[e->callee], "f") == 0) gf = p;
+  }
+  CHECK(gf >= 0 && !session_edge_live(&s, &s.calls.edges[gf]));
+
+  session_close(&s);
+  if (failures == 0) printf("session_test: ok\n");
+  return failures ? 1 : 0;
+}
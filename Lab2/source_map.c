@@ -0,0 +1,177 @@
+#include "source_map.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// fallback for pipes, ttys, /dev/stdin, ...: read until EOF into a heap buffer
+static int read_all(int fd, SourceMap *out) {
+  size_t cap = 1 << 16, n = 0;
+  char *buf = malloc(cap);
+  if (!buf) return -1;
+  for (;;) {
+    if (n == cap) {
+      char *nb = realloc(buf, cap * 2);
+      if (!nb) { free(buf); errno = ENOMEM; return -1; }
+      buf = nb; cap *= 2;
+    }
+    ssize_t r = read(fd, buf + n, cap - n);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      int saved = errno; free(buf); errno = saved;
+      return -1;
+    }
+    if (r == 0) break;
+    n += (size_t)r;
+  }
+  if (n == 0) { free(buf); out->data = ""; return 0; }
+  out->data = buf;
+  out->len = n;
+  out->mapped = 0;
+  return 0;
+}
+
+int source_map_open(const char *path, SourceMap *out) {
+  out->data = NULL; out->len = 0; out->mapped = 0;
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return -1;
+  struct stat st;
+  if (fstat(fd, &st) != 0) { int saved = errno; close(fd); errno = saved; return -1; }
+  if (S_ISREG(st.st_mode)) {
+    if (st.st_size == 0) { out->data = ""; close(fd); return 0; }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+      close(fd);
+      out->data = p;
+      out->len = (size_t)st.st_size;
+      out->mapped = 1;
+      return 0;
+    }
+  }
+  int rc = read_all(fd, out);
+  int saved = errno;
+  close(fd);
+  errno = saved;
+  return rc;
+}
+
+void source_map_close(SourceMap *m) {
+  if (!m || !m->data) return;
+  if (m->mapped) munmap((void *)m->data, m->len);
+  else if (m->len > 0) free((void *)m->data);
+  m->data = NULL; m->len = 0; m->mapped = 0;
+}
+
+int source_reader_open(SourceReader *r, const char *path) {
+  memset(r, 0, sizeof(*r));
+  r->fd = open(path, O_RDONLY);
+  if (r->fd < 0) return -1;
+  struct stat st;
+  if (fstat(r->fd, &st) != 0) { int saved = errno; close(r->fd); errno = saved; return -1; }
+  if (!S_ISREG(st.st_mode)) {
+    close(r->fd);
+    r->fd = -1;
+    if (source_map_open(path, &r->mem) != 0) return -1;
+    if (r->mem.len > UINT32_MAX) { source_map_close(&r->mem); errno = EFBIG; return -1; }
+    r->size = (uint32_t)r->mem.len;
+    return 0;
+  }
+  if ((uint64_t)st.st_size > UINT32_MAX) { close(r->fd); r->fd = -1; errno = EFBIG; return -1; }
+  r->size = (uint32_t)st.st_size;
+#ifdef POSIX_FADV_SEQUENTIAL
+  // the parser reads the file front to back
+  posix_fadvise(r->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+  return 0;
+}
+
+void source_reader_close(SourceReader *r) {
+  if (r->fd >= 0) close(r->fd);
+  if (!r->shared) source_map_close(&r->mem);
+  free(r->buf);
+  memset(r, 0, sizeof(*r));
+  r->fd = -1;
+}
+
+int source_reader_clone(const SourceReader *r, SourceReader *out) {
+  memset(out, 0, sizeof(*out));
+  out->size = r->size;
+  if (r->fd < 0) {
+    out->fd = -1;
+    out->mem = r->mem;
+    out->shared = 1;
+    return 0;
+  }
+  // pread() does not move the file offset, but each reader closes its own fd
+  out->fd = dup(r->fd);
+  return (out->fd >= 0) ? 0 : -1;
+}
+
+// Load a window of at least SOURCE_READER_WINDOW bytes covering [start, end)
+// (less at the ends of the input). Going backwards the window ends at `end`,
+// so a reverse scan over the functions still reads each byte about once.
+static int fill_window(SourceReader *r, uint32_t start, uint32_t end, int backward) {
+  size_t want = end - start;
+  if (want < SOURCE_READER_WINDOW) want = SOURCE_READER_WINDOW;
+  uint32_t from = start;
+  if (backward) from = (end > want) ? (uint32_t)(end - want) : 0;
+  if (want > (size_t)(r->size - from)) want = r->size - from;
+  if (want > r->cap) {
+    char *nb = realloc(r->buf, want);
+    if (!nb) { r->error = ENOMEM; return -1; }
+    r->buf = nb;
+    r->cap = want;
+  }
+  size_t n = 0;
+  while (n < want) {
+    ssize_t got = pread(r->fd, r->buf + n, want - n, (off_t)from + (off_t)n);
+    if (got < 0 && errno == EINTR) continue;
+    if (got <= 0) {
+      // the file shrank or the read failed: keep what we have
+      if (!r->error) r->error = (got < 0) ? errno : EIO;
+      break;
+    }
+    n += (size_t)got;
+  }
+  r->win_start = from;
+  r->win_len = n;
+  return ((uint64_t)end <= (uint64_t)from + n) ? 0 : -1;
+}
+
+static const char *reader_read(void *payload, uint32_t byte, TSPoint position, uint32_t *bytes_read) {
+  SourceReader *r = payload;
+  (void)position;
+  *bytes_read = 0;
+  if (byte >= r->size) return "";
+  if (r->fd < 0) { *bytes_read = r->size - byte; return r->mem.data + byte; }
+  if (byte < r->win_start || byte - r->win_start >= r->win_len) {
+    if (fill_window(r, byte, byte + 1, 0) != 0) return "";
+  }
+  *bytes_read = (uint32_t)(r->win_len - (byte - r->win_start));
+  return r->buf + (byte - r->win_start);
+}
+
+TSInput source_reader_input(SourceReader *r) {
+  TSInput in;
+  memset(&in, 0, sizeof(in));
+  in.payload = r;
+  in.read = reader_read;
+  in.encoding = TSInputEncodingUTF8;
+  return in;
+}
+
+int source_reader_text(SourceReader *r, uint32_t start, uint32_t end, SourceText *out) {
+  if (end > r->size) end = r->size;
+  if (start > end) start = end;
+  out->base = start;
+  out->len = end - start;
+  if (r->fd < 0) { out->data = r->mem.data + start; return 0; }
+  if (start < r->win_start || (uint64_t)end > (uint64_t)r->win_start + r->win_len) {
+    if (fill_window(r, start, end, start < r->win_start) != 0) return -1;
+  }
+  out->data = r->buf ? r->buf + (start - r->win_start) : "";
+  return 0;
+}
@@ -0,0 +1,67 @@
+#ifndef LAB2_SOURCE_MAP_H
+#define LAB2_SOURCE_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tree_sitter/api.h>
+
+// Read-only view of a whole file: the CFG cache entries, --emit-bin artifacts
+// and flat AST snapshots, which are used in place and read out of order, and
+// piped input of a SourceReader. Inputs to parse go through SourceReader.
+// Regular files are mmap'ed; pipes and special files (or a failed mmap) fall
+// back to read(). data is NOT NUL-terminated, always use len.
+typedef struct SourceMap {
+  const char *data;
+  size_t len;
+  int mapped; /* 1: data is an mmap'ed region, 0: heap buffer (or empty) */
+} SourceMap;
+
+// returns 0 on success, -1 on error (errno is set)
+int source_map_open(const char *path, SourceMap *out);
+void source_map_close(SourceMap *m);
+
+// Bytes [base, base + len) of an input. Builders take node offsets in the
+// whole input and turn them into pointers with source_text_at(), so a
+// SourceText can cover a single function instead of the whole file.
+typedef struct SourceText {
+  const char *data;
+  uint32_t base;
+  uint32_t len;
+} SourceText;
+
+static inline const char *source_text_at(const SourceText *t, uint32_t offset) {
+  return t->data + (offset - t->base);
+}
+
+// Reads an input through a bounded window, for parsing with a TSInput
+// callback and fetching text on demand instead of holding the whole file.
+// Regular files are read with pread(); pipes and other special files must be
+// read to the end first and are kept in memory (via source_map_open).
+// Tree-sitter offsets are 32-bit, so inputs of 4 GiB or more are refused.
+typedef struct SourceReader {
+  int fd;             /* -1: the input is in `mem` */
+  SourceMap mem;
+  uint32_t size;
+  char *buf;          /* window: bytes [win_start, win_start + win_len) */
+  size_t cap;
+  uint32_t win_start;
+  size_t win_len;
+  int error;          /* errno of the first failed read, 0 if none */
+  int shared;         /* `mem` belongs to the reader this one was cloned from */
+} SourceReader;
+
+#define SOURCE_READER_WINDOW (1u << 20)
+
+// 0 on success, -1 on error (errno is set; EFBIG for inputs over the limit)
+int source_reader_open(SourceReader *r, const char *path);
+void source_reader_close(SourceReader *r);
+// A reader over the same input with its own window, for another thread.
+// In-memory input is shared, so close the clone first. 0 on success.
+int source_reader_clone(const SourceReader *r, SourceReader *out);
+// for ts_parser_parse(); reads past the end return no bytes
+TSInput source_reader_input(SourceReader *r);
+// Bytes [start, end) of the input, valid until the next call on r (the
+// window grows when the range is larger). 0 on success, -1 on a read error.
+int source_reader_text(SourceReader *r, uint32_t start, uint32_t end, SourceText *out);
+
+#endif
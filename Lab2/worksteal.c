@@ -0,0 +1,65 @@
+#include "worksteal.h"
+#include <stdlib.h>
+
+void worksteal_init(WorkSteal *ws, int n_workers) {
+  pthread_mutex_init(&ws->mu, NULL);
+  pthread_cond_init(&ws->cv, NULL);
+  ws->n_workers = (n_workers > 0) ? n_workers : 1;
+  ws->ranges = calloc((size_t)ws->n_workers, sizeof(WorkRange));
+  ws->closed = 0;
+}
+
+void worksteal_destroy(WorkSteal *ws) {
+  free(ws->ranges);
+  ws->ranges = NULL;
+  pthread_cond_destroy(&ws->cv);
+  pthread_mutex_destroy(&ws->mu);
+}
+
+void worksteal_push(WorkSteal *ws, int lo, int hi) {
+  pthread_mutex_lock(&ws->mu);
+  int n = ws->n_workers;
+  int total = hi - lo;
+  for (int w=0; w<n; w++) {
+    // contiguous shares, so neighbouring functions stay on one worker
+    ws->ranges[w].lo = lo + (int)((long long)total * w / n);
+    ws->ranges[w].hi = lo + (int)((long long)total * (w + 1) / n);
+  }
+  pthread_cond_broadcast(&ws->cv);
+  pthread_mutex_unlock(&ws->mu);
+}
+
+// take from the front of w's range, else move the upper half of the largest
+// range over to w; -1 if every range is empty. mu must be held.
+static int take_locked(WorkSteal *ws, int w) {
+  WorkRange *own = &ws->ranges[w];
+  if (own->lo < own->hi) return own->lo++;
+  int victim = -1, best = 0;
+  for (int v=0; v<ws->n_workers; v++) {
+    int left = ws->ranges[v].hi - ws->ranges[v].lo;
+    if (left > best) { best = left; victim = v; }
+  }
+  if (victim < 0) return -1;
+  WorkRange *r = &ws->ranges[victim];
+  int mid = r->hi - (best + 1) / 2;  // a single task left goes to the thief
+  own->lo = mid;
+  own->hi = r->hi;
+  r->hi = mid;
+  return own->lo++;
+}
+
+int worksteal_next(WorkSteal *ws, int w) {
+  pthread_mutex_lock(&ws->mu);
+  int idx;
+  while ((idx = take_locked(ws, w)) < 0 && !ws->closed)
+    pthread_cond_wait(&ws->cv, &ws->mu);
+  pthread_mutex_unlock(&ws->mu);
+  return idx;
+}
+
+void worksteal_close(WorkSteal *ws) {
+  pthread_mutex_lock(&ws->mu);
+  ws->closed = 1;
+  pthread_cond_broadcast(&ws->cv);
+  pthread_mutex_unlock(&ws->mu);
+}
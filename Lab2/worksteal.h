@@ -0,0 +1,34 @@
+#ifndef LAB2_WORKSTEAL_H
+#define LAB2_WORKSTEAL_H
+
+#include <pthread.h>
+
+// Work-stealing scheduler over integer task indices. A pushed range is split
+// evenly across the workers; each worker takes indices from the front of its
+// own range, and a worker whose range is empty steals the upper half of the
+// largest remaining range, so a worker that drew a few huge tasks does not
+// hold up the others. Tasks are expected to be coarse (a whole function), so
+// one mutex guards all ranges.
+typedef struct WorkRange {
+  int lo;
+  int hi;
+} WorkRange;
+
+typedef struct WorkSteal {
+  pthread_mutex_t mu;
+  pthread_cond_t cv;
+  WorkRange *ranges;  /* per worker */
+  int n_workers;
+  int closed;
+} WorkSteal;
+
+void worksteal_init(WorkSteal *ws, int n_workers);
+void worksteal_destroy(WorkSteal *ws);
+// hand out the indices [lo, hi); the previous range should be used up
+void worksteal_push(WorkSteal *ws, int lo, int hi);
+// next index for worker w, waiting while there is none; -1 once closed and empty
+int worksteal_next(WorkSteal *ws, int w);
+// wake all workers; worksteal_next() returns -1 when nothing is left
+void worksteal_close(WorkSteal *ws);
+
+#endif
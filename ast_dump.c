@@ -1,31 +1,15 @@
 // ast_dump.c — вывод AST в формате DOT (Graphviz)
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <tree_sitter/api.h>
+#include "source_map.h"
+#include "flat_ast.h"
 
 // объявление функции языка (из grammar.js → name: 'v2lang_test')
 const TSLanguage *tree_sitter_v2lang_test(void);
 
-// читает весь файл в память
-static char* read_file(const char *path, size_t *out_len) {
-    FILE *f = fopen(path, "rb");
-    if (!f) { perror("fopen"); return NULL; }
-    if (fseek(f, 0, SEEK_END) != 0) { perror("fseek"); fclose(f); return NULL; }
-    long n = ftell(f);
-    if (n < 0) { perror("ftell"); fclose(f); return NULL; }
-    if (fseek(f, 0, SEEK_SET) != 0) { perror("fseek"); fclose(f); return NULL; }
-
-    char *buf = (char*)malloc((size_t)n + 1);
-    if (!buf) { perror("malloc"); fclose(f); return NULL; }
-
-    size_t rd = fread(buf, 1, (size_t)n, f);
-    fclose(f);
-    buf[rd] = '\0';
-    if (out_len) *out_len = rd;
-    return buf;
-}
-
 // экранируем кавычки и странные символы для DOT-лейбла
 static void print_label_escaped(FILE *out, const char *s) {
     fputc('"', out);
@@ -40,25 +24,29 @@ static void print_label_escaped(FILE *out, const char *s) {
     fputc('"', out);
 }
 
-// рекурсивный обход AST и генерация узлов/рёбер
-static void dump_node_dot(FILE *out, TSNode node, int parent_id, int *next_id, const char *source) {
-    int my_id = (*next_id)++;
-
-    const char *type = ts_node_type(node);
+// вершина i плоского AST в формате DOT: лейбл, подсветка и ребро от
+// родителя с подписью — именем поля, под которым узел записан у родителя
+// (left, operator, ...), если оно есть
+static void dump_node_dot(FILE *out, const FlatAst *ast, uint32_t i, uint32_t parent, SourceReader *source) {
+    const FlatNode *node = &ast->nodes[i];
+    const char *type = flat_type(ast, i);
+    const char *field = flat_field_name(ast, i);
 
-    // вывод вершины
-    fprintf(out, "  n%d [label=", my_id);
+    // вывод вершины; её номер — индекс в прямом порядке обхода
+    fprintf(out, "  n%u [label=", i);
     // если узел — лист, добавляем текст токена для выбранных типов: short: text
-    uint32_t child_count = ts_node_child_count(node);
-    if (child_count == 0) {
-        uint32_t start = ts_node_start_byte(node);
-        uint32_t end = ts_node_end_byte(node);
-        size_t len = (end > start) ? (end - start) : 0;
+    if (node->size == 1) {
+        uint32_t start = node->start_byte;
+        uint32_t end = node->end_byte;
+        // текст листа дочитывается из файла по требованию
+        SourceText text;
+        if (source_reader_text(source, start, end, &text) != 0) text.len = 0;
+        size_t len = text.len;
         // буфер для текста токена (ограничим разумно)
         size_t buf_len = len + 1 + 32;
         char *buf = (char*)malloc(buf_len);
         if (buf) {
-            if (len > 0) memcpy(buf, source + start, len);
+            if (len > 0) memcpy(buf, text.data, len);
             buf[len] = '\0';
             // показываем текст только для некоторых типов и сокращаем имя
             const char *short_name = NULL;
@@ -102,65 +90,135 @@ static void dump_node_dot(FILE *out, TSNode node, int parent_id, int *next_id, c
     }
     fprintf(out, "];\n");
     // если есть родитель — вывод ребра parent -> this
-    if (parent_id >= 0) {
-        fprintf(out, "  n%d -> n%d;\n", parent_id, my_id);
+    if (parent != FLAT_NONE && field) {
+        fprintf(out, "  n%u -> n%u [label=", parent, i);
+        print_label_escaped(out, field);
+        fprintf(out, "];\n");
+    } else if (parent != FLAT_NONE) {
+        fprintf(out, "  n%u -> n%u;\n", parent, i);
     }
+}
 
-    // обходим детей
-    for (uint32_t i = 0; i < child_count; ++i) {
-        TSNode child = ts_node_child(node, i);
-        dump_node_dot(out, child, my_id, next_id, source);
+// Обход без рекурсии: узлы уже лежат в прямом порядке, так что достаточно
+// стека открытых предков — предок закрывается, когда индекс выходит за его
+// поддерево (i >= p + size).
+static void dump_ast_dot(FILE *out, const FlatAst *ast, SourceReader *source) {
+    uint32_t *open = malloc(sizeof(uint32_t) * (ast->n ? ast->n : 1));
+    uint32_t depth = 0;
+    for (uint32_t i = 0; i < ast->n; ++i) {
+        while (depth > 0 && i >= open[depth - 1] + ast->nodes[open[depth - 1]].size) depth--;
+        dump_node_dot(out, ast, i, depth > 0 ? open[depth - 1] : FLAT_NONE, source);
+        if (ast->nodes[i].size > 1) open[depth++] = i;
     }
+    free(open);
 }
 
 int main(int argc, char **argv) {
+    const char *usage = "usage: %s <input.v2> <output.dot> [--save-flat <file.flat> | --flat <file.flat>]\n";
     if (argc < 3) {
-        fprintf(stderr, "usage: %s <input.v2> <output.dot>\n", argv[0]);
+        fprintf(stderr, usage, argv[0]);
         return 1;
     }
 
     const char *input_path = argv[1];
     const char *output_path = argv[2];
+    const char *save_path = NULL;  // --save-flat: записать плоский AST после разбора
+    const char *flat_path = NULL;  // --flat: взять готовый плоский AST вместо разбора
+    for (int i = 3; i < argc; ++i) {
+        if (strcmp(argv[i], "--save-flat") == 0 && i + 1 < argc) save_path = argv[++i];
+        else if (strcmp(argv[i], "--flat") == 0 && i + 1 < argc) flat_path = argv[++i];
+        else { fprintf(stderr, usage, argv[0]); return 1; }
+    }
 
-    size_t len = 0;
-    char *source = read_file(input_path, &len);
-    if (!source) return 2;
+    // парсер читает файл через окно ограниченного размера (TSInput),
+    // целиком в память он не загружается; тексты листьев тоже читаются из него
+    SourceReader rd;
+    if (source_reader_open(&rd, input_path) != 0) { perror(input_path); return 2; }
+
+    FlatAst ast = {0};
+    if (flat_path) {
+        // снимок отображается в память через mmap и используется как есть
+        if (flat_ast_open(&ast, flat_path, tree_sitter_v2lang_test()) != 0) {
+            fprintf(stderr, "%s: not a flat AST of this grammar\n", flat_path);
+            source_reader_close(&rd);
+            return 6;
+        }
+        // размер и хеш содержимого: снимок другой версии файла не подходит
+        uint64_t hash = 0;
+        if (flat_ast_source_hash(&rd, &hash) != 0) {
+            fprintf(stderr, "%s: %s\n", input_path, strerror(rd.error ? rd.error : EIO));
+            flat_ast_free(&ast);
+            source_reader_close(&rd);
+            return 2;
+        }
+        if (ast.source_len != rd.size || ast.source_hash != hash) {
+            fprintf(stderr, "%s: made from another version of %s\n", flat_path, input_path);
+            flat_ast_free(&ast);
+            source_reader_close(&rd);
+            return 6;
+        }
+    } else {
+        TSParser *parser = ts_parser_new();
+        if (!ts_parser_set_language(parser, tree_sitter_v2lang_test())) {
+            fprintf(stderr, "Failed to set language.\n");
+            source_reader_close(&rd);
+            ts_parser_delete(parser);
+            return 3;
+        }
 
-    TSParser *parser = ts_parser_new();
-    if (!ts_parser_set_language(parser, tree_sitter_v2lang_test())) {
-        fprintf(stderr, "Failed to set language.\n");
-        free(source);
-        ts_parser_delete(parser);
-        return 3;
-    }
+        TSTree *tree = ts_parser_parse(parser, NULL, source_reader_input(&rd));
+        if (tree && rd.error) {
+            fprintf(stderr, "%s: %s\n", input_path, strerror(rd.error));
+            ts_tree_delete(tree);
+            tree = NULL;
+        }
+        if (!tree) {
+            fprintf(stderr, "Parse failed (null tree).\n");
+            source_reader_close(&rd);
+            ts_parser_delete(parser);
+            return 4;
+        }
 
-    TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)len);
-    if (!tree) {
-        fprintf(stderr, "Parse failed (null tree).\n");
-        free(source);
+        // один проход курсором; дальше дерево tree-sitter не нужно
+        int built = flat_ast_build(&ast, NULL, ts_tree_root_node(tree));
+        ts_tree_delete(tree);
         ts_parser_delete(parser);
-        return 4;
+        if (built != 0) {
+            fprintf(stderr, "Cannot flatten the tree.\n");
+            flat_ast_free(&ast);
+            source_reader_close(&rd);
+            return 4;
+        }
+        uint64_t hash = 0;
+        if (save_path && flat_ast_source_hash(&rd, &hash) != 0) {
+            fprintf(stderr, "%s: %s\n", input_path, strerror(rd.error ? rd.error : EIO));
+            flat_ast_free(&ast);
+            source_reader_close(&rd);
+            return 2;
+        }
+        if (save_path && flat_ast_write(&ast, rd.size, hash, save_path) != 0) {
+            perror(save_path);
+            flat_ast_free(&ast);
+            source_reader_close(&rd);
+            return 7;
+        }
     }
 
     FILE *out = fopen(output_path, "w");
     if (!out) {
         perror("fopen output");
-        ts_tree_delete(tree);
-        ts_parser_delete(parser);
-        free(source);
+        flat_ast_free(&ast);
+        source_reader_close(&rd);
         return 5;
     }
 
     // начало DOT-графа
     fprintf(out, "digraph AST {\n");
-    int next_id = 0;
-    TSNode root = ts_tree_root_node(tree);
-    dump_node_dot(out, root, -1, &next_id, source);
+    dump_ast_dot(out, &ast, &rd);
     fprintf(out, "}\n");
 
     fclose(out);
-    ts_tree_delete(tree);
-    ts_parser_delete(parser);
-    free(source);
+    flat_ast_free(&ast);
+    source_reader_close(&rd);
     return 0;
 }